@@ -0,0 +1,120 @@
+#include "bench.h"
+
+#include <pthread.h>
+
+#include "dats.h"
+
+#define SIZE 1000000
+#define OPERATIONS 4000000
+
+static const uint64_t THREADS[] = { 1, 2, 4 };
+
+typedef struct
+{
+    dats_bitset_t *bitset;
+    pthread_mutex_t *mutex;
+    uint64_t thread;
+    uint64_t threads;
+} _bench_args;
+
+static uint64_t _next(uint64_t *state)
+{
+    *state = *state * 6364136223846793005ull + 1442695040888963407ull;
+    return *state >> 20;
+}
+
+/* Marking random items as visited, like a parallel graph traversal. */
+static void *_atomic_mark_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t state = args->thread + 1;
+
+    for (uint64_t i = 0; i < OPERATIONS / args->threads; i++)
+    {
+        bench_sink += dats_atomic_bitset_test_and_set(args->bitset, _next(&state) % SIZE + 1);
+    }
+    return NULL;
+}
+
+static void *_mutex_mark_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t state = args->thread + 1;
+
+    for (uint64_t i = 0; i < OPERATIONS / args->threads; i++)
+    {
+        uint64_t position = _next(&state) % SIZE + 1;
+
+        pthread_mutex_lock(args->mutex);
+        bench_sink += dats_bitset_is_set(args->bitset, position);
+        dats_bitset_set(args->bitset, position, true);
+        pthread_mutex_unlock(args->mutex);
+    }
+    return NULL;
+}
+
+/* Every thread takes free slots until none is left, starting from the beginning or from its own part of the bitset. */
+static void *_claim_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t position = 1;
+
+    while ((position = dats_atomic_bitset_claim_first_free(args->bitset, position)) != 0)
+    {
+        bench_sink += position;
+    }
+    return NULL;
+}
+
+static void *_claim_spread_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t position = args->thread * (SIZE / args->threads) + 1;
+
+    while ((position = dats_atomic_bitset_claim_first_free(args->bitset, position)) != 0)
+    {
+        bench_sink += position;
+    }
+    position = 1;
+    while ((position = dats_atomic_bitset_claim_first_free(args->bitset, position)) != 0)
+    {
+        bench_sink += position;
+    }
+    return NULL;
+}
+
+static void _run(const char *label, uint64_t threads, uint64_t operations, void *(*worker)(void *))
+{
+    char name[64];
+    pthread_t workers[4];
+    _bench_args args[4];
+    dats_bitset_t bt = dats_bitset_new(SIZE);
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        args[i] = (_bench_args){ &bt, &mutex, i, threads };
+        pthread_create(&workers[i], NULL, worker, &args[i]);
+    }
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        pthread_join(workers[i], NULL);
+    }
+
+    snprintf(name, sizeof(name), "%s %lu threads", label, (unsigned long)threads);
+    bench_report(name, operations, bench_now_ns() - start);
+    dats_bitset_free(&bt);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(THREADS) / sizeof(THREADS[0]); i++)
+    {
+        _run("atomic test_and_set", THREADS[i], OPERATIONS, _atomic_mark_worker);
+        _run("mutex+dats_bitset_set", THREADS[i], OPERATIONS, _mutex_mark_worker);
+        _run("claim_first_free", THREADS[i], SIZE, _claim_worker);
+        _run("claim_first_free spread", THREADS[i], SIZE, _claim_spread_worker);
+    }
+    return 0;
+}
@@ -0,0 +1,26 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static inline uint64_t bench_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static inline void bench_report(const char *name, uint64_t operations, uint64_t elapsed_ns)
+{
+    double seconds = (double)elapsed_ns / 1e9;
+    printf("%-48s %12.2f ns/op %14.0f op/s\n", name, (double)elapsed_ns / (double)operations, (double)operations / seconds);
+}
+
+/* Keep the compiler from throwing away results we only compute for timing. */
+static volatile uint64_t bench_sink;
+
+#endif
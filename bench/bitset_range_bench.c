@@ -0,0 +1,99 @@
+#include "bench.h"
+
+#include "dats.h"
+
+static const uint64_t SIZE = 8000000;
+static const uint64_t RANGE = 1000000;
+static const uint64_t REPEATS = 20;
+
+static void _bench_set(void)
+{
+    char name[64];
+    dats_bitset_t bt = dats_bitset_new(SIZE);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        for (uint64_t position = r + 1; position <= r + RANGE; position++)
+        {
+            dats_bitset_set(&bt, position, r % 2 == 0);
+        }
+    }
+    snprintf(name, sizeof(name), "dats_bitset_set loop range=%lu", (unsigned long)RANGE);
+    bench_report(name, RANGE * REPEATS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        if (r % 2 == 0)
+        {
+            dats_bitset_set_range(&bt, r + 1, r + RANGE);
+        }
+        else
+        {
+            dats_bitset_clear_range(&bt, r + 1, r + RANGE);
+        }
+    }
+    snprintf(name, sizeof(name), "set_range/clear_range range=%lu", (unsigned long)RANGE);
+    bench_report(name, RANGE * REPEATS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        dats_bitset_flip_range(&bt, r + 1, r + RANGE);
+    }
+    snprintf(name, sizeof(name), "flip_range range=%lu", (unsigned long)RANGE);
+    bench_report(name, RANGE * REPEATS, bench_now_ns() - start);
+
+    dats_bitset_free(&bt);
+}
+
+/* Worst case for the checks: the answer is only known at the last bit. */
+static void _bench_checks(void)
+{
+    char name[64];
+    dats_bitset_t bt = dats_bitset_new(SIZE);
+    dats_bitset_set(&bt, SIZE, true);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        for (uint64_t position = 1; position <= SIZE; position++)
+        {
+            if (dats_bitset_is_set(&bt, position))
+            {
+                bench_sink += position;
+                break;
+            }
+        }
+    }
+    snprintf(name, sizeof(name), "dats_bitset_is_set loop any n=%lu", (unsigned long)SIZE);
+    bench_report(name, SIZE * REPEATS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        bench_sink += dats_bitset_any(&bt);
+    }
+    snprintf(name, sizeof(name), "dats_bitset_any n=%lu", (unsigned long)SIZE);
+    bench_report(name, SIZE * REPEATS, bench_now_ns() - start);
+
+    dats_bitset_set_range(&bt, 1, SIZE - 1);
+    dats_bitset_set(&bt, SIZE, false);
+    start = bench_now_ns();
+    for (uint64_t r = 0; r < REPEATS; r++)
+    {
+        bench_sink += dats_bitset_all(&bt);
+    }
+    snprintf(name, sizeof(name), "dats_bitset_all n=%lu", (unsigned long)SIZE);
+    bench_report(name, SIZE * REPEATS, bench_now_ns() - start);
+
+    dats_bitset_free(&bt);
+}
+
+int main(void)
+{
+    _bench_set();
+    _bench_checks();
+    return 0;
+}
@@ -0,0 +1,104 @@
+#include "bench.h"
+
+#include <pthread.h>
+
+#include "dats.h"
+
+#define WAKEUPS 20000
+#define ITEMS 1000000
+
+static const uint64_t BATCH_SIZES[] = { 1, 64 };
+
+typedef struct
+{
+    dats_blocking_queue_t *requests;
+    dats_blocking_queue_t *replies;
+} _bench_args;
+
+/* Echo back every timestamp so the main thread measures a full sleep and wake up round trip. */
+static void *_echo(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t data;
+
+    while (dats_blocking_queue_dequeue(args->requests, &data) == DATS_BLOCKING_QUEUE_OK)
+    {
+        dats_blocking_queue_enqueue(args->replies, &data);
+    }
+    return NULL;
+}
+
+static void _bench_round_trip(void)
+{
+    dats_blocking_queue_t requests = dats_blocking_queue_new(sizeof(uint64_t));
+    dats_blocking_queue_t replies = dats_blocking_queue_new(sizeof(uint64_t));
+    _bench_args args = { &requests, &replies };
+    pthread_t thread;
+
+    pthread_create(&thread, NULL, _echo, &args);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < WAKEUPS; i++)
+    {
+        uint64_t data = i;
+        dats_blocking_queue_enqueue(&requests, &data);
+        dats_blocking_queue_dequeue(&replies, &data);
+        bench_sink += data;
+    }
+    bench_report("blocking queue wake up round trip", WAKEUPS, bench_now_ns() - start);
+
+    dats_blocking_queue_close(&requests);
+    pthread_join(thread, NULL);
+    dats_blocking_queue_free(&requests);
+    dats_blocking_queue_free(&replies);
+}
+
+static void *_consume(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t data;
+
+    while (dats_blocking_queue_dequeue(args->requests, &data) == DATS_BLOCKING_QUEUE_OK)
+    {
+        bench_sink += data;
+    }
+    return NULL;
+}
+
+static void _bench_throughput(uint64_t batch)
+{
+    char name[64];
+    dats_blocking_queue_t requests = dats_blocking_queue_new(sizeof(uint64_t));
+    _bench_args args = { &requests, NULL };
+    pthread_t thread;
+    uint64_t items[64];
+
+    for (uint64_t i = 0; i < batch; i++)
+    {
+        items[i] = i;
+    }
+
+    uint64_t start = bench_now_ns();
+    pthread_create(&thread, NULL, _consume, &args);
+    for (uint64_t i = 0; i < ITEMS; i += batch)
+    {
+        dats_blocking_queue_enqueue_n(&requests, items, batch);
+    }
+    dats_blocking_queue_close(&requests);
+    pthread_join(thread, NULL);
+
+    snprintf(name, sizeof(name), "blocking queue 1 consumer batch %lu", (unsigned long)batch);
+    bench_report(name, ITEMS, bench_now_ns() - start);
+
+    dats_blocking_queue_free(&requests);
+}
+
+int main(void)
+{
+    _bench_round_trip();
+    for (uint64_t i = 0; i < sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]); i++)
+    {
+        _bench_throughput(BATCH_SIZES[i]);
+    }
+    return 0;
+}
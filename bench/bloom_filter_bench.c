@@ -0,0 +1,97 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 1000000, 10000000 };
+static const uint64_t LOOKUPS = 2000000;
+static const uint64_t BST_SIZE = 1000000;
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t _key(uint64_t i)
+{
+    return i * 0x9e3779b97f4a7c15ull;
+}
+
+static void _bench_bloom_filter(uint64_t size, bool blocked)
+{
+    char name[64];
+    const char *layout = blocked ? "blocked" : "standard";
+    dats_bloom_filter_t bf = dats_bloom_filter_new(sizeof(uint64_t), size, 0.01, blocked);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < size; i++)
+    {
+        uint64_t key = _key(i);
+        dats_bloom_filter_add(&bf, &key);
+    }
+    snprintf(name, sizeof(name), "bloom %s add n=%lu", layout, (unsigned long)size);
+    bench_report(name, size, bench_now_ns() - start);
+
+    /* Present keys must check every position, absent keys mostly stop at the first one at 0. */
+    uint64_t hits = 0;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(i * (size / LOOKUPS + 1) % size);
+        hits += dats_bloom_filter_contains(&bf, &key);
+    }
+    snprintf(name, sizeof(name), "bloom %s contains present n=%lu", layout, (unsigned long)size);
+    bench_report(name, LOOKUPS, bench_now_ns() - start);
+
+    uint64_t false_positives = 0;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(size + i);
+        false_positives += dats_bloom_filter_contains(&bf, &key);
+    }
+    snprintf(name, sizeof(name), "bloom %s contains absent n=%lu", layout, (unsigned long)size);
+    bench_report(name, LOOKUPS, bench_now_ns() - start);
+    printf("%-48s %12.4f %%\n", "measured false positive rate", 100.0 * (double)false_positives / (double)LOOKUPS);
+
+    bench_sink += hits;
+    dats_bloom_filter_free(&bf);
+}
+
+static void _bench_binary_search_tree(void)
+{
+    char name[64];
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare);
+
+    for (uint64_t i = 0; i < BST_SIZE; i++)
+    {
+        uint64_t key = _key(i);
+        dats_binary_search_tree_insert(&bst, &key);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(BST_SIZE + i);
+        bench_sink += dats_binary_search_tree_contains(&bst, &key);
+    }
+    snprintf(name, sizeof(name), "bst contains absent n=%lu", (unsigned long)BST_SIZE);
+    bench_report(name, LOOKUPS, bench_now_ns() - start);
+
+    dats_binary_search_tree_free(&bst);
+}
+
+int main(void)
+{
+    _bench_binary_search_tree();
+
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        _bench_bloom_filter(SIZES[i], false);
+        _bench_bloom_filter(SIZES[i], true);
+    }
+    return 0;
+}
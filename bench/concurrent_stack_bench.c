@@ -0,0 +1,102 @@
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "dats.h"
+
+#define OPERATIONS 400000
+#define BUFFERS 64
+
+static const uint64_t THREADS[] = { 1, 2, 4 };
+
+typedef struct
+{
+    dats_concurrent_stack_t *concurrent;
+    dats_stack_t *stack;
+    pthread_mutex_t *mutex;
+    uint64_t operations;
+} _bench_args;
+
+/* Each thread takes a buffer from the free list and gives it back, like a shared pool of reusable buffers. */
+static void *_concurrent_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t buffer;
+
+    for (uint64_t i = 0; i < args->operations; i++)
+    {
+        while (!dats_concurrent_stack_try_pop(args->concurrent, &buffer))
+        {
+            sched_yield();
+        }
+        bench_sink += buffer;
+        dats_concurrent_stack_try_push(args->concurrent, &buffer);
+    }
+    return NULL;
+}
+
+static void *_mutex_worker(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t buffer;
+
+    for (uint64_t i = 0; i < args->operations; i++)
+    {
+        pthread_mutex_lock(args->mutex);
+        dats_stack_pop_into(args->stack, &buffer);
+        pthread_mutex_unlock(args->mutex);
+
+        bench_sink += buffer;
+
+        pthread_mutex_lock(args->mutex);
+        dats_stack_push(args->stack, &buffer);
+        pthread_mutex_unlock(args->mutex);
+    }
+    return NULL;
+}
+
+static void _run(const char *label, uint64_t threads, _bench_args *args, void *(*worker)(void *))
+{
+    char name[64];
+    pthread_t workers[4];
+
+    args->operations = OPERATIONS / threads;
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        pthread_create(&workers[i], NULL, worker, args);
+    }
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        pthread_join(workers[i], NULL);
+    }
+
+    snprintf(name, sizeof(name), "%s pop+push %lu threads", label, (unsigned long)threads);
+    bench_report(name, OPERATIONS, bench_now_ns() - start);
+}
+
+int main(void)
+{
+    dats_concurrent_stack_t concurrent = dats_concurrent_stack_new(sizeof(uint64_t), BUFFERS);
+    dats_stack_t stack = dats_stack_new(sizeof(uint64_t));
+    pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+    _bench_args args = { &concurrent, &stack, &mutex, 0 };
+
+    for (uint64_t i = 0; i < BUFFERS; i++)
+    {
+        dats_concurrent_stack_try_push(&concurrent, &i);
+        dats_stack_push(&stack, &i);
+    }
+
+    for (uint64_t i = 0; i < sizeof(THREADS) / sizeof(THREADS[0]); i++)
+    {
+        _run("concurrent stack", THREADS[i], &args, _concurrent_worker);
+        _run("mutex+dats_stack", THREADS[i], &args, _mutex_worker);
+    }
+
+    dats_concurrent_stack_free(&concurrent);
+    dats_stack_free(&stack);
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+static const uint64_t UPDATES = 10000000;
+static const uint64_t DISTINCT = 1000000;
+/* The tree is much slower, it only gets a part of the stream. */
+static const uint64_t BST_UPDATES = 2000000;
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t _key(uint64_t i)
+{
+    return (i % DISTINCT) * 0x9e3779b97f4a7c15ull;
+}
+
+static void _bench_binary_search_tree(void)
+{
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < BST_UPDATES; i++)
+    {
+        uint64_t key = _key(i);
+        if (!dats_binary_search_tree_contains(&bst, &key))
+        {
+            dats_binary_search_tree_insert(&bst, &key);
+        }
+    }
+    bench_report("bst distinct count update", BST_UPDATES, bench_now_ns() - start);
+    printf("%-48s %12lu distinct\n", "bst length", (unsigned long)dats_binary_search_tree_length(&bst));
+
+    dats_binary_search_tree_free(&bst);
+}
+
+static void _bench_hyperloglog(uint64_t precision)
+{
+    char name[64];
+    dats_hyperloglog_t hll = dats_hyperloglog_new(sizeof(uint64_t), precision);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < UPDATES; i++)
+    {
+        uint64_t key = _key(i);
+        dats_hyperloglog_add(&hll, &key);
+    }
+    snprintf(name, sizeof(name), "hyperloglog p=%lu add", (unsigned long)precision);
+    bench_report(name, UPDATES, bench_now_ns() - start);
+
+    uint64_t count = dats_hyperloglog_count(&hll);
+    printf("%-48s %12lu distinct %+6.2f %% %8lu bytes\n", "hyperloglog count", (unsigned long)count,
+        100.0 * ((double)count - (double)DISTINCT) / (double)DISTINCT, (unsigned long)dats_hyperloglog_memory_usage(&hll));
+
+    dats_hyperloglog_free(&hll);
+}
+
+static void _bench_count_min_sketch(void)
+{
+    dats_count_min_sketch_t cms = dats_count_min_sketch_new(sizeof(uint64_t), 0.0001, 0.01);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < UPDATES; i++)
+    {
+        uint64_t key = _key(i);
+        dats_count_min_sketch_add(&cms, &key, 1);
+    }
+    bench_report("count-min eps=1e-4 delta=1% add", UPDATES, bench_now_ns() - start);
+
+    uint64_t overestimate = 0;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < DISTINCT; i++)
+    {
+        uint64_t key = _key(i);
+        overestimate += dats_count_min_sketch_estimate(&cms, &key) - UPDATES / DISTINCT;
+    }
+    bench_report("count-min eps=1e-4 delta=1% estimate", DISTINCT, bench_now_ns() - start);
+    printf("%-48s %12.2f over %8lu bytes\n", "count-min mean overestimate", (double)overestimate / (double)DISTINCT,
+        (unsigned long)(cms.width * cms.depth * sizeof(uint64_t)));
+
+    dats_count_min_sketch_free(&cms);
+}
+
+int main(void)
+{
+    _bench_hyperloglog(12);
+    _bench_hyperloglog(16);
+    _bench_count_min_sketch();
+    _bench_binary_search_tree();
+    return 0;
+}
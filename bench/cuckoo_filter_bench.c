@@ -0,0 +1,110 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+/* 90% of the 2^20 slots, the power of two bucket count would leave half of them empty at 1e6. */
+static const uint64_t SIZE = 950000;
+static const uint64_t LOOKUPS = 2000000;
+static const uint64_t FINGERPRINT_BITS[] = { 8, 12, 16 };
+
+static uint64_t _key(uint64_t i)
+{
+    return i * 0x9e3779b97f4a7c15ull;
+}
+
+static void _bench_cuckoo_filter(uint64_t fingerprint_bits)
+{
+    char name[64];
+    dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint64_t), SIZE, fingerprint_bits);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < SIZE; i++)
+    {
+        uint64_t key = _key(i);
+        bench_sink += dats_cuckoo_filter_insert(&cf, &key);
+    }
+    snprintf(name, sizeof(name), "cuckoo %lu bits insert", (unsigned long)fingerprint_bits);
+    bench_report(name, SIZE, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(i % SIZE);
+        bench_sink += dats_cuckoo_filter_contains(&cf, &key);
+    }
+    snprintf(name, sizeof(name), "cuckoo %lu bits contains present", (unsigned long)fingerprint_bits);
+    bench_report(name, LOOKUPS, bench_now_ns() - start);
+
+    uint64_t false_positives = 0;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(SIZE + i);
+        false_positives += dats_cuckoo_filter_contains(&cf, &key);
+    }
+    snprintf(name, sizeof(name), "cuckoo %lu bits contains absent", (unsigned long)fingerprint_bits);
+    bench_report(name, LOOKUPS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < SIZE; i++)
+    {
+        uint64_t key = _key(i);
+        bench_sink += dats_cuckoo_filter_remove(&cf, &key);
+    }
+    snprintf(name, sizeof(name), "cuckoo %lu bits remove", (unsigned long)fingerprint_bits);
+    bench_report(name, SIZE, bench_now_ns() - start);
+
+    uint64_t bits = dats_cuckoo_filter_capacity(&cf) * fingerprint_bits;
+    printf("%-48s %12.4f %% %8.2f bits/data\n", "false positive rate, memory",
+        100.0 * (double)false_positives / (double)LOOKUPS, (double)bits / (double)SIZE);
+
+    dats_cuckoo_filter_free(&cf);
+}
+
+/* Blocked bloom filters at the rate of the 12 bits cuckoo filter, without removal. */
+static void _bench_bloom_filter(void)
+{
+    dats_bloom_filter_t bf = dats_bloom_filter_new(sizeof(uint64_t), SIZE, 0.002, true);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < SIZE; i++)
+    {
+        uint64_t key = _key(i);
+        dats_bloom_filter_add(&bf, &key);
+    }
+    bench_report("bloom blocked 0.2% add", SIZE, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(i % SIZE);
+        bench_sink += dats_bloom_filter_contains(&bf, &key);
+    }
+    bench_report("bloom blocked 0.2% contains present", LOOKUPS, bench_now_ns() - start);
+
+    uint64_t false_positives = 0;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t key = _key(SIZE + i);
+        false_positives += dats_bloom_filter_contains(&bf, &key);
+    }
+    bench_report("bloom blocked 0.2% contains absent", LOOKUPS, bench_now_ns() - start);
+
+    printf("%-48s %12.4f %% %8.2f bits/data\n", "false positive rate, memory",
+        100.0 * (double)false_positives / (double)LOOKUPS, (double)bf.bits.size / (double)SIZE);
+
+    dats_bloom_filter_free(&bf);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(FINGERPRINT_BITS) / sizeof(FINGERPRINT_BITS[0]); i++)
+    {
+        _bench_cuckoo_filter(FINGERPRINT_BITS[i]);
+    }
+    _bench_bloom_filter();
+    return 0;
+}
@@ -0,0 +1,146 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 100000, 1000000 };
+static const uint64_t ARITIES[] = { 2, 4, 8 };
+
+typedef struct
+{
+    uint64_t priority;
+    uint64_t id;
+} _entry_t;
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint64_t _next(uint64_t *state)
+{
+    *state = *state * 6364136223846793005ull + 1442695040888963407ull;
+    return *state >> 33;
+}
+
+static void _bench_push_pop(uint64_t size)
+{
+    char name[64];
+    uint64_t out;
+    uint64_t state = size;
+
+    dats_priority_queue_t pq = dats_priority_queue_new(sizeof(uint64_t), _compare);
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < size; i++)
+    {
+        uint64_t key = _next(&state);
+        dats_priority_queue_push(&pq, &key);
+    }
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_priority_queue_pop_into(&pq, &out);
+        bench_sink += out;
+    }
+    snprintf(name, sizeof(name), "priority queue push+pop n=%lu", (unsigned long)size);
+    bench_report(name, size, bench_now_ns() - start);
+    dats_priority_queue_free(&pq);
+
+    for (uint64_t a = 0; a < sizeof(ARITIES) / sizeof(ARITIES[0]); a++)
+    {
+        state = size;
+        dats_d_ary_heap_t heap = dats_d_ary_heap_new(sizeof(uint64_t), ARITIES[a], _compare);
+        start = bench_now_ns();
+        for (uint64_t i = 0; i < size; i++)
+        {
+            uint64_t key = _next(&state);
+            dats_d_ary_heap_push(&heap, &key);
+        }
+        for (uint64_t i = 0; i < size; i++)
+        {
+            dats_d_ary_heap_pop_into(&heap, &out);
+            bench_sink += out;
+        }
+        snprintf(name, sizeof(name), "d-ary heap d=%lu push+pop n=%lu", (unsigned long)ARITIES[a], (unsigned long)size);
+        bench_report(name, size, bench_now_ns() - start);
+        dats_d_ary_heap_free(&heap);
+    }
+}
+
+/* Every id is pushed once then its priority is lowered size times before draining, like a Dijkstra relaxation. */
+static void _bench_decrease_key(uint64_t size)
+{
+    char name[64];
+    uint64_t *priorities = malloc(size * sizeof(uint64_t));
+    uint64_t state = size;
+
+    /* Without decrease key the stale entries stay in the heap and are skipped when popped. */
+    dats_priority_queue_t pq = dats_priority_queue_new(sizeof(_entry_t), _compare);
+    uint64_t start = bench_now_ns();
+    for (uint64_t id = 0; id < size; id++)
+    {
+        priorities[id] = (uint64_t)1 << 40;
+        _entry_t entry = { priorities[id], id };
+        dats_priority_queue_push(&pq, &entry);
+    }
+    for (uint64_t i = 0; i < size; i++)
+    {
+        uint64_t id = _next(&state) % size;
+        priorities[id] -= _next(&state) % 1024 + 1;
+        _entry_t entry = { priorities[id], id };
+        dats_priority_queue_push(&pq, &entry);
+    }
+    while (dats_priority_queue_length(&pq) > 0)
+    {
+        _entry_t entry;
+        dats_priority_queue_pop_into(&pq, &entry);
+        if (entry.priority == priorities[entry.id])
+        {
+            bench_sink += entry.id;
+        }
+    }
+    snprintf(name, sizeof(name), "priority queue lazy deletion n=%lu", (unsigned long)size);
+    bench_report(name, 2 * size, bench_now_ns() - start);
+    dats_priority_queue_free(&pq);
+
+    for (uint64_t a = 0; a < sizeof(ARITIES) / sizeof(ARITIES[0]); a++)
+    {
+        state = size;
+        dats_indexed_priority_queue_t ipq = dats_indexed_priority_queue_new(sizeof(uint64_t), ARITIES[a], _compare);
+        start = bench_now_ns();
+        for (uint64_t id = 0; id < size; id++)
+        {
+            priorities[id] = (uint64_t)1 << 40;
+            dats_indexed_priority_queue_push(&ipq, id, &priorities[id]);
+        }
+        for (uint64_t i = 0; i < size; i++)
+        {
+            uint64_t id = _next(&state) % size;
+            priorities[id] -= _next(&state) % 1024 + 1;
+            dats_indexed_priority_queue_decrease_key(&ipq, id, &priorities[id]);
+        }
+        while (dats_indexed_priority_queue_length(&ipq) > 0)
+        {
+            uint64_t id;
+            dats_indexed_priority_queue_pop_into(&ipq, &id, NULL);
+            bench_sink += id;
+        }
+        snprintf(name, sizeof(name), "indexed pq d=%lu decrease_key n=%lu", (unsigned long)ARITIES[a], (unsigned long)size);
+        bench_report(name, 2 * size, bench_now_ns() - start);
+        dats_indexed_priority_queue_free(&ipq);
+    }
+
+    free(priorities);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        _bench_push_pop(SIZES[i]);
+        _bench_decrease_key(SIZES[i]);
+    }
+    return 0;
+}
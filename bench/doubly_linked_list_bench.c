@@ -0,0 +1,88 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+#define OPERATIONS 200000
+
+/* Number of data kept in the lists while the workload runs. */
+static const uint64_t DEPTHS[] = { 16, 256, 4096 };
+
+static void _bench_singly(uint64_t depth)
+{
+    char name[64];
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(uint64_t));
+    for (uint64_t i = 0; i < depth; i++)
+    {
+        dats_linked_list_insert_head(&ll, &i);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < OPERATIONS; i++)
+    {
+        dats_linked_list_insert_head(&ll, &i);
+        uint64_t *data = dats_linked_list_remove_tail(&ll);
+        bench_sink += *data;
+        free(data);
+    }
+    snprintf(name, sizeof(name), "singly insert_head+remove_tail depth %lu", (unsigned long)depth);
+    bench_report(name, OPERATIONS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < OPERATIONS; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+        uint64_t *data = dats_linked_list_remove_tail(&ll);
+        bench_sink += *data;
+        free(data);
+    }
+    snprintf(name, sizeof(name), "singly insert_tail+remove_tail depth %lu", (unsigned long)depth);
+    bench_report(name, OPERATIONS, bench_now_ns() - start);
+
+    dats_linked_list_free(&ll);
+}
+
+static void _bench_doubly(uint64_t depth)
+{
+    char name[64];
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(uint64_t));
+    for (uint64_t i = 0; i < depth; i++)
+    {
+        dats_doubly_linked_list_insert_head(&dll, &i);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < OPERATIONS; i++)
+    {
+        dats_doubly_linked_list_insert_head(&dll, &i);
+        uint64_t *data = dats_doubly_linked_list_remove_tail(&dll);
+        bench_sink += *data;
+        free(data);
+    }
+    snprintf(name, sizeof(name), "doubly insert_head+remove_tail depth %lu", (unsigned long)depth);
+    bench_report(name, OPERATIONS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < OPERATIONS; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+        uint64_t *data = dats_doubly_linked_list_remove_tail(&dll);
+        bench_sink += *data;
+        free(data);
+    }
+    snprintf(name, sizeof(name), "doubly insert_tail+remove_tail depth %lu", (unsigned long)depth);
+    bench_report(name, OPERATIONS, bench_now_ns() - start);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(DEPTHS) / sizeof(DEPTHS[0]); i++)
+    {
+        _bench_singly(DEPTHS[i]);
+        _bench_doubly(DEPTHS[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 4, 8, 16, 32, 64, 256, 4096 };
+static const uint64_t BYTES_BY_RUN = 256 * 1024 * 1024;
+static const uint64_t BULK_KEYS = 1024;
+static const uint64_t BULK_ROUNDS = 20000;
+
+/* MurmurHash64A, the previous default, kept here as the baseline. */
+static uint64_t _murmur64a(const void *data, uint64_t size, uint64_t seed)
+{
+    const uint64_t multiplier = 0xc6a4a7935bd1e995ull;
+    const uint8_t *bytes = data;
+    uint64_t hash = seed ^ (size * multiplier);
+
+    for (uint64_t i = 0; i + 8 <= size; i += 8)
+    {
+        uint64_t word;
+        memcpy(&word, &bytes[i], sizeof(uint64_t));
+        word *= multiplier;
+        word ^= word >> 47;
+        word *= multiplier;
+        hash ^= word;
+        hash *= multiplier;
+    }
+
+    uint64_t tail_size = size % 8;
+    if (tail_size > 0)
+    {
+        for (uint64_t i = tail_size; i > 0; i--)
+        {
+            hash ^= (uint64_t)bytes[size - tail_size + i - 1] << (8 * (i - 1));
+        }
+        hash *= multiplier;
+    }
+
+    hash ^= hash >> 47;
+    hash *= multiplier;
+    hash ^= hash >> 47;
+    return hash;
+}
+
+static void _bench_size(const uint8_t *buffer, uint64_t size, uint64_t (*hash)(const void *, uint64_t, uint64_t), const char *label)
+{
+    char name[64];
+    uint64_t count = BYTES_BY_RUN / size;
+    uint64_t keys = 4096 * 64 / size;
+    uint64_t result = 0;
+
+    /* The result feeds the seed of the next hash so the latency is measured, like in a hash table probe. */
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < count; i++)
+    {
+        result = hash(&buffer[(i % keys) * size], size, result);
+    }
+    uint64_t elapsed = bench_now_ns() - start;
+
+    snprintf(name, sizeof(name), "%s %lu bytes", label, (unsigned long)size);
+    bench_report(name, count, elapsed);
+    printf("%-48s %12.2f GB/s\n", "", (double)BYTES_BY_RUN / (double)elapsed);
+    bench_sink += result;
+}
+
+static void _bench_bulk(const uint8_t *buffer, uint64_t size)
+{
+    char name[64];
+    uint64_t *out = malloc(BULK_KEYS * sizeof(uint64_t));
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t round = 0; round < BULK_ROUNDS; round++)
+    {
+        for (uint64_t i = 0; i < BULK_KEYS; i++)
+        {
+            out[i] = dats_hash_bytes(&buffer[i * size], size, round);
+        }
+        bench_sink += out[round % BULK_KEYS];
+    }
+    snprintf(name, sizeof(name), "hash_bytes loop %lu bytes keys", (unsigned long)size);
+    bench_report(name, BULK_KEYS * BULK_ROUNDS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t round = 0; round < BULK_ROUNDS; round++)
+    {
+        dats_hash_n(buffer, BULK_KEYS, size, round, out);
+        bench_sink += out[round % BULK_KEYS];
+    }
+    snprintf(name, sizeof(name), "hash_n %lu bytes keys", (unsigned long)size);
+    bench_report(name, BULK_KEYS * BULK_ROUNDS, bench_now_ns() - start);
+
+    free(out);
+}
+
+int main(void)
+{
+    uint8_t *buffer = malloc(4096 * 64);
+    for (uint64_t i = 0; i < 4096 * 64; i++)
+    {
+        buffer[i] = (uint8_t)(i * 131 + 7);
+    }
+
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        _bench_size(buffer, SIZES[i], _murmur64a, "murmur64a");
+        _bench_size(buffer, SIZES[i], dats_hash_bytes, "wyhash");
+    }
+
+    _bench_bulk(buffer, 4);
+    _bench_bulk(buffer, 8);
+    _bench_bulk(buffer, 16);
+
+    free(buffer);
+    return 0;
+}
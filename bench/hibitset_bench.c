@@ -0,0 +1,98 @@
+#include "bench.h"
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 1000000, 1000000000 };
+static const uint64_t SET_BITS = 3000;
+
+static void _sink(uint64_t position)
+{
+    bench_sink += position;
+}
+
+static void _fill(dats_bitset_t *bt, dats_hibitset_t *hbs, uint64_t size, uint64_t seed)
+{
+    for (uint64_t i = 0; i < SET_BITS; i++)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t position = (seed >> 11) % size + 1;
+        if (bt != NULL)
+        {
+            dats_bitset_set(bt, position, true);
+        }
+        dats_hibitset_set(hbs, position, true);
+    }
+}
+
+/* Iterating a flat bitset has to read every word, even the empty ones. */
+static void _bench_iterate(uint64_t size)
+{
+    char name[64];
+    dats_bitset_t bt = dats_bitset_new(size);
+    dats_hibitset_t hbs = dats_hibitset_new(size);
+    _fill(&bt, &hbs, size, 1);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t index = 0; index < (size + 63) / 64; index++)
+    {
+        uint64_t word = dats_bitset_get_word(&bt, index);
+        for (uint64_t offset = 0; word != 0; offset++, word <<= 1)
+        {
+            if ((word & 0x8000000000000000ull) != 0)
+            {
+                bench_sink += index * 64 + offset + 1;
+            }
+        }
+    }
+    snprintf(name, sizeof(name), "bitset word scan n=%lu", (unsigned long)size);
+    bench_report(name, SET_BITS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t position = dats_hibitset_next_set(&hbs, 1); position != 0; position = dats_hibitset_next_set(&hbs, position + 1))
+    {
+        bench_sink += position;
+    }
+    snprintf(name, sizeof(name), "hibitset next_set n=%lu", (unsigned long)size);
+    bench_report(name, SET_BITS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    dats_hibitset_map(&hbs, _sink);
+    snprintf(name, sizeof(name), "hibitset map n=%lu", (unsigned long)size);
+    bench_report(name, SET_BITS, bench_now_ns() - start);
+
+    dats_bitset_free(&bt);
+    dats_hibitset_free(&hbs);
+}
+
+static void _bench_and_or(uint64_t size)
+{
+    char name[64];
+    dats_hibitset_t first = dats_hibitset_new(size);
+    dats_hibitset_t second = dats_hibitset_new(size);
+    _fill(NULL, &first, size, 2);
+    _fill(NULL, &second, size, 3);
+
+    uint64_t start = bench_now_ns();
+    dats_hibitset_or(&first, &second);
+    snprintf(name, sizeof(name), "hibitset or n=%lu", (unsigned long)size);
+    bench_report(name, SET_BITS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    dats_hibitset_and(&first, &second);
+    snprintf(name, sizeof(name), "hibitset and n=%lu", (unsigned long)size);
+    bench_report(name, SET_BITS, bench_now_ns() - start);
+    bench_sink += dats_hibitset_count(&first);
+
+    dats_hibitset_free(&first);
+    dats_hibitset_free(&second);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        _bench_iterate(SIZES[i]);
+        _bench_and_or(SIZES[i]);
+    }
+    return 0;
+}
@@ -0,0 +1,79 @@
+#include "bench.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 1000, 100000, 1000000 };
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int _qsort_compare(const void *a, const void *b)
+{
+    return (int)_compare(a, b);
+}
+
+static dats_linked_list_t _random_linked_list(uint64_t size)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(uint64_t));
+    uint64_t state = size;
+    for (uint64_t i = 0; i < size; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t data = state >> 16;
+        dats_linked_list_insert_tail(&ll, &data);
+    }
+    return ll;
+}
+
+/* What callers did before dats_linked_list_sort: copy to an array, qsort it and rebuild the list. */
+static void _copy_sort_rebuild(dats_linked_list_t *ll)
+{
+    uint64_t length = dats_linked_list_length(ll);
+    uint8_t *buffer = malloc(length * ll->data_size);
+
+    uint64_t i = 0;
+    for (dats_node_t *node = ll->head; node != NULL; node = node->next_node, i++)
+    {
+        memcpy(&buffer[i * ll->data_size], node->data, ll->data_size);
+    }
+
+    qsort(buffer, length, ll->data_size, _qsort_compare);
+
+    dats_linked_list_clear(ll);
+    for (i = 0; i < length; i++)
+    {
+        dats_linked_list_insert_tail(ll, &buffer[i * ll->data_size]);
+    }
+    free(buffer);
+}
+
+int main(void)
+{
+    char name[64];
+
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        dats_linked_list_t ll = _random_linked_list(SIZES[i]);
+        uint64_t start = bench_now_ns();
+        _copy_sort_rebuild(&ll);
+        snprintf(name, sizeof(name), "copy+qsort+rebuild n=%lu", (unsigned long)SIZES[i]);
+        bench_report(name, SIZES[i], bench_now_ns() - start);
+        dats_linked_list_free(&ll);
+
+        dats_linked_list_t sorted = _random_linked_list(SIZES[i]);
+        start = bench_now_ns();
+        dats_linked_list_sort(&sorted, _compare);
+        snprintf(name, sizeof(name), "dats_linked_list_sort n=%lu", (unsigned long)SIZES[i]);
+        bench_report(name, SIZES[i], bench_now_ns() - start);
+        bench_sink += *(const uint64_t *)dats_linked_list_get_head(&sorted);
+        dats_linked_list_free(&sorted);
+    }
+    return 0;
+}
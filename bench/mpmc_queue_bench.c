@@ -0,0 +1,117 @@
+#include "bench.h"
+
+#include <pthread.h>
+
+#include "dats.h"
+
+#define ITEMS 400000
+#define CAPACITY 1024
+
+static const uint64_t THREADS[] = { 1, 2, 4 };
+
+typedef struct
+{
+    dats_mpmc_queue_t *mpmc;
+    dats_queue_t *queue;
+    pthread_mutex_t *mutex;
+    uint64_t items;
+} _bench_args;
+
+static void *_mpmc_producer(void *arg)
+{
+    _bench_args *args = arg;
+
+    for (uint64_t i = 0; i < args->items; i++)
+    {
+        dats_mpmc_queue_enqueue(args->mpmc, &i);
+    }
+    return NULL;
+}
+
+static void *_mpmc_consumer(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t data;
+
+    for (uint64_t i = 0; i < args->items; i++)
+    {
+        dats_mpmc_queue_dequeue(args->mpmc, &data);
+        bench_sink += data;
+    }
+    return NULL;
+}
+
+/* The mutex baseline is unbounded, producers never wait, consumers retry until they get a data. */
+static void *_mutex_producer(void *arg)
+{
+    _bench_args *args = arg;
+
+    for (uint64_t i = 0; i < args->items; i++)
+    {
+        pthread_mutex_lock(args->mutex);
+        dats_queue_enqueue(args->queue, &i);
+        pthread_mutex_unlock(args->mutex);
+    }
+    return NULL;
+}
+
+static void *_mutex_consumer(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t data;
+
+    for (uint64_t i = 0; i < args->items;)
+    {
+        pthread_mutex_lock(args->mutex);
+        if (dats_queue_length(args->queue) > 0)
+        {
+            dats_queue_dequeue_into(args->queue, &data);
+            bench_sink += data;
+            i++;
+        }
+        pthread_mutex_unlock(args->mutex);
+    }
+    return NULL;
+}
+
+static void _run(const char *label, uint64_t threads, _bench_args *args, void *(*producer)(void *), void *(*consumer)(void *))
+{
+    char name[64];
+    pthread_t producers[4];
+    pthread_t consumers[4];
+
+    args->items = ITEMS / threads;
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        pthread_create(&producers[i], NULL, producer, args);
+        pthread_create(&consumers[i], NULL, consumer, args);
+    }
+    for (uint64_t i = 0; i < threads; i++)
+    {
+        pthread_join(producers[i], NULL);
+        pthread_join(consumers[i], NULL);
+    }
+
+    snprintf(name, sizeof(name), "%s %lu producers %lu consumers", label, (unsigned long)threads, (unsigned long)threads);
+    bench_report(name, ITEMS, bench_now_ns() - start);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(THREADS) / sizeof(THREADS[0]); i++)
+    {
+        dats_mpmc_queue_t mpmc = dats_mpmc_queue_new(sizeof(uint64_t), CAPACITY);
+        dats_queue_t queue = dats_queue_new(sizeof(uint64_t));
+        pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+        _bench_args args = { &mpmc, &queue, &mutex, 0 };
+
+        _run("mpmc", THREADS[i], &args, _mpmc_producer, _mpmc_consumer);
+        _run("mutex+dats_queue", THREADS[i], &args, _mutex_producer, _mutex_consumer);
+
+        dats_mpmc_queue_free(&mpmc);
+        dats_queue_free(&queue);
+    }
+    return 0;
+}
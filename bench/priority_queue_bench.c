@@ -0,0 +1,105 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+static const uint64_t SIZES[] = { 1000, 100000 };
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/* Unique keys because the binary search tree rejects equal data. */
+static uint64_t *_random_keys(uint64_t size)
+{
+    uint64_t *keys = malloc(size * sizeof(uint64_t));
+    for (uint64_t i = 0; i < size; i++)
+    {
+        keys[i] = i;
+    }
+    uint64_t state = size;
+    for (uint64_t i = size - 1; i > 0; i--)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t j = (state >> 33) % (i + 1);
+        uint64_t tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    return keys;
+}
+
+static void _bench_binary_search_tree(const uint64_t *keys, uint64_t size)
+{
+    char name[64];
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_binary_search_tree_insert(&bst, &keys[i]);
+    }
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_node_tree_t *node = bst.head;
+        while (node->left != NULL)
+        {
+            node = node->left;
+        }
+        uint64_t minimum = *(const uint64_t *)node->data;
+        bench_sink += minimum;
+        dats_binary_search_tree_remove(&bst, &minimum);
+    }
+    snprintf(name, sizeof(name), "bst insert+remove minimum n=%lu", (unsigned long)size);
+    bench_report(name, size, bench_now_ns() - start);
+
+    dats_binary_search_tree_free(&bst);
+}
+
+static void _bench_priority_queue(const uint64_t *keys, uint64_t size)
+{
+    char name[64];
+    uint64_t out;
+    dats_priority_queue_t pq = dats_priority_queue_new(sizeof(uint64_t), _compare);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_priority_queue_push(&pq, &keys[i]);
+    }
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_priority_queue_pop_into(&pq, &out);
+        bench_sink += out;
+    }
+    snprintf(name, sizeof(name), "priority queue push+pop n=%lu", (unsigned long)size);
+    bench_report(name, size, bench_now_ns() - start);
+    dats_priority_queue_free(&pq);
+
+    start = bench_now_ns();
+    dats_priority_queue_t built = dats_priority_queue_from_array(sizeof(uint64_t), _compare, keys, size);
+    for (uint64_t i = 0; i < size; i++)
+    {
+        dats_priority_queue_pop_into(&built, &out);
+        bench_sink += out;
+    }
+    snprintf(name, sizeof(name), "priority queue from_array+pop n=%lu", (unsigned long)size);
+    bench_report(name, size, bench_now_ns() - start);
+    dats_priority_queue_free(&built);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); i++)
+    {
+        uint64_t *keys = _random_keys(SIZES[i]);
+        _bench_binary_search_tree(keys, SIZES[i]);
+        _bench_priority_queue(keys, SIZES[i]);
+        free(keys);
+    }
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "bench.h"
+
+#include "bits.h"
+#include "dats.h"
+
+static const uint64_t SIZE = (uint64_t)1 << 28;
+static const uint64_t QUERIES = 1000000;
+static const uint64_t SCAN_QUERIES = 20;
+
+/* One bit set every spacing positions on average. */
+static const uint64_t SPACINGS[] = { 2, 100 };
+
+static uint64_t _next(uint64_t *state)
+{
+    *state = *state * 6364136223846793005ull + 1442695040888963407ull;
+    return *state >> 20;
+}
+
+/* What rank costs without the index: counting the words before the position. */
+static uint64_t _scan_rank(const dats_bitset_t *bt, uint64_t position)
+{
+    uint64_t index = position - 1;
+    uint64_t rank = 0;
+
+    for (uint64_t word = 0; word < index / 64; word++)
+    {
+        rank += dats_bits_popcount64(dats_bitset_get_word(bt, word));
+    }
+    if (index % 64 != 0)
+    {
+        rank += dats_bits_popcount64(dats_bitset_get_word(bt, index / 64) >> (64 - index % 64));
+    }
+    return rank;
+}
+
+static void _bench(uint64_t spacing)
+{
+    char name[64];
+    uint64_t state = spacing;
+    dats_bitset_t bt = dats_bitset_new(SIZE);
+
+    for (uint64_t word = 0; word < SIZE / 64; word++)
+    {
+        uint64_t bits = 0;
+        for (uint64_t i = 0; i < 64; i++)
+        {
+            bits = (bits << 1) | (_next(&state) % spacing == 0);
+        }
+        dats_bitset_set_word(&bt, word, bits);
+    }
+
+    uint64_t start = bench_now_ns();
+    dats_rank_select_t rs = dats_rank_select_new(&bt);
+    snprintf(name, sizeof(name), "rank select build 1/%lu", (unsigned long)spacing);
+    bench_report(name, SIZE / 64, bench_now_ns() - start);
+
+    uint64_t bytes = (rs.lower_length + (rs.lower_length >> 21) + 1 + rs.sample_length) * sizeof(uint64_t);
+    printf("%-48s %12.2f %%\n", "rank select memory overhead", 100.0 * (double)bytes / (double)bt.bytes_needed);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < SCAN_QUERIES; i++)
+    {
+        bench_sink += _scan_rank(&bt, _next(&state) % SIZE + 1);
+    }
+    snprintf(name, sizeof(name), "word scan rank 1/%lu", (unsigned long)spacing);
+    bench_report(name, SCAN_QUERIES, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < QUERIES; i++)
+    {
+        bench_sink += dats_rank_select_rank(&rs, _next(&state) % SIZE + 1);
+    }
+    snprintf(name, sizeof(name), "rank 1/%lu", (unsigned long)spacing);
+    bench_report(name, QUERIES, bench_now_ns() - start);
+
+    uint64_t count = dats_rank_select_count(&rs);
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < QUERIES; i++)
+    {
+        bench_sink += dats_rank_select_select(&rs, _next(&state) % count + 1);
+    }
+    snprintf(name, sizeof(name), "select 1/%lu", (unsigned long)spacing);
+    bench_report(name, QUERIES, bench_now_ns() - start);
+
+    dats_rank_select_free(&rs);
+    dats_bitset_free(&bt);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(SPACINGS) / sizeof(SPACINGS[0]); i++)
+    {
+        _bench(SPACINGS[i]);
+    }
+    return 0;
+}
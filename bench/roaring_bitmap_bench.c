@@ -0,0 +1,133 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "bits.h"
+#include "dats.h"
+
+static const uint64_t UNIVERSE = (uint64_t)1 << 26;
+static const uint64_t PROBES = 1000000;
+
+/* Values per million of the universe, the last case being clustered in ranges of 4096 values. */
+static const uint64_t DENSITIES[] = { 10, 1000, 100000, 500000 };
+
+static void _sink(uint32_t value)
+{
+    bench_sink += value;
+}
+
+static uint64_t _next(uint64_t *state)
+{
+    *state = *state * 6364136223846793005ull + 1442695040888963407ull;
+    return *state >> 20;
+}
+
+static uint32_t *_values(uint64_t count, bool clustered)
+{
+    uint32_t *values = malloc(count * sizeof(uint32_t));
+    uint64_t state = count;
+
+    for (uint64_t i = 0; i < count; i++)
+    {
+        if (clustered)
+        {
+            values[i] = (uint32_t)((i / 4096) * (UNIVERSE / (count / 4096 + 1)) + i % 4096);
+        }
+        else
+        {
+            values[i] = (uint32_t)(_next(&state) % UNIVERSE);
+        }
+    }
+    return values;
+}
+
+static void _bench(const uint32_t *values, uint64_t count, const char *label)
+{
+    char name[64];
+    uint64_t state = 42;
+
+    dats_bitset_t bt = dats_bitset_new(UNIVERSE);
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < count; i++)
+    {
+        dats_bitset_set(&bt, (uint64_t)values[i] + 1, true);
+    }
+    snprintf(name, sizeof(name), "bitset add %s", label);
+    bench_report(name, count, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < PROBES; i++)
+    {
+        bench_sink += dats_bitset_is_set(&bt, _next(&state) % UNIVERSE + 1);
+    }
+    snprintf(name, sizeof(name), "bitset contains %s", label);
+    bench_report(name, PROBES, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t index = 0; index < UNIVERSE / 64; index++)
+    {
+        for (uint64_t word = dats_bitset_get_word(&bt, index); word != 0; word &= ~(0x8000000000000000ull >> dats_bits_clz64(word)))
+        {
+            bench_sink += index * 64 + dats_bits_clz64(word);
+        }
+    }
+    snprintf(name, sizeof(name), "bitset iterate %s", label);
+    bench_report(name, count, bench_now_ns() - start);
+    printf("%-48s %12lu bytes\n", "bitset memory", (unsigned long)bt.bytes_needed);
+    dats_bitset_free(&bt);
+
+    dats_roaring_bitmap_t rb = dats_roaring_bitmap_new();
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < count; i++)
+    {
+        dats_roaring_bitmap_add(&rb, values[i]);
+    }
+    dats_roaring_bitmap_run_optimize(&rb);
+    snprintf(name, sizeof(name), "roaring add+run_optimize %s", label);
+    bench_report(name, count, bench_now_ns() - start);
+
+    state = 42;
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < PROBES; i++)
+    {
+        bench_sink += dats_roaring_bitmap_contains(&rb, (uint32_t)(_next(&state) % UNIVERSE));
+    }
+    snprintf(name, sizeof(name), "roaring contains %s", label);
+    bench_report(name, PROBES, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    dats_roaring_bitmap_map(&rb, _sink);
+    snprintf(name, sizeof(name), "roaring iterate %s", label);
+    bench_report(name, count, bench_now_ns() - start);
+
+    dats_roaring_bitmap_t other = dats_roaring_bitmap_or(&rb, &rb);
+    start = bench_now_ns();
+    dats_roaring_bitmap_t result = dats_roaring_bitmap_and(&rb, &other);
+    snprintf(name, sizeof(name), "roaring and %s", label);
+    bench_report(name, count, bench_now_ns() - start);
+    printf("%-48s %12lu bytes\n", "roaring memory", (unsigned long)dats_roaring_bitmap_memory_usage(&rb));
+
+    dats_roaring_bitmap_free(&result);
+    dats_roaring_bitmap_free(&other);
+    dats_roaring_bitmap_free(&rb);
+}
+
+int main(void)
+{
+    char label[32];
+
+    for (uint64_t i = 0; i < sizeof(DENSITIES) / sizeof(DENSITIES[0]); i++)
+    {
+        uint64_t count = UNIVERSE * DENSITIES[i] / 1000000;
+        uint32_t *values = _values(count, false);
+        snprintf(label, sizeof(label), "random %lu ppm", (unsigned long)DENSITIES[i]);
+        _bench(values, count, label);
+        free(values);
+    }
+
+    uint64_t count = UNIVERSE / 10;
+    uint32_t *values = _values(count, true);
+    _bench(values, count, "clustered 10%");
+    free(values);
+    return 0;
+}
@@ -0,0 +1,88 @@
+#include "bench.h"
+
+#include <stdatomic.h>
+
+#include "dats.h"
+
+#define ARRAY_LENGTH 1000000
+#define TREE_SIZE 200000
+#define GRAIN 2048
+
+static const uint64_t WORKERS[] = { 1, 2, 4 };
+
+static _Atomic uint64_t _total;
+
+/* A few dozen cycles of work per data so the scheduling cost is visible but not everything. */
+static void _work(const void *data)
+{
+    uint64_t x = *(const uint64_t *)data;
+    for (int i = 0; i < 16; i++)
+    {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+    }
+    if (x == 0)
+    {
+        atomic_fetch_add_explicit(&_total, 1, memory_order_relaxed);
+    }
+}
+
+static int64_t _compare(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+int main(void)
+{
+    char name[64];
+    dats_dynamic_array_t da = dats_dynamic_array_new(ARRAY_LENGTH, sizeof(uint64_t));
+    for (uint64_t i = 1; i <= ARRAY_LENGTH; i++)
+    {
+        dats_dynamic_array_add(&da, &i);
+    }
+
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare);
+    uint64_t state = 1;
+    for (uint64_t i = 0; i < TREE_SIZE; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t data = state >> 20;
+        if (!dats_binary_search_tree_contains(&bst, &data))
+        {
+            dats_binary_search_tree_insert(&bst, &data);
+        }
+    }
+
+    uint64_t start = bench_now_ns();
+    dats_dynamic_array_map(&da, _work);
+    bench_report("dats_dynamic_array_map sequential", ARRAY_LENGTH, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    dats_binary_search_tree_traverse(&bst, DATS_BINARY_SEARCH_TREE_PRE_ORDER, _work);
+    bench_report("dats_binary_search_tree_traverse sequential", bst.length, bench_now_ns() - start);
+
+    for (uint64_t i = 0; i < sizeof(WORKERS) / sizeof(WORKERS[0]); i++)
+    {
+        dats_scheduler_t s = dats_scheduler_new(WORKERS[i]);
+
+        start = bench_now_ns();
+        dats_scheduler_parallel_map_dynamic_array(&s, &da, _work, GRAIN);
+        snprintf(name, sizeof(name), "parallel map %lu workers", (unsigned long)WORKERS[i]);
+        bench_report(name, ARRAY_LENGTH, bench_now_ns() - start);
+
+        start = bench_now_ns();
+        dats_scheduler_parallel_traverse_binary_search_tree(&s, &bst, _work);
+        snprintf(name, sizeof(name), "parallel tree traverse %lu workers", (unsigned long)WORKERS[i]);
+        bench_report(name, bst.length, bench_now_ns() - start);
+
+        dats_scheduler_free(&s);
+    }
+
+    bench_sink = atomic_load(&_total);
+    dats_binary_search_tree_free(&bst);
+    dats_dynamic_array_free(&da);
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include "bench.h"
+
+#include <pthread.h>
+#include <sched.h>
+
+#include "dats.h"
+
+#define ITEMS 2000000
+#define ROUND_TRIPS 100000
+#define CAPACITY 1024
+
+static const uint64_t BATCH_SIZES[] = { 1, 8, 64 };
+
+typedef struct
+{
+    dats_spsc_queue_t *q;
+    dats_spsc_queue_t *reply;
+    uint64_t batch;
+} _bench_args;
+
+static void *_producer(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t items[64];
+
+    for (uint64_t i = 0; i < ITEMS; i += args->batch)
+    {
+        for (uint64_t j = 0; j < args->batch; j++)
+        {
+            items[j] = i + j;
+        }
+
+        uint64_t sent = 0;
+        while (sent < args->batch)
+        {
+            uint64_t enqueued = dats_spsc_queue_try_enqueue_n(args->q, &items[sent], args->batch - sent);
+            if (enqueued == 0)
+            {
+                sched_yield();
+            }
+            sent += enqueued;
+        }
+    }
+    return NULL;
+}
+
+static void _bench_throughput(uint64_t batch)
+{
+    char name[64];
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(uint64_t), CAPACITY);
+    _bench_args args = { &q, NULL, batch };
+    pthread_t thread;
+
+    uint64_t start = bench_now_ns();
+    pthread_create(&thread, NULL, _producer, &args);
+
+    uint64_t received = 0;
+    uint64_t out[64];
+    while (received < ITEMS)
+    {
+        uint64_t dequeued = dats_spsc_queue_try_dequeue_n(&q, out, batch);
+        if (dequeued == 0)
+        {
+            sched_yield();
+        }
+        for (uint64_t i = 0; i < dequeued; i++)
+        {
+            bench_sink += out[i];
+        }
+        received += dequeued;
+    }
+    pthread_join(thread, NULL);
+
+    snprintf(name, sizeof(name), "spsc two threads batch %lu", (unsigned long)batch);
+    bench_report(name, ITEMS, bench_now_ns() - start);
+
+    dats_spsc_queue_free(&q);
+}
+
+static void *_echo(void *arg)
+{
+    _bench_args *args = arg;
+    uint64_t data;
+
+    for (uint64_t i = 0; i < ROUND_TRIPS; i++)
+    {
+        while (!dats_spsc_queue_try_dequeue(args->q, &data))
+        {
+            sched_yield();
+        }
+        while (!dats_spsc_queue_try_enqueue(args->reply, &data))
+        {
+            sched_yield();
+        }
+    }
+    return NULL;
+}
+
+static void _bench_round_trip(void)
+{
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(uint64_t), 2);
+    dats_spsc_queue_t reply = dats_spsc_queue_new(sizeof(uint64_t), 2);
+    _bench_args args = { &q, &reply, 1 };
+    pthread_t thread;
+
+    pthread_create(&thread, NULL, _echo, &args);
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < ROUND_TRIPS; i++)
+    {
+        uint64_t data = i;
+        while (!dats_spsc_queue_try_enqueue(&q, &data))
+        {
+            sched_yield();
+        }
+        while (!dats_spsc_queue_try_dequeue(&reply, &data))
+        {
+            sched_yield();
+        }
+        bench_sink += data;
+    }
+    bench_report("spsc round trip latency", ROUND_TRIPS, bench_now_ns() - start);
+
+    pthread_join(thread, NULL);
+    dats_spsc_queue_free(&q);
+    dats_spsc_queue_free(&reply);
+}
+
+int main(void)
+{
+    for (uint64_t i = 0; i < sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]); i++)
+    {
+        _bench_throughput(BATCH_SIZES[i]);
+    }
+    _bench_round_trip();
+    return 0;
+}
@@ -0,0 +1,97 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+#define ELEMENTS 262144
+
+static const uint64_t BATCH_SIZES[] = { 1, 4, 16, 64, 256, 1024, 4096 };
+
+static void _bench_stack(const uint64_t *items, uint64_t *out, uint64_t batch)
+{
+    char name[64];
+    dats_stack_t s = dats_stack_new(sizeof(uint64_t));
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < ELEMENTS; i += batch)
+    {
+        for (uint64_t j = 0; j < batch; j++)
+        {
+            dats_stack_push(&s, &items[j]);
+        }
+        for (uint64_t j = 0; j < batch; j++)
+        {
+            dats_stack_pop_into(&s, &out[j]);
+        }
+        bench_sink += out[0];
+    }
+    snprintf(name, sizeof(name), "stack push+pop_into batch %lu", (unsigned long)batch);
+    bench_report(name, ELEMENTS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < ELEMENTS; i += batch)
+    {
+        dats_stack_push_n(&s, items, batch);
+        dats_stack_pop_n(&s, out, batch);
+        bench_sink += out[0];
+    }
+    snprintf(name, sizeof(name), "stack push_n+pop_n batch %lu", (unsigned long)batch);
+    bench_report(name, ELEMENTS, bench_now_ns() - start);
+
+    dats_stack_free(&s);
+}
+
+static void _bench_queue(const uint64_t *items, uint64_t *out, uint64_t batch)
+{
+    char name[64];
+    dats_queue_t q = dats_queue_new(sizeof(uint64_t));
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < ELEMENTS; i += batch)
+    {
+        for (uint64_t j = 0; j < batch; j++)
+        {
+            dats_queue_enqueue(&q, &items[j]);
+        }
+        for (uint64_t j = 0; j < batch; j++)
+        {
+            dats_queue_dequeue_into(&q, &out[j]);
+        }
+        bench_sink += out[0];
+    }
+    snprintf(name, sizeof(name), "queue enqueue+dequeue_into batch %lu", (unsigned long)batch);
+    bench_report(name, ELEMENTS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < ELEMENTS; i += batch)
+    {
+        dats_queue_enqueue_n(&q, items, batch);
+        dats_queue_dequeue_n(&q, out, batch);
+        bench_sink += out[0];
+    }
+    snprintf(name, sizeof(name), "queue enqueue_n+dequeue_n batch %lu", (unsigned long)batch);
+    bench_report(name, ELEMENTS, bench_now_ns() - start);
+
+    dats_queue_free(&q);
+}
+
+int main(void)
+{
+    uint64_t *items = malloc(4096 * sizeof(uint64_t));
+    uint64_t *out = malloc(4096 * sizeof(uint64_t));
+    for (uint64_t i = 0; i < 4096; i++)
+    {
+        items[i] = i;
+    }
+
+    for (uint64_t i = 0; i < sizeof(BATCH_SIZES) / sizeof(BATCH_SIZES[0]); i++)
+    {
+        _bench_stack(items, out, BATCH_SIZES[i]);
+        _bench_queue(items, out, BATCH_SIZES[i]);
+    }
+
+    free(items);
+    free(out);
+    return 0;
+}
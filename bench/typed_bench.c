@@ -0,0 +1,155 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+#define N 1000000
+#define LOOKUPS 2000
+
+static int64_t _compare_generic(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static inline int64_t _compare_typed(const uint64_t *a, const uint64_t *b)
+{
+    return (*a > *b) - (*a < *b);
+}
+
+DATS_DEFINE_DYNAMIC_ARRAY(u64_array, uint64_t)
+DATS_DEFINE_QUEUE(u64_queue, uint64_t)
+DATS_DEFINE_BST(u64_bst, uint64_t, _compare_typed)
+
+static uint64_t _shuffled(uint64_t i)
+{
+    return (i * 0x9E3779B97F4A7C15ull) >> 20;
+}
+
+static void _bench_dynamic_array(void)
+{
+    uint64_t start = bench_now_ns();
+    dats_dynamic_array_t da = dats_dynamic_array_new(16, sizeof(uint64_t));
+    for (uint64_t i = 0; i < N; i++)
+    {
+        dats_dynamic_array_add(&da, &i);
+    }
+    uint64_t sum = 0;
+    for (uint64_t i = 0; i < N; i++)
+    {
+        sum += *(const uint64_t *)dats_dynamic_array_get(&da, i);
+    }
+    bench_sink = sum;
+    bench_report("dynamic_array generic add+get", 2 * N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    u64_array_t ta = u64_array_new(16);
+    for (uint64_t i = 0; i < N; i++)
+    {
+        u64_array_add(&ta, i);
+    }
+    sum = 0;
+    for (uint64_t i = 0; i < N; i++)
+    {
+        sum += *u64_array_get(&ta, i);
+    }
+    bench_sink = sum;
+    bench_report("dynamic_array typed add+get", 2 * N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t missing = N + i;
+        bench_sink += dats_dynamic_array_contains(&da, &missing);
+    }
+    bench_report("dynamic_array generic contains (miss)", LOOKUPS * (uint64_t)N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < LOOKUPS; i++)
+    {
+        uint64_t missing = N + i;
+        bench_sink += u64_array_contains(&ta, &missing);
+    }
+    bench_report("dynamic_array typed contains (miss)", LOOKUPS * (uint64_t)N, bench_now_ns() - start);
+
+    dats_dynamic_array_free(&da);
+    u64_array_free(&ta);
+}
+
+static void _bench_queue(void)
+{
+    uint64_t start = bench_now_ns();
+    dats_queue_t q = dats_queue_new(sizeof(uint64_t));
+    for (uint64_t round = 0; round < N / 64; round++)
+    {
+        for (uint64_t i = 0; i < 64; i++)
+        {
+            dats_queue_enqueue(&q, &i);
+        }
+        for (uint64_t i = 0; i < 64; i++)
+        {
+            uint64_t *data = dats_queue_dequeue(&q);
+            bench_sink += *data;
+            free(data);
+        }
+    }
+    bench_report("queue generic enqueue+dequeue (64 deep)", 2 * N, bench_now_ns() - start);
+    dats_queue_free(&q);
+
+    start = bench_now_ns();
+    u64_queue_t tq = u64_queue_new();
+    for (uint64_t round = 0; round < N / 64; round++)
+    {
+        for (uint64_t i = 0; i < 64; i++)
+        {
+            u64_queue_enqueue(&tq, i);
+        }
+        for (uint64_t i = 0; i < 64; i++)
+        {
+            bench_sink += u64_queue_dequeue(&tq);
+        }
+    }
+    bench_report("queue typed enqueue+dequeue (64 deep)", 2 * N, bench_now_ns() - start);
+    u64_queue_free(&tq);
+}
+
+static void _bench_binary_search_tree(void)
+{
+    uint64_t start = bench_now_ns();
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare_generic);
+    for (uint64_t i = 0; i < N; i++)
+    {
+        uint64_t data = _shuffled(i) * 2;
+        if (!dats_binary_search_tree_contains(&bst, &data))
+        {
+            dats_binary_search_tree_insert(&bst, &data);
+        }
+    }
+    bench_report("bst generic contains+insert", 2 * N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    u64_bst_t tbst = u64_bst_new();
+    for (uint64_t i = 0; i < N; i++)
+    {
+        uint64_t data = _shuffled(i) * 2;
+        if (!u64_bst_contains(&tbst, &data))
+        {
+            u64_bst_insert(&tbst, data);
+        }
+    }
+    bench_report("bst typed contains+insert", 2 * N, bench_now_ns() - start);
+
+    /* Both trees are freed at the end so neither one is built on the scattered chunks left by the other. */
+    dats_binary_search_tree_free(&bst);
+    u64_bst_free(&tbst);
+}
+
+int main(void)
+{
+    _bench_dynamic_array();
+    _bench_queue();
+    _bench_binary_search_tree();
+    return 0;
+}
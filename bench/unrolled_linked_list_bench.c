@@ -0,0 +1,93 @@
+#include "bench.h"
+
+#include <stdlib.h>
+
+#include "dats.h"
+
+#define N 1000000
+#define MAP_ROUNDS 20
+#define MIDDLE_INSERTS 20000
+
+static uint64_t _map_sum;
+
+static void _sum(const void *data)
+{
+    _map_sum += *(const uint64_t *)data;
+}
+
+static void _bench_map(void)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(uint64_t));
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new(sizeof(uint64_t));
+    dats_dynamic_array_t da = dats_dynamic_array_new(16, sizeof(uint64_t));
+
+    for (uint64_t i = 0; i < N; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+        dats_unrolled_linked_list_insert_tail(&ull, &i);
+        dats_dynamic_array_add(&da, &i);
+    }
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t round = 0; round < MAP_ROUNDS; round++)
+    {
+        dats_linked_list_map(&ll, _sum);
+    }
+    bench_report("linked_list map", MAP_ROUNDS * (uint64_t)N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t round = 0; round < MAP_ROUNDS; round++)
+    {
+        dats_unrolled_linked_list_map(&ull, _sum);
+    }
+    bench_report("unrolled_linked_list map", MAP_ROUNDS * (uint64_t)N, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t round = 0; round < MAP_ROUNDS; round++)
+    {
+        dats_dynamic_array_map(&da, _sum);
+    }
+    bench_report("dynamic_array map", MAP_ROUNDS * (uint64_t)N, bench_now_ns() - start);
+    bench_sink = _map_sum;
+
+    dats_linked_list_free(&ll);
+    dats_unrolled_linked_list_free(&ull);
+    dats_dynamic_array_free(&da);
+}
+
+static void _bench_middle_insert(void)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(uint64_t));
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new(sizeof(uint64_t));
+
+    uint64_t start = bench_now_ns();
+    for (uint64_t i = 0; i < MIDDLE_INSERTS; i++)
+    {
+        dats_linked_list_insert_index(&ll, dats_linked_list_length(&ll) / 2, &i);
+    }
+    bench_report("linked_list insert_index middle", MIDDLE_INSERTS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < MIDDLE_INSERTS; i++)
+    {
+        dats_unrolled_linked_list_insert_index(&ull, dats_unrolled_linked_list_length(&ull) / 2, &i);
+    }
+    bench_report("unrolled_linked_list insert_index middle", MIDDLE_INSERTS, bench_now_ns() - start);
+
+    start = bench_now_ns();
+    for (uint64_t i = 0; i < MIDDLE_INSERTS; i++)
+    {
+        dats_unrolled_linked_list_remove_index(&ull, dats_unrolled_linked_list_length(&ull) / 2, NULL);
+    }
+    bench_report("unrolled_linked_list remove_index middle", MIDDLE_INSERTS, bench_now_ns() - start);
+
+    dats_linked_list_free(&ll);
+    dats_unrolled_linked_list_free(&ull);
+}
+
+int main(void)
+{
+    _bench_map();
+    _bench_middle_insert();
+    return 0;
+}
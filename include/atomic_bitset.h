@@ -0,0 +1,72 @@
+#ifndef ATOMIC_BITSET_H
+#define ATOMIC_BITSET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bitset.h"
+
+/*
+ * Atomic variants of the bitset functions, working on the 64 bits word holding the bit with C11 atomics so threads
+ * updating neighbouring bits don't lose each other's writes. A bitset shared between threads must only be updated with
+ * these functions while they run, dats_bitset_set rewrites a whole byte without synchronization.
+ */
+
+/**
+ * @brief Set a bit to 1 and tell if it was already set, atomically. Can be called by any thread.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param position Place in the bitset of the bit that will be set. Starting from 1.
+ * @return true The bit was already set by someone else.
+ * @return false The bit was 0, this call set it.
+ */
+bool dats_atomic_bitset_test_and_set(dats_bitset_t *self, uint64_t position);
+
+/**
+ * @brief Set a bit to 1 atomically. Can be called by any thread.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param position Place in the bitset of the bit that will be set. Starting from 1.
+ */
+void dats_atomic_bitset_set(dats_bitset_t *self, uint64_t position);
+
+/**
+ * @brief Set a bit to 0 atomically. Can be called by any thread.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param position Place in the bitset of the bit that will be cleared. Starting from 1.
+ */
+void dats_atomic_bitset_clear(dats_bitset_t *self, uint64_t position);
+
+/**
+ * @brief Test a bit with an atomic load. Can be called by any thread.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param position Place in the bitset of the bit that will be tested. Starting from 1.
+ * @return true Bit is set.
+ * @return false Bit isn't set.
+ */
+bool dats_atomic_bitset_is_set(const dats_bitset_t *self, uint64_t position);
+
+/**
+ * @brief Set 64 bits at once atomically, with the layout of dats_bitset_get_word. Can be called by any thread.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param index Index of the word, it must be lower than (size + 63) / 64.
+ * @param word The bits that will be set, the bits past the size of the bitset are ignored.
+ * @return uint64_t The word as it was just before.
+ */
+uint64_t dats_atomic_bitset_fetch_or_word(dats_bitset_t *self, uint64_t index, uint64_t word);
+
+/**
+ * @brief Find the first bit at 0 at the given position or after it and set it, atomically. Can be called by any thread.
+ *
+ * @details Each position is claimed by exactly one caller, so the threads can use it to share out free slots. A bit claimed by another thread during the search is skipped.
+ *
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param position Place where the search starts, included. Starting from 1.
+ * @return uint64_t Position of the claimed bit, or 0 if every bit from position is already set.
+ */
+uint64_t dats_atomic_bitset_claim_first_free(dats_bitset_t *self, uint64_t position);
+
+#endif
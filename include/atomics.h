@@ -0,0 +1,23 @@
+#ifndef ATOMICS_H
+#define ATOMICS_H
+
+/**
+ * @brief Size in bytes of a cache line. Data written by different threads are kept this far apart to avoid false sharing.
+ */
+#define DATS_CACHE_LINE_SIZE 64
+
+/*
+ * The concurrent data structures are implemented with C11 atomics. Their headers can also be included from C++
+ * (inside extern "C"), where _Atomic doesn't exist: there the fields keep the same size and alignment but must only
+ * be touched through the dats functions.
+ */
+#ifdef __cplusplus
+#define DATS_ATOMIC(T) T
+#define DATS_CACHE_ALIGNED alignas(DATS_CACHE_LINE_SIZE)
+#else
+#include <stdatomic.h>
+#define DATS_ATOMIC(T) _Atomic(T)
+#define DATS_CACHE_ALIGNED _Alignas(DATS_CACHE_LINE_SIZE)
+#endif
+
+#endif
@@ -0,0 +1,183 @@
+#ifndef BITS_H
+#define BITS_H
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+ * Bit counting on 64 bits words used by the bitset based data structures. GCC and Clang turn the builtins into single
+ * instructions when the target has them, other compilers get the portable loops.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+
+/**
+ * @brief Number of leading zero bits of word, which must not be 0.
+ */
+static inline uint64_t dats_bits_clz64(uint64_t word)
+{
+    return (uint64_t)__builtin_clzll(word);
+}
+
+/**
+ * @brief Number of trailing zero bits of word, which must not be 0.
+ */
+static inline uint64_t dats_bits_ctz64(uint64_t word)
+{
+    return (uint64_t)__builtin_ctzll(word);
+}
+
+/**
+ * @brief Number of bits set in word.
+ */
+static inline uint64_t dats_bits_popcount64(uint64_t word)
+{
+    return (uint64_t)__builtin_popcountll(word);
+}
+
+/**
+ * @brief Reverse the order of the 8 bytes of word.
+ */
+static inline uint64_t dats_bits_bswap64(uint64_t word)
+{
+    return __builtin_bswap64(word);
+}
+
+#else
+
+static inline uint64_t dats_bits_clz64(uint64_t word)
+{
+    uint64_t count = 0;
+    while ((word & 0x8000000000000000ull) == 0)
+    {
+        word <<= 1;
+        count++;
+    }
+    return count;
+}
+
+static inline uint64_t dats_bits_ctz64(uint64_t word)
+{
+    uint64_t count = 0;
+    while ((word & 1) == 0)
+    {
+        word >>= 1;
+        count++;
+    }
+    return count;
+}
+
+static inline uint64_t dats_bits_popcount64(uint64_t word)
+{
+    word = word - ((word >> 1) & 0x5555555555555555ull);
+    word = (word & 0x3333333333333333ull) + ((word >> 2) & 0x3333333333333333ull);
+    word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0full;
+    return (word * 0x0101010101010101ull) >> 56;
+}
+
+static inline uint64_t dats_bits_bswap64(uint64_t word)
+{
+    uint64_t swapped = 0;
+    for (uint64_t i = 0; i < 8; i++)
+    {
+        swapped = (swapped << 8) | (word & 0xff);
+        word >>= 8;
+    }
+    return swapped;
+}
+
+#endif
+
+/**
+ * @brief Smallest power of two greater than or equal to value, 1 for 0. The value must not be above 2^63.
+ */
+static inline uint64_t dats_bits_next_power_of_two(uint64_t value)
+{
+    assert(value <= 0x8000000000000000ull);
+
+    return value <= 1 ? 1 : 1ull << (64 - dats_bits_clz64(value - 1));
+}
+
+/**
+ * @brief Whether the machine stores the least significant byte of a word first.
+ *
+ * @details GCC and Clang give the answer at compile time, other compilers get a check the optimiser folds.
+ */
+static inline bool dats_bits_is_little_endian(void)
+{
+#if defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__)
+    return __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__;
+#else
+    const uint16_t one = 1;
+    return *(const uint8_t *)&one == 1;
+#endif
+}
+
+/**
+ * @brief Read 8 bytes stored least significant first, at any address, whatever the machine.
+ */
+static inline uint64_t dats_bits_load_le64(const void *bytes)
+{
+    uint64_t word;
+
+    memcpy(&word, bytes, sizeof(uint64_t));
+    return dats_bits_is_little_endian() ? word : dats_bits_bswap64(word);
+}
+
+/**
+ * @brief Read 4 bytes stored least significant first, at any address, whatever the machine.
+ */
+static inline uint64_t dats_bits_load_le32(const void *bytes)
+{
+    uint32_t word;
+
+    memcpy(&word, bytes, sizeof(uint32_t));
+    return dats_bits_is_little_endian() ? word : dats_bits_bswap64(word) >> 32;
+}
+
+/**
+ * @brief Write word as 8 bytes least significant first, at any address, whatever the machine.
+ */
+static inline void dats_bits_store_le64(void *bytes, uint64_t word)
+{
+    word = dats_bits_is_little_endian() ? word : dats_bits_bswap64(word);
+    memcpy(bytes, &word, sizeof(uint64_t));
+}
+
+/**
+ * @brief Read 8 bytes stored most significant first, at any address, whatever the machine.
+ */
+static inline uint64_t dats_bits_load_be64(const void *bytes)
+{
+    uint64_t word;
+
+    memcpy(&word, bytes, sizeof(uint64_t));
+    return dats_bits_is_little_endian() ? dats_bits_bswap64(word) : word;
+}
+
+/**
+ * @brief Write word as 8 bytes most significant first, at any address, whatever the machine.
+ */
+static inline void dats_bits_store_be64(void *bytes, uint64_t word)
+{
+    word = dats_bits_is_little_endian() ? dats_bits_bswap64(word) : word;
+    memcpy(bytes, &word, sizeof(uint64_t));
+}
+
+/**
+ * @brief Mask of the bits of the 64 bits word index that are inside a bitset of size bits, the first bit being the
+ * most significant one. It's all ones except for the last partial word.
+ */
+static inline uint64_t dats_bits_valid_mask(uint64_t size, uint64_t index)
+{
+    uint64_t valid_bits = size - index * 64;
+
+    if (valid_bits >= 64)
+    {
+        return UINT64_MAX;
+    }
+    return ~(UINT64_MAX >> valid_bits);
+}
+
+#endif
@@ -28,6 +28,45 @@ dats_bitset_t dats_bitset_new(uint64_t size);
  */
 void dats_bitset_set(dats_bitset_t *self, uint64_t position, bool state);
 
+/**
+ * @brief Change the number of bits of the bitset. The bits kept keep their state and the new bits are set to 0.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param size The new total length of the bitset.
+ */
+void dats_bitset_resize(dats_bitset_t *self, uint64_t size);
+
+/**
+ * @brief Set to 1 all the bits from first to last, both included.
+ * 
+ * @details The bytes on both ends are updated with a mask and the bytes between them with a single memset.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param first Place of the first bit of the range. Starting from 1.
+ * @param last Place of the last bit of the range, not before first and not after the size.
+ */
+void dats_bitset_set_range(dats_bitset_t *self, uint64_t first, uint64_t last);
+
+/**
+ * @brief Set to 0 all the bits from first to last, both included.
+ * 
+ * @details The bytes on both ends are updated with a mask and the bytes between them with a single memset.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param first Place of the first bit of the range. Starting from 1.
+ * @param last Place of the last bit of the range, not before first and not after the size.
+ */
+void dats_bitset_clear_range(dats_bitset_t *self, uint64_t first, uint64_t last);
+
+/**
+ * @brief Inverse the state of all the bits from first to last, both included.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param first Place of the first bit of the range. Starting from 1.
+ * @param last Place of the last bit of the range, not before first and not after the size.
+ */
+void dats_bitset_flip_range(dats_bitset_t *self, uint64_t first, uint64_t last);
+
 /**
  * @brief Inverse all the bit state in the bitset.
  * 
@@ -55,6 +94,55 @@ bool dats_bitset_is_set(const dats_bitset_t *self, uint64_t position);
  */
 bool dats_bitset_is_set_bitset(const dats_bitset_t *self, const dats_bitset_t *other);
 
+/**
+ * @brief Test if all the bits are set. It reads 64 bits at a time and stops at the first word with a bit at 0.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @return true Every bit is set.
+ * @return false At least one bit isn't set.
+ */
+bool dats_bitset_all(const dats_bitset_t *self);
+
+/**
+ * @brief Test if at least one bit is set. It reads 64 bits at a time and stops at the first word with a bit at 1.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @return true At least one bit is set.
+ * @return false No bit is set.
+ */
+bool dats_bitset_any(const dats_bitset_t *self);
+
+/**
+ * @brief Test if no bit is set. It reads 64 bits at a time and stops at the first word with a bit at 1.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @return true No bit is set.
+ * @return false At least one bit is set.
+ */
+bool dats_bitset_none(const dats_bitset_t *self);
+
+/**
+ * @brief Read 64 bits at once. The word index starts from 0 and covers the positions index * 64 + 1 to index * 64 + 64.
+ * 
+ * @details The first position of the word is its most significant bit, like in the buffer. Positions past the size of the bitset read as 0.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param index Index of the word, it must be lower than (size + 63) / 64.
+ * @return uint64_t The 64 bits of the word.
+ */
+uint64_t dats_bitset_get_word(const dats_bitset_t *self, uint64_t index);
+
+/**
+ * @brief Write 64 bits at once, with the same layout as dats_bitset_get_word.
+ * 
+ * @details Bits written past the size of the bitset are dropped.
+ * 
+ * @param self Pointer to the existing bitset to perform the function.
+ * @param index Index of the word, it must be lower than (size + 63) / 64.
+ * @param word The 64 bits that will replace the word.
+ */
+void dats_bitset_set_word(dats_bitset_t *self, uint64_t index, uint64_t word);
+
 /**
  * @brief Set to 0 all the bit in the bitset and can still be use after this.
  * 
@@ -0,0 +1,120 @@
+#ifndef BLOCKING_QUEUE_H
+#define BLOCKING_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "queue.h"
+
+/**
+ * @brief Result of the functions that may wait for a data.
+ */
+typedef enum
+{
+    DATS_BLOCKING_QUEUE_OK,
+    DATS_BLOCKING_QUEUE_TIMEOUT,
+    DATS_BLOCKING_QUEUE_CLOSED
+} dats_blocking_queue_status_t;
+
+typedef struct _dats_blocking_queue_sync_t dats_blocking_queue_sync_t;
+
+/**
+ * @brief Thread safe queue where consumers sleep until a data is enqueued or the queue is closed.
+ *
+ * It's a dats_queue_t protected by a mutex, the consumers wait on a condition variable so an idle consumer doesn't use
+ * the CPU. The producers only signal when a consumer is really waiting. The mutex and the condition variable are heap
+ * allocated, they are initialized in place and never copied, so the blocking queue can be returned by value.
+ */
+typedef struct
+{
+    dats_queue_t queue;
+    dats_blocking_queue_sync_t *sync;
+    uint64_t waiting;
+    bool closed;
+} dats_blocking_queue_t;
+
+/**
+ * @brief Create and initialize a blocking queue. You must use this function to create a blocking queue.
+ *
+ * @details The timed waits use CLOCK_MONOTONIC. The queue must not be copied once a thread used it.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @return dats_blocking_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_blocking_queue_t dats_blocking_queue_new(uint64_t data_size);
+
+/**
+ * @brief Add a copy of data at the end of the queue and wake up one waiting consumer.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @param data Pointer to the data that will be copied into the queue.
+ * @return true The data has been enqueued.
+ * @return false The queue is closed, nothing has been done.
+ */
+bool dats_blocking_queue_enqueue(dats_blocking_queue_t *self, const void *data);
+
+/**
+ * @brief Add a copy of count contiguous data with a single lock and wake up every waiting consumer at once.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes.
+ * @param count Number of data to enqueue.
+ * @return true The data have been enqueued.
+ * @return false The queue is closed, nothing has been done.
+ */
+bool dats_blocking_queue_enqueue_n(dats_blocking_queue_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Remove the oldest data and copy it into out without waiting.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @return true A data has been copied into out.
+ * @return false The queue is empty.
+ */
+bool dats_blocking_queue_try_dequeue(dats_blocking_queue_t *self, void *out);
+
+/**
+ * @brief Remove the oldest data and copy it into out, sleeping until a data comes.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @return dats_blocking_queue_status_t DATS_BLOCKING_QUEUE_OK when out has been filled, DATS_BLOCKING_QUEUE_CLOSED when the queue is closed and empty.
+ */
+dats_blocking_queue_status_t dats_blocking_queue_dequeue(dats_blocking_queue_t *self, void *out);
+
+/**
+ * @brief Remove the oldest data and copy it into out, sleeping at most timeout_ns nanoseconds until a data comes.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @param timeout_ns Maximum number of nanoseconds to wait.
+ * @return dats_blocking_queue_status_t DATS_BLOCKING_QUEUE_OK when out has been filled, DATS_BLOCKING_QUEUE_TIMEOUT when nothing came in time, DATS_BLOCKING_QUEUE_CLOSED when the queue is closed and empty.
+ */
+dats_blocking_queue_status_t dats_blocking_queue_dequeue_wait(dats_blocking_queue_t *self, void *out, uint64_t timeout_ns);
+
+/**
+ * @brief Close the queue to shut down the consumers. Every waiting consumer is woken up.
+ *
+ * @details The data already enqueued can still be dequeued, then the consumers get DATS_BLOCKING_QUEUE_CLOSED. Enqueuing isn't possible anymore.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ */
+void dats_blocking_queue_close(dats_blocking_queue_t *self);
+
+/**
+ * @brief Get the number of data in the queue. When others threads are working it's only a snapshot.
+ *
+ * @param self Pointer to the existing blocking queue to perform the function.
+ * @return uint64_t Number of data in the queue.
+ */
+uint64_t dats_blocking_queue_length(dats_blocking_queue_t *self);
+
+/**
+ * @brief Free the data left and the queue. No thread must use or wait on the queue anymore.
+ *
+ * @param self The blocking queue that will be freed.
+ */
+void dats_blocking_queue_free(dats_blocking_queue_t *self);
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bitset.h"
+
+/**
+ * @brief Number of bits of a block of the blocked layout, a cache line of 64 bytes.
+ */
+#define DATS_BLOOM_FILTER_BLOCK_BITS 512
+
+/**
+ * @brief Probabilistic set answering "surely absent" or "maybe present" with a fixed memory.
+ *
+ * Each data is hashed once into 64 bits and gives hash_count positions in bits. With the standard layout the positions
+ * are h1 + i * h2 over the whole bitset (double hashing). With the blocked layout the hash first chooses one block of
+ * 512 bits, a cache line, and all the positions are taken inside it: a lookup costs one cache miss instead of
+ * hash_count, for a slightly higher false positive rate.
+ */
+typedef struct
+{
+    dats_bitset_t bits;
+    const uint64_t data_size;
+    const uint64_t hash_count;
+    const uint64_t seed;
+    const bool blocked;
+} dats_bloom_filter_t;
+
+/**
+ * @brief Number of bits needed to hold expected_count data with the given false positive rate, rounded to a whole block.
+ *
+ * @param expected_count Number of data that will be added.
+ * @param false_positive_rate Wanted probability for contains to answer true for an absent data, between 0 and 1 excluded.
+ * @return uint64_t Number of bits.
+ */
+uint64_t dats_bloom_filter_optimal_bits(uint64_t expected_count, double false_positive_rate);
+
+/**
+ * @brief Number of positions by data giving the lowest false positive rate for this size and count.
+ *
+ * @param bits Number of bits of the filter.
+ * @param expected_count Number of data that will be added.
+ * @return uint64_t Number of hashes, at least 1.
+ */
+uint64_t dats_bloom_filter_optimal_hash_count(uint64_t bits, uint64_t expected_count);
+
+/**
+ * @brief Create a bloom filter sized for expected_count data and a false positive rate.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param expected_count Number of data that will be added, at least 1.
+ * @param false_positive_rate Wanted probability for contains to answer true for an absent data, between 0 and 1 excluded.
+ * @param blocked true for the cache line blocked layout, false for the standard one.
+ * @return dats_bloom_filter_t The direct datastructure that you will pass for others functions.
+ */
+dats_bloom_filter_t dats_bloom_filter_new(uint64_t data_size, uint64_t expected_count, double false_positive_rate, bool blocked);
+
+/**
+ * @brief Create a bloom filter with a given number of bits and hashes.
+ *
+ * @details Two filters can be combined with union and intersect only if they have been created with the same parameters and seed.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param bits Number of bits, rounded up to a multiple of DATS_BLOOM_FILTER_BLOCK_BITS.
+ * @param hash_count Number of positions by data, at least 1.
+ * @param seed Seed of the hash.
+ * @param blocked true for the cache line blocked layout, false for the standard one.
+ * @return dats_bloom_filter_t The direct datastructure that you will pass for others functions.
+ */
+dats_bloom_filter_t dats_bloom_filter_new_with_size(uint64_t data_size, uint64_t bits, uint64_t hash_count, uint64_t seed, bool blocked);
+
+/**
+ * @brief Add a data to the bloom filter. Only the hash of the data is kept.
+ *
+ * @param self Pointer to the existing bloom filter to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ */
+void dats_bloom_filter_add(dats_bloom_filter_t *self, const void *data);
+
+/**
+ * @brief Check if a data may have been added.
+ *
+ * @param self Pointer to the existing bloom filter to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @return true The data may have been added, or it's a false positive.
+ * @return false The data has never been added.
+ */
+bool dats_bloom_filter_contains(const dats_bloom_filter_t *self, const void *data);
+
+/**
+ * @brief Make self the filter of the data added to self or to other.
+ *
+ * @param self Pointer to the existing bloom filter that will receive the result.
+ * @param other Pointer to a bloom filter created with the same parameters.
+ */
+void dats_bloom_filter_union(dats_bloom_filter_t *self, const dats_bloom_filter_t *other);
+
+/**
+ * @brief Make self a filter of the data added to both self and other. Its false positive rate is at least the one of the union.
+ *
+ * @param self Pointer to the existing bloom filter that will receive the result.
+ * @param other Pointer to a bloom filter created with the same parameters.
+ */
+void dats_bloom_filter_intersect(dats_bloom_filter_t *self, const dats_bloom_filter_t *other);
+
+/**
+ * @brief Remove all the data, the bloom filter can be reused directly after this.
+ *
+ * @param self Pointer to the existing bloom filter to perform the function.
+ */
+void dats_bloom_filter_clear(dats_bloom_filter_t *self);
+
+/**
+ * @brief Free the bloom filter and can't be used after this.
+ *
+ * @param self Pointer to the existing bloom filter to perform the function.
+ */
+void dats_bloom_filter_free(dats_bloom_filter_t *self);
+
+#endif
@@ -0,0 +1,74 @@
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomics.h"
+
+/**
+ * @brief Bounded LIFO stack that any number of threads can push and pop at the same time without lock.
+ *
+ * It's a Treiber stack over a pool of capacity nodes allocated once, each holding the data inline. The nodes are
+ * linked by their index and the free nodes are themselves kept in a second Treiber stack. The top of each stack packs
+ * a 32 bits tag with the 32 bits index of the first node, the tag changes at every update so a compare and swap can't
+ * succeed on a top that has been popped and pushed back meanwhile (ABA). The nodes are never freed while the stack
+ * lives, so reading a node that has just been taken by another thread is always safe.
+ */
+typedef struct
+{
+    void *nodes;
+    const uint64_t data_size;
+    const uint64_t node_size;
+    const uint64_t capacity;
+
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) top;
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) free_top;
+} dats_concurrent_stack_t;
+
+/**
+ * @brief Create and initialize a concurrent stack. You must use this function to create a concurrent stack before sharing it between threads.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param capacity Maximum number of data the stack can hold at the same time, lower than UINT32_MAX.
+ * @return dats_concurrent_stack_t The direct datastructure that you will pass for others functions.
+ */
+dats_concurrent_stack_t dats_concurrent_stack_new(uint64_t data_size, uint64_t capacity);
+
+/**
+ * @brief Copy data at the top of the stack if a node is free. Can be called by any thread.
+ *
+ * @param self Pointer to the existing concurrent stack to perform the function.
+ * @param data Pointer to the data that will be copied into the stack.
+ * @return true The data has been pushed.
+ * @return false The stack already holds capacity data, nothing has been done.
+ */
+bool dats_concurrent_stack_try_push(dats_concurrent_stack_t *self, const void *data);
+
+/**
+ * @brief Remove the data at the top of the stack and copy it into out. Can be called by any thread.
+ *
+ * @param self Pointer to the existing concurrent stack to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @return true A data has been copied into out.
+ * @return false The stack is empty, out isn't touched.
+ */
+bool dats_concurrent_stack_try_pop(dats_concurrent_stack_t *self, void *out);
+
+/**
+ * @brief Check if the stack holds no data. When others threads are working it's only a snapshot.
+ *
+ * @param self Pointer to the existing concurrent stack to perform the function.
+ * @return true The stack is empty.
+ * @return false The stack holds at least one data.
+ */
+bool dats_concurrent_stack_is_empty(dats_concurrent_stack_t *self);
+
+/**
+ * @brief Free the nodes of the concurrent stack. No thread must use the stack anymore.
+ *
+ * @param self The concurrent stack that will be freed.
+ */
+void dats_concurrent_stack_free(dats_concurrent_stack_t *self);
+
+#endif
@@ -0,0 +1,93 @@
+#ifndef COUNT_MIN_SKETCH_H
+#define COUNT_MIN_SKETCH_H
+
+#include <stdint.h>
+
+/**
+ * @brief Estimate how many times each data has been added, in a memory fixed at creation.
+ *
+ * The counters are depth rows of width counters. Adding a data increments one counter by row, chosen by a hash of
+ * the data, and the estimate is the smallest of them. The estimate is never below the real count and, with a
+ * probability of at least 1 - delta, above it by at most epsilon * total.
+ */
+typedef struct
+{
+    uint64_t *counters;
+    uint64_t total;
+    const uint64_t width;
+    const uint64_t depth;
+    const uint64_t data_size;
+    const uint64_t seed;
+} dats_count_min_sketch_t;
+
+/**
+ * @brief Create a count-min sketch with the error bounds epsilon and delta.
+ *
+ * @details The width is e / epsilon rounded up to a power of two and the depth ln(1 / delta) rounded up.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param epsilon Maximum overestimation as a part of the total count, between 0 and 1 excluded.
+ * @param delta Probability for an estimate to be above this bound, between 0 and 1 excluded.
+ * @return dats_count_min_sketch_t The direct datastructure that you will pass for others functions.
+ */
+dats_count_min_sketch_t dats_count_min_sketch_new(uint64_t data_size, double epsilon, double delta);
+
+/**
+ * @brief Create a count-min sketch with a given number of counters.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param width Number of counters by row, rounded up to a power of two.
+ * @param depth Number of rows, at least 1.
+ * @return dats_count_min_sketch_t The direct datastructure that you will pass for others functions.
+ */
+dats_count_min_sketch_t dats_count_min_sketch_new_with_size(uint64_t data_size, uint64_t width, uint64_t depth);
+
+/**
+ * @brief Add count occurrences of a data.
+ *
+ * @param self Pointer to the existing count-min sketch to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @param count Number of occurrences to add.
+ */
+void dats_count_min_sketch_add(dats_count_min_sketch_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Estimate the number of occurrences of a data. It's never below the real number.
+ *
+ * @param self Pointer to the existing count-min sketch to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @return uint64_t The estimated number of occurrences.
+ */
+uint64_t dats_count_min_sketch_estimate(const dats_count_min_sketch_t *self, const void *data);
+
+/**
+ * @brief Get back the sum of all the counts added.
+ *
+ * @param self Pointer to the existing count-min sketch to perform the function.
+ * @return uint64_t The total count.
+ */
+uint64_t dats_count_min_sketch_total(const dats_count_min_sketch_t *self);
+
+/**
+ * @brief Make self the sketch of the data added to self and to other, the counts are summed.
+ *
+ * @param self Pointer to the existing count-min sketch that will receive the result.
+ * @param other Pointer to a count-min sketch with the same data_size, width and depth.
+ */
+void dats_count_min_sketch_merge(dats_count_min_sketch_t *self, const dats_count_min_sketch_t *other);
+
+/**
+ * @brief Remove all the counts, the count-min sketch can be reused directly after this.
+ *
+ * @param self Pointer to the existing count-min sketch to perform the function.
+ */
+void dats_count_min_sketch_clear(dats_count_min_sketch_t *self);
+
+/**
+ * @brief Free the count-min sketch and can't be used after this.
+ *
+ * @param self Pointer to the existing count-min sketch to perform the function.
+ */
+void dats_count_min_sketch_free(dats_count_min_sketch_t *self);
+
+#endif
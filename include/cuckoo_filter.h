@@ -0,0 +1,116 @@
+#ifndef CUCKOO_FILTER_H
+#define CUCKOO_FILTER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of fingerprints in a bucket.
+ */
+#define DATS_CUCKOO_FILTER_BUCKET_SIZE 4
+
+/**
+ * @brief Maximum number of fingerprints moved by an insert before the filter is considered full.
+ */
+#define DATS_CUCKOO_FILTER_MAX_KICKS 500
+
+/**
+ * @brief Probabilistic set like a bloom filter that also allows to remove data.
+ *
+ * Each data is kept as a fingerprint of 8, 12 or 16 bits in one of its two candidate buckets of 4 slots. The second bucket
+ * is found from the first one and the fingerprint only (partial key cuckoo hashing), so a fingerprint can be moved
+ * without the data. The 4 slots of a bucket are packed in one word and compared at once.
+ *
+ * When an insert ends its chain of moves without a free slot, the last moved fingerprint is kept in the victim and the
+ * filter refuses the next inserts until a remove gives back room. No data is ever lost.
+ */
+typedef struct
+{
+    void *buckets;
+    uint64_t bucket_count;
+    uint64_t length;
+    uint64_t random_state;
+    uint64_t victim_bucket;
+    uint16_t victim_fingerprint;
+    bool has_victim;
+    const uint64_t data_size;
+    const uint64_t fingerprint_bits;
+    const uint64_t seed;
+} dats_cuckoo_filter_t;
+
+/**
+ * @brief Create a cuckoo filter able to hold at least capacity data.
+ *
+ * @details The number of buckets is a power of two giving a load of at most 95% at capacity. The false positive rate is
+ * about 8 / 2^fingerprint_bits: 3% with 8 bits, 0.2% with 12 bits and 0.01% with 16 bits.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param capacity Number of data that will be added, at least 1.
+ * @param fingerprint_bits Bits kept by data, 8, 12 or 16.
+ * @return dats_cuckoo_filter_t The direct datastructure that you will pass for others functions.
+ */
+dats_cuckoo_filter_t dats_cuckoo_filter_new(uint64_t data_size, uint64_t capacity, uint64_t fingerprint_bits);
+
+/**
+ * @brief Add a data to the cuckoo filter. Adding the same data twice keeps two fingerprints.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @return true The data has been added.
+ * @return false The filter is full, the data hasn't been added.
+ */
+bool dats_cuckoo_filter_insert(dats_cuckoo_filter_t *self, const void *data);
+
+/**
+ * @brief Check if a data may have been added.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @return true The data may have been added, or it's a false positive.
+ * @return false The data isn't in the filter.
+ */
+bool dats_cuckoo_filter_contains(const dats_cuckoo_filter_t *self, const void *data);
+
+/**
+ * @brief Remove one fingerprint of a data.
+ *
+ * @details Only data that have been added must be removed, removing an absent data may remove the fingerprint of another one.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ * @return true A fingerprint of the data has been removed.
+ * @return false No fingerprint of the data was found.
+ */
+bool dats_cuckoo_filter_remove(dats_cuckoo_filter_t *self, const void *data);
+
+/**
+ * @brief Get back the number of data in the cuckoo filter.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ * @return uint64_t Number of fingerprints stored.
+ */
+uint64_t dats_cuckoo_filter_length(const dats_cuckoo_filter_t *self);
+
+/**
+ * @brief Get back the maximum number of fingerprints, the slots of all the buckets.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ * @return uint64_t Number of slots.
+ */
+uint64_t dats_cuckoo_filter_capacity(const dats_cuckoo_filter_t *self);
+
+/**
+ * @brief Remove all the data, the cuckoo filter can be reused directly after this.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ */
+void dats_cuckoo_filter_clear(dats_cuckoo_filter_t *self);
+
+/**
+ * @brief Free the cuckoo filter and can't be used after this.
+ *
+ * @param self Pointer to the existing cuckoo filter to perform the function.
+ */
+void dats_cuckoo_filter_free(dats_cuckoo_filter_t *self);
+
+#endif
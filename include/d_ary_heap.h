@@ -0,0 +1,102 @@
+#ifndef D_ARY_HEAP_H
+#define D_ARY_HEAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of bytes the buffer of a d-ary heap is aligned on, a cache line.
+ */
+#define DATS_D_ARY_HEAP_ALIGNMENT 64
+
+/**
+ * @brief Priority queue implemented as a heap where every node has arity children.
+ *
+ * The children of the data i are the data arity * i + 1 to arity * i + arity, next to each other in memory. The buffer
+ * is aligned on a cache line and starts with arity - 1 unused slots, so each group of siblings begins at a multiple of
+ * arity slots. When arity * data_size is 64, like 8 data of 8 bytes, the children compared at each level of a pop
+ * are exactly one cache line. The heap is also 2 or 3 times shallower than a binary heap with an arity of 4 or 8.
+ * A binary heap (arity 2) is dats_priority_queue_t.
+ */
+typedef struct
+{
+    uint8_t *buffer;
+    uint64_t length;
+    uint64_t capacity;
+    const uint64_t data_size;
+    int64_t (*compare)(const void *a, const void *b);
+    const uint64_t arity;
+    void *scratch;
+} dats_d_ary_heap_t;
+
+/**
+ * @brief Create and initialize an empty d-ary heap.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param arity Number of children by node, at least 2. 4 and 8 are good choices.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]. The smallest data comes out first.
+ * @return dats_d_ary_heap_t The direct datastructure that you will pass for others functions.
+ */
+dats_d_ary_heap_t dats_d_ary_heap_new(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Create a d-ary heap holding a copy of count contiguous data. The heap is built in O(n).
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param arity Number of children by node, at least 2.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]. The smallest data comes out first.
+ * @param data Pointer to count contiguous data of data_size bytes.
+ * @param count Number of data to copy.
+ * @return dats_d_ary_heap_t The direct datastructure that you will pass for others functions.
+ */
+dats_d_ary_heap_t dats_d_ary_heap_from_array(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b), const void *data, uint64_t count);
+
+/**
+ * @brief Add a copy of data in the heap.
+ *
+ * @param self Pointer to the existing d-ary heap to perform the function.
+ * @param data Pointer to the data that will be copied.
+ */
+void dats_d_ary_heap_push(dats_d_ary_heap_t *self, const void *data);
+
+/**
+ * @brief Remove the smallest data for compare and copy it into out.
+ *
+ * @details If the heap is empty the function will throw a assertion.
+ *
+ * @param self Pointer to the existing d-ary heap to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_d_ary_heap_pop_into(dats_d_ary_heap_t *self, void *out);
+
+/**
+ * @brief Get a pointer to the smallest data without removing it. The pointer is only valid until the next push or pop.
+ *
+ * @param self Pointer to the existing d-ary heap to perform the function.
+ * @return const void* Pointer to the data that will be popped next.
+ */
+const void *dats_d_ary_heap_peek(const dats_d_ary_heap_t *self);
+
+/**
+ * @brief Get the number of data in the heap.
+ *
+ * @param self Pointer to the existing d-ary heap to perform the function.
+ * @return uint64_t Number of data in the heap.
+ */
+uint64_t dats_d_ary_heap_length(const dats_d_ary_heap_t *self);
+
+/**
+ * @brief Remove every data but keep the memory so the heap can be reused directly.
+ *
+ * @param self Pointer to the existing d-ary heap to perform the function.
+ */
+void dats_d_ary_heap_clear(dats_d_ary_heap_t *self);
+
+/**
+ * @brief Free the memory used by the d-ary heap.
+ *
+ * @param self The d-ary heap that will be freed.
+ */
+void dats_d_ary_heap_free(dats_d_ary_heap_t *self);
+
+#endif
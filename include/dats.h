@@ -2,13 +2,35 @@
 #define DATS_H
 
 #include "linked_list.h"
+#include "doubly_linked_list.h"
+#include "unrolled_linked_list.h"
 #include "dynamic_array.h"
 #include "binary_search_tree.h"
 
 #include "queue.h"
+#include "priority_queue.h"
+#include "d_ary_heap.h"
+#include "indexed_priority_queue.h"
 #include "stack.h"
+#include "concurrent_stack.h"
+#include "spsc_queue.h"
+#include "mpmc_queue.h"
+#include "blocking_queue.h"
+#include "work_stealing_deque.h"
+#include "scheduler.h"
 #include "dense_array.h"
 #include "bitset.h"
+#include "atomic_bitset.h"
+#include "hibitset.h"
+#include "rank_select.h"
+#include "roaring_bitmap.h"
+#include "bloom_filter.h"
+#include "cuckoo_filter.h"
+#include "hyperloglog.h"
+#include "count_min_sketch.h"
+#include "hash.h"
 #include "dense_array.h"
 
+#include "typed.h"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,1229 @@
+#ifndef DATS_HPP
+#define DATS_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * Header only C++ counterparts of the dats data structures.
+ *
+ * The containers store T directly instead of a copy of data_size bytes behind a void pointer, so they work with
+ * move only types, can construct the data in place with the emplace functions and take the comparator as a template
+ * parameter that the compiler can inline. Every container exposes STL compatible iterators so range-for loops and
+ * <algorithm> can be used instead of the callback map functions.
+ */
+namespace dats
+{
+
+namespace detail
+{
+
+/**
+ * @brief Same as DATS_RAISE_ERROR of the C library, write the error to stderr and exit.
+ */
+#define DATS_HPP_RAISE_ERROR(X) ::dats::detail::raise_error(X, __FILE__, __LINE__)
+
+[[noreturn]] inline void raise_error(const char *message, const char *filename, int line)
+{
+    std::fprintf(stderr, "[ERROR]: %s in file: %s at line: %d.\n", message, filename, line);
+    std::exit(EXIT_FAILURE);
+}
+
+}
+
+/**
+ * @brief Contiguous growing array of T. Same behaviour as dats_dynamic_array_t.
+ */
+template <typename T>
+class DynamicArray
+{
+public:
+    typedef T value_type;
+    typedef T *iterator;
+    typedef const T *const_iterator;
+
+    /**
+     * @brief Create a Dynamic Array with an initial capacity. Nothing is constructed until data is added.
+     *
+     * @param capacity Number of data that can be added before growing.
+     */
+    explicit DynamicArray(uint64_t capacity = 4)
+        : m_buffer(_allocate(capacity > 0 ? capacity : 1)), m_capacity(capacity > 0 ? capacity : 1), m_length(0)
+    {
+    }
+
+    DynamicArray(const DynamicArray &other)
+        : m_buffer(_allocate(other.m_capacity)), m_capacity(other.m_capacity), m_length(0)
+    {
+        for (uint64_t i = 0; i < other.m_length; i++)
+        {
+            add(other.m_buffer[i]);
+        }
+    }
+
+    DynamicArray(DynamicArray &&other) noexcept
+        : m_buffer(other.m_buffer), m_capacity(other.m_capacity), m_length(other.m_length)
+    {
+        other.m_buffer = nullptr;
+        other.m_capacity = 0;
+        other.m_length = 0;
+    }
+
+    DynamicArray &operator=(DynamicArray other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~DynamicArray()
+    {
+        clear();
+        ::operator delete(m_buffer);
+    }
+
+    void swap(DynamicArray &other) noexcept
+    {
+        std::swap(m_buffer, other.m_buffer);
+        std::swap(m_capacity, other.m_capacity);
+        std::swap(m_length, other.m_length);
+    }
+
+    /**
+     * @brief Create a new slot at the end of the Dynamic Array and copy or move the data in it.
+     */
+    void add(const T &data)
+    {
+        emplace(data);
+    }
+
+    void add(T &&data)
+    {
+        emplace(std::move(data));
+    }
+
+    /**
+     * @brief Construct a new data at the end of the Dynamic Array with the given constructor arguments.
+     *
+     * @return T& Reference to the data constructed in place.
+     */
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        if (m_length == m_capacity)
+        {
+            return _grow_and_emplace(std::forward<Args>(args)...);
+        }
+        T *data = ::new (static_cast<void *>(&m_buffer[m_length])) T(std::forward<Args>(args)...);
+        m_length++;
+        return *data;
+    }
+
+    /**
+     * @brief Replace the data at the index position. This does not change the length or the capacity.
+     */
+    void insert(uint64_t index, T data)
+    {
+        assert(index < m_length);
+        m_buffer[index] = std::move(data);
+    }
+
+    /**
+     * @brief Remove the first data equal to the given one and shift every following data to the left.
+     *
+     * @return true The data was found and removed.
+     * @return false The data isn't in the Dynamic Array.
+     */
+    bool remove(const T &data)
+    {
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            if (m_buffer[i] == data)
+            {
+                remove_index(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Remove the data at the index position, shift every following data to the left and give back the removed data.
+     */
+    T remove_index(uint64_t index)
+    {
+        assert(index < m_length);
+
+        T data = std::move(m_buffer[index]);
+        for (uint64_t i = index + 1; i < m_length; i++)
+        {
+            m_buffer[i - 1] = std::move(m_buffer[i]);
+        }
+        m_length--;
+        m_buffer[m_length].~T();
+        return data;
+    }
+
+    /**
+     * @brief Remove the last data and give it back. It's a O(1) operation.
+     */
+    T pop()
+    {
+        assert(m_length > 0);
+
+        m_length--;
+        T data = std::move(m_buffer[m_length]);
+        m_buffer[m_length].~T();
+        return data;
+    }
+
+    const T &get(uint64_t index) const
+    {
+        assert(index < m_length);
+        return m_buffer[index];
+    }
+
+    T &ref(uint64_t index)
+    {
+        assert(index < m_length);
+        return m_buffer[index];
+    }
+
+    const T &operator[](uint64_t index) const
+    {
+        return get(index);
+    }
+
+    T &operator[](uint64_t index)
+    {
+        return ref(index);
+    }
+
+    bool contains(const T &data) const
+    {
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            if (m_buffer[i] == data)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Find the index of the first data equal to the given one.
+     *
+     * @details If the data don't match with any data the program exits and writes the error to stderr, like the C library.
+     */
+    uint64_t find_index(const T &data) const
+    {
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            if (m_buffer[i] == data)
+            {
+                return i;
+            }
+        }
+        DATS_HPP_RAISE_ERROR("Unable to find data");
+    }
+
+    template <typename Func>
+    void map(Func func) const
+    {
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            func(m_buffer[i]);
+        }
+    }
+
+    /**
+     * @brief Make sure the Dynamic Array can hold at least capacity data without growing.
+     */
+    void reserve(uint64_t capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            _grow(capacity);
+        }
+    }
+
+    uint64_t length() const
+    {
+        return m_length;
+    }
+
+    uint64_t capacity() const
+    {
+        return m_capacity;
+    }
+
+    /**
+     * @brief Destroy every data but keep the capacity.
+     */
+    void clear()
+    {
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            m_buffer[i].~T();
+        }
+        m_length = 0;
+    }
+
+    T *data() { return m_buffer; }
+    const T *data() const { return m_buffer; }
+
+    iterator begin() { return m_buffer; }
+    iterator end() { return m_buffer + m_length; }
+    const_iterator begin() const { return m_buffer; }
+    const_iterator end() const { return m_buffer + m_length; }
+    const_iterator cbegin() const { return m_buffer; }
+    const_iterator cend() const { return m_buffer + m_length; }
+
+private:
+    static T *_allocate(uint64_t capacity)
+    {
+        return static_cast<T *>(::operator new(capacity * sizeof(T)));
+    }
+
+    void _grow(uint64_t capacity)
+    {
+        T *buffer = _allocate(capacity);
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            ::new (static_cast<void *>(&buffer[i])) T(std::move_if_noexcept(m_buffer[i]));
+            m_buffer[i].~T();
+        }
+        ::operator delete(m_buffer);
+        m_buffer = buffer;
+        m_capacity = capacity;
+    }
+
+    /* The new data is built before the old ones are moved, args may refer to one of them like in a.add(a[0]). */
+    template <typename... Args>
+    T &_grow_and_emplace(Args &&...args)
+    {
+        uint64_t capacity = m_capacity > 0 ? m_capacity * 2 : 4;
+        T *buffer = _allocate(capacity);
+        T *data;
+
+        try
+        {
+            data = ::new (static_cast<void *>(&buffer[m_length])) T(std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            ::operator delete(buffer);
+            throw;
+        }
+
+        for (uint64_t i = 0; i < m_length; i++)
+        {
+            ::new (static_cast<void *>(&buffer[i])) T(std::move_if_noexcept(m_buffer[i]));
+            m_buffer[i].~T();
+        }
+        ::operator delete(m_buffer);
+        m_buffer = buffer;
+        m_capacity = capacity;
+        m_length++;
+        return *data;
+    }
+
+    T *m_buffer;
+    uint64_t m_capacity;
+    uint64_t m_length;
+};
+
+/**
+ * @brief Singly linked list of T with a head and a tail. Same behaviour as dats_linked_list_t.
+ */
+template <typename T>
+class LinkedList
+{
+private:
+    struct Node
+    {
+        template <typename... Args>
+        explicit Node(Args &&...args)
+            : next_node(nullptr), data(std::forward<Args>(args)...)
+        {
+        }
+
+        Node *next_node;
+        T data;
+    };
+
+    template <bool Const>
+    class Iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef typename std::conditional<Const, const T *, T *>::type pointer;
+        typedef typename std::conditional<Const, const T &, T &>::type reference;
+
+        Iterator() : m_node(nullptr) {}
+        explicit Iterator(Node *node) : m_node(node) {}
+
+        /* Allow iterator to const_iterator conversion. */
+        template <bool OtherConst, typename = typename std::enable_if<Const && !OtherConst>::type>
+        Iterator(const Iterator<OtherConst> &other) : m_node(other.m_node) {}
+
+        reference operator*() const { return m_node->data; }
+        pointer operator->() const { return &m_node->data; }
+
+        Iterator &operator++()
+        {
+            m_node = m_node->next_node;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            m_node = m_node->next_node;
+            return previous;
+        }
+
+        bool operator==(const Iterator &other) const { return m_node == other.m_node; }
+        bool operator!=(const Iterator &other) const { return m_node != other.m_node; }
+
+    private:
+        friend class LinkedList;
+        template <bool> friend class Iterator;
+
+        Node *m_node;
+    };
+
+public:
+    typedef T value_type;
+    typedef Iterator<false> iterator;
+    typedef Iterator<true> const_iterator;
+
+    LinkedList() : m_head(nullptr), m_tail(nullptr), m_length(0) {}
+
+    LinkedList(const LinkedList &other) : m_head(nullptr), m_tail(nullptr), m_length(0)
+    {
+        for (const T &data : other)
+        {
+            insert_tail(data);
+        }
+    }
+
+    LinkedList(LinkedList &&other) noexcept : m_head(other.m_head), m_tail(other.m_tail), m_length(other.m_length)
+    {
+        other.m_head = nullptr;
+        other.m_tail = nullptr;
+        other.m_length = 0;
+    }
+
+    LinkedList &operator=(LinkedList other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~LinkedList()
+    {
+        clear();
+    }
+
+    void swap(LinkedList &other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_tail, other.m_tail);
+        std::swap(m_length, other.m_length);
+    }
+
+    const T &get(uint64_t index) const
+    {
+        assert(index < m_length);
+        return _get_node(index)->data;
+    }
+
+    T &ref(uint64_t index)
+    {
+        assert(index < m_length);
+        return _get_node(index)->data;
+    }
+
+    const T &get_head() const
+    {
+        assert(m_length > 0);
+        return m_head->data;
+    }
+
+    const T &get_tail() const
+    {
+        assert(m_length > 0);
+        return m_tail->data;
+    }
+
+    void insert_head(const T &data) { emplace_head(data); }
+    void insert_head(T &&data) { emplace_head(std::move(data)); }
+    void insert_tail(const T &data) { emplace_tail(data); }
+    void insert_tail(T &&data) { emplace_tail(std::move(data)); }
+
+    /**
+     * @brief Construct a new node data in place at the first position of the Linked List.
+     */
+    template <typename... Args>
+    T &emplace_head(Args &&...args)
+    {
+        Node *node = new Node(std::forward<Args>(args)...);
+        node->next_node = m_head;
+        m_head = node;
+        if (m_tail == nullptr)
+        {
+            m_tail = node;
+        }
+        m_length++;
+        return node->data;
+    }
+
+    /**
+     * @brief Construct a new node data in place at the last position of the Linked List.
+     */
+    template <typename... Args>
+    T &emplace_tail(Args &&...args)
+    {
+        Node *node = new Node(std::forward<Args>(args)...);
+        if (m_tail == nullptr)
+        {
+            m_head = node;
+        }
+        else
+        {
+            m_tail->next_node = node;
+        }
+        m_tail = node;
+        m_length++;
+        return node->data;
+    }
+
+    /**
+     * @brief Construct a new node data in place so it ends up at the index position. The index can be equal to the length to add at the end.
+     */
+    template <typename... Args>
+    T &emplace_index(uint64_t index, Args &&...args)
+    {
+        assert(index <= m_length);
+
+        if (index == 0)
+        {
+            return emplace_head(std::forward<Args>(args)...);
+        }
+        if (index == m_length)
+        {
+            return emplace_tail(std::forward<Args>(args)...);
+        }
+
+        Node *previous_node = _get_node(index - 1);
+        Node *node = new Node(std::forward<Args>(args)...);
+        node->next_node = previous_node->next_node;
+        previous_node->next_node = node;
+        m_length++;
+        return node->data;
+    }
+
+    void insert_index(uint64_t index, T data)
+    {
+        emplace_index(index, std::move(data));
+    }
+
+    /**
+     * @brief Remove the first node and give back its data. It's a O(1) operation.
+     */
+    T remove_head()
+    {
+        assert(m_length > 0);
+
+        Node *node = m_head;
+        m_head = node->next_node;
+        if (m_head == nullptr)
+        {
+            m_tail = nullptr;
+        }
+        m_length--;
+        return _release_node(node);
+    }
+
+    /**
+     * @brief Remove the last node and give back its data. Like dats_linked_list_remove_tail it walks to the penultimate node.
+     */
+    T remove_tail()
+    {
+        assert(m_length > 0);
+
+        if (m_length == 1)
+        {
+            return remove_head();
+        }
+
+        Node *penultimate = _get_node(m_length - 2);
+        Node *node = m_tail;
+        penultimate->next_node = nullptr;
+        m_tail = penultimate;
+        m_length--;
+        return _release_node(node);
+    }
+
+    T remove_index(uint64_t index)
+    {
+        assert(index < m_length);
+
+        if (index == 0)
+        {
+            return remove_head();
+        }
+        if (index == m_length - 1)
+        {
+            return remove_tail();
+        }
+
+        Node *previous_node = _get_node(index - 1);
+        Node *node = previous_node->next_node;
+        previous_node->next_node = node->next_node;
+        m_length--;
+        return _release_node(node);
+    }
+
+    template <typename Func>
+    void map(Func func) const
+    {
+        for (const Node *node = m_head; node != nullptr; node = node->next_node)
+        {
+            func(node->data);
+        }
+    }
+
+    /**
+     * @brief Find the index of the first node equal to the given data.
+     *
+     * @details If the data don't match with any node the program exits and writes the error to stderr, like the C library.
+     */
+    uint64_t find(const T &data) const
+    {
+        uint64_t index = 0;
+        for (const Node *node = m_head; node != nullptr; node = node->next_node, index++)
+        {
+            if (node->data == data)
+            {
+                return index;
+            }
+        }
+        DATS_HPP_RAISE_ERROR("Unable to find data");
+    }
+
+    bool contains(const T &data) const
+    {
+        for (const Node *node = m_head; node != nullptr; node = node->next_node)
+        {
+            if (node->data == data)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint64_t length() const
+    {
+        return m_length;
+    }
+
+    void clear()
+    {
+        Node *node = m_head;
+        while (node != nullptr)
+        {
+            Node *next_node = node->next_node;
+            delete node;
+            node = next_node;
+        }
+        m_head = nullptr;
+        m_tail = nullptr;
+        m_length = 0;
+    }
+
+    iterator begin() { return iterator(m_head); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(m_head); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return const_iterator(m_head); }
+    const_iterator cend() const { return const_iterator(); }
+
+private:
+    Node *_get_node(uint64_t index) const
+    {
+        Node *node = m_head;
+        for (uint64_t i = 0; i < index; i++)
+        {
+            node = node->next_node;
+        }
+        return node;
+    }
+
+    static T _release_node(Node *node)
+    {
+        T data = std::move(node->data);
+        delete node;
+        return data;
+    }
+
+    Node *m_head;
+    Node *m_tail;
+    uint64_t m_length;
+};
+
+/**
+ * @brief LIFO Stack of T built over LinkedList. Same behaviour as dats_stack_t, iterating starts from the last data pushed.
+ */
+template <typename T>
+class Stack
+{
+public:
+    typedef T value_type;
+    typedef typename LinkedList<T>::iterator iterator;
+    typedef typename LinkedList<T>::const_iterator const_iterator;
+
+    void push(const T &data) { m_ll.insert_head(data); }
+    void push(T &&data) { m_ll.insert_head(std::move(data)); }
+
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        return m_ll.emplace_head(std::forward<Args>(args)...);
+    }
+
+    T pop() { return m_ll.remove_head(); }
+    const T &peek() const { return m_ll.get_head(); }
+    const T &get(uint64_t index) const { return m_ll.get(index); }
+    bool contains(const T &data) const { return m_ll.contains(data); }
+    uint64_t length() const { return m_ll.length(); }
+    void clear() { m_ll.clear(); }
+
+    template <typename Func>
+    void map(Func func) const
+    {
+        m_ll.map(func);
+    }
+
+    iterator begin() { return m_ll.begin(); }
+    iterator end() { return m_ll.end(); }
+    const_iterator begin() const { return m_ll.begin(); }
+    const_iterator end() const { return m_ll.end(); }
+
+private:
+    LinkedList<T> m_ll;
+};
+
+/**
+ * @brief FIFO Queue of T built over LinkedList.
+ *
+ * @details Unlike dats_queue_t the data are enqueued at the tail and dequeued at the head so both operations are O(1).
+ * Therefore the index 0 and the iteration start from the first data enqueued (the next one to be dequeued).
+ */
+template <typename T>
+class Queue
+{
+public:
+    typedef T value_type;
+    typedef typename LinkedList<T>::iterator iterator;
+    typedef typename LinkedList<T>::const_iterator const_iterator;
+
+    void enqueue(const T &data) { m_ll.insert_tail(data); }
+    void enqueue(T &&data) { m_ll.insert_tail(std::move(data)); }
+
+    template <typename... Args>
+    T &emplace(Args &&...args)
+    {
+        return m_ll.emplace_tail(std::forward<Args>(args)...);
+    }
+
+    T dequeue() { return m_ll.remove_head(); }
+    const T &peek() const { return m_ll.get_head(); }
+    const T &get(uint64_t index) const { return m_ll.get(index); }
+    bool contains(const T &data) const { return m_ll.contains(data); }
+    uint64_t length() const { return m_ll.length(); }
+    void clear() { m_ll.clear(); }
+
+    template <typename Func>
+    void map(Func func) const
+    {
+        m_ll.map(func);
+    }
+
+    iterator begin() { return m_ll.begin(); }
+    iterator end() { return m_ll.end(); }
+    const_iterator begin() const { return m_ll.begin(); }
+    const_iterator end() const { return m_ll.end(); }
+
+private:
+    LinkedList<T> m_ll;
+};
+
+enum class Traversal
+{
+    PreOrder = 0,
+    InOrder,
+    PostOrder,
+    LevelOrder,
+};
+
+/**
+ * @brief Binary Search Tree of unique T ordered by Compare. Same behaviour as dats_binary_search_tree_t.
+ *
+ * @details Compare is a strict weak ordering like std::less, two data are duplicate when neither is less than the other.
+ * The iterators go through the data in order.
+ */
+template <typename T, typename Compare = std::less<T>>
+class BinarySearchTree
+{
+private:
+    struct Node
+    {
+        template <typename... Args>
+        explicit Node(Args &&...args)
+            : left(nullptr), right(nullptr), parent(nullptr), data(std::forward<Args>(args)...)
+        {
+        }
+
+        Node *left;
+        Node *right;
+        Node *parent;
+        T data;
+    };
+
+public:
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef T value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const T *pointer;
+        typedef const T &reference;
+
+        const_iterator() : m_node(nullptr) {}
+        explicit const_iterator(const Node *node) : m_node(node) {}
+
+        reference operator*() const { return m_node->data; }
+        pointer operator->() const { return &m_node->data; }
+
+        const_iterator &operator++()
+        {
+            m_node = _next_in_order(m_node);
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator previous = *this;
+            m_node = _next_in_order(m_node);
+            return previous;
+        }
+
+        bool operator==(const const_iterator &other) const { return m_node == other.m_node; }
+        bool operator!=(const const_iterator &other) const { return m_node != other.m_node; }
+
+    private:
+        const Node *m_node;
+    };
+
+    /* The data are the ordering keys so they can't be modified through an iterator. */
+    typedef const_iterator iterator;
+    typedef T value_type;
+
+    explicit BinarySearchTree(Compare compare = Compare())
+        : m_head(nullptr), m_length(0), m_compare(compare)
+    {
+    }
+
+    BinarySearchTree(const BinarySearchTree &other)
+        : m_head(nullptr), m_length(0), m_compare(other.m_compare)
+    {
+        other.traverse(Traversal::PreOrder, [this](const T &data) { insert(data); });
+    }
+
+    BinarySearchTree(BinarySearchTree &&other) noexcept
+        : m_head(other.m_head), m_length(other.m_length), m_compare(std::move(other.m_compare))
+    {
+        other.m_head = nullptr;
+        other.m_length = 0;
+    }
+
+    BinarySearchTree &operator=(BinarySearchTree other) noexcept
+    {
+        swap(other);
+        return *this;
+    }
+
+    ~BinarySearchTree()
+    {
+        clear();
+    }
+
+    void swap(BinarySearchTree &other) noexcept
+    {
+        std::swap(m_head, other.m_head);
+        std::swap(m_length, other.m_length);
+        std::swap(m_compare, other.m_compare);
+    }
+
+    /**
+     * @brief Insert the data at its position in the BST.
+     *
+     * @return true The data has been inserted.
+     * @return false An equal data already exists, the BST is left unchanged.
+     */
+    bool insert(const T &data) { return emplace(data); }
+    bool insert(T &&data) { return emplace(std::move(data)); }
+
+    /**
+     * @brief Construct the data in place and insert it at its position in the BST.
+     *
+     * @return false An equal data already exists, the constructed data is destroyed.
+     */
+    template <typename... Args>
+    bool emplace(Args &&...args)
+    {
+        Node *node = new Node(std::forward<Args>(args)...);
+        Node *parent = nullptr;
+        Node **link = &m_head;
+
+        while (*link != nullptr)
+        {
+            parent = *link;
+            if (m_compare(node->data, parent->data))
+            {
+                link = &parent->left;
+            }
+            else if (m_compare(parent->data, node->data))
+            {
+                link = &parent->right;
+            }
+            else
+            {
+                delete node;
+                return false;
+            }
+        }
+
+        node->parent = parent;
+        *link = node;
+        m_length++;
+        return true;
+    }
+
+    /**
+     * @brief Remove the data equal to the given one.
+     *
+     * @return false The data doesn't exist in the BST.
+     */
+    bool remove(const T &data)
+    {
+        Node *node = _find_node(data);
+        if (node == nullptr)
+        {
+            return false;
+        }
+
+        if (node->left != nullptr && node->right != nullptr)
+        {
+            Node *successor = _dig_left_node(node->right);
+            node->data = std::move(successor->data);
+            node = successor;
+        }
+
+        Node *child = node->left != nullptr ? node->left : node->right;
+        if (child != nullptr)
+        {
+            child->parent = node->parent;
+        }
+        _parent_link(node) = child;
+
+        delete node;
+        m_length--;
+        return true;
+    }
+
+    bool contains(const T &data) const
+    {
+        return _find_node(data) != nullptr;
+    }
+
+    /**
+     * @brief Call func with every data in the order described by way.
+     */
+    template <typename Func>
+    void traverse(Traversal way, Func func) const
+    {
+        if (way == Traversal::LevelOrder)
+        {
+            Queue<const Node *> queue;
+            if (m_head != nullptr)
+            {
+                queue.enqueue(m_head);
+            }
+            while (queue.length() > 0)
+            {
+                const Node *node = queue.dequeue();
+                func(node->data);
+                if (node->left != nullptr)
+                {
+                    queue.enqueue(node->left);
+                }
+                if (node->right != nullptr)
+                {
+                    queue.enqueue(node->right);
+                }
+            }
+            return;
+        }
+        _traverse_node(m_head, way, func);
+    }
+
+    uint64_t length() const
+    {
+        return m_length;
+    }
+
+    void clear()
+    {
+        _free_node(m_head);
+        m_head = nullptr;
+        m_length = 0;
+    }
+
+    const_iterator begin() const { return const_iterator(m_head != nullptr ? _dig_left_node(m_head) : nullptr); }
+    const_iterator end() const { return const_iterator(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+
+private:
+    static Node *_dig_left_node(Node *node)
+    {
+        while (node->left != nullptr)
+        {
+            node = node->left;
+        }
+        return node;
+    }
+
+    static const Node *_next_in_order(const Node *node)
+    {
+        if (node->right != nullptr)
+        {
+            return _dig_left_node(node->right);
+        }
+        while (node->parent != nullptr && node->parent->right == node)
+        {
+            node = node->parent;
+        }
+        return node->parent;
+    }
+
+    Node *&_parent_link(Node *node)
+    {
+        if (node->parent == nullptr)
+        {
+            return m_head;
+        }
+        return node->parent->left == node ? node->parent->left : node->parent->right;
+    }
+
+    Node *_find_node(const T &data) const
+    {
+        Node *node = m_head;
+        while (node != nullptr)
+        {
+            if (m_compare(data, node->data))
+            {
+                node = node->left;
+            }
+            else if (m_compare(node->data, data))
+            {
+                node = node->right;
+            }
+            else
+            {
+                return node;
+            }
+        }
+        return nullptr;
+    }
+
+    template <typename Func>
+    static void _traverse_node(const Node *node, Traversal way, Func &func)
+    {
+        if (node == nullptr)
+        {
+            return;
+        }
+        if (way == Traversal::PreOrder)
+        {
+            func(node->data);
+        }
+        _traverse_node(node->left, way, func);
+        if (way == Traversal::InOrder)
+        {
+            func(node->data);
+        }
+        _traverse_node(node->right, way, func);
+        if (way == Traversal::PostOrder)
+        {
+            func(node->data);
+        }
+    }
+
+    static void _free_node(Node *node)
+    {
+        if (node == nullptr)
+        {
+            return;
+        }
+        _free_node(node->left);
+        _free_node(node->right);
+        delete node;
+    }
+
+    Node *m_head;
+    uint64_t m_length;
+    Compare m_compare;
+};
+
+/**
+ * @brief Sparse index to dense T storage. Same behaviour as dats_dense_array_t, the iterators go through the dense data.
+ */
+template <typename T>
+class DenseArray
+{
+private:
+    static const uint64_t EMPTY = UINT64_MAX;
+
+public:
+    typedef T value_type;
+    typedef typename DynamicArray<T>::iterator iterator;
+    typedef typename DynamicArray<T>::const_iterator const_iterator;
+
+    /**
+     * @brief Copy or move the data at the index position replacing the data previously in there if any.
+     */
+    void insert(uint64_t index, const T &data) { _insert(index, data); }
+    void insert(uint64_t index, T &&data) { _insert(index, std::move(data)); }
+
+    /**
+     * @brief Construct the data in place at the index position. There must be no data at this index yet.
+     */
+    template <typename... Args>
+    T &emplace(uint64_t index, Args &&...args)
+    {
+        assert(!has(index));
+
+        uint64_t &cell = _lookup_cell(index);
+        cell = m_data.length();
+        m_data_index.add(index);
+        return m_data.emplace(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Remove the data at the index position. The last dense data is moved in its slot to keep the data contiguous.
+     */
+    void remove(uint64_t index)
+    {
+        assert(has(index));
+
+        uint64_t dense_index = m_lookup[index];
+        uint64_t last = m_data.length() - 1;
+
+        if (dense_index != last)
+        {
+            m_data[dense_index] = std::move(m_data[last]);
+            m_data_index[dense_index] = m_data_index[last];
+            m_lookup[m_data_index[dense_index]] = dense_index;
+        }
+        m_data.pop();
+        m_data_index.pop();
+        m_lookup[index] = EMPTY;
+    }
+
+    bool has(uint64_t index) const
+    {
+        return index < m_lookup.length() && m_lookup[index] != EMPTY;
+    }
+
+    const T &get(uint64_t index) const
+    {
+        assert(has(index));
+        return m_data[m_lookup[index]];
+    }
+
+    T &ref(uint64_t index)
+    {
+        assert(has(index));
+        return m_data[m_lookup[index]];
+    }
+
+    bool contains(const T &data) const
+    {
+        return m_data.contains(data);
+    }
+
+    uint64_t length() const
+    {
+        return m_data.length();
+    }
+
+    void clear()
+    {
+        m_lookup.clear();
+        m_data.clear();
+        m_data_index.clear();
+    }
+
+    iterator begin() { return m_data.begin(); }
+    iterator end() { return m_data.end(); }
+    const_iterator begin() const { return m_data.begin(); }
+    const_iterator end() const { return m_data.end(); }
+
+private:
+    template <typename U>
+    void _insert(uint64_t index, U &&data)
+    {
+        if (has(index))
+        {
+            m_data[m_lookup[index]] = std::forward<U>(data);
+            return;
+        }
+        emplace(index, std::forward<U>(data));
+    }
+
+    uint64_t &_lookup_cell(uint64_t index)
+    {
+        while (m_lookup.length() <= index)
+        {
+            m_lookup.add(EMPTY);
+        }
+        return m_lookup[index];
+    }
+
+    DynamicArray<uint64_t> m_lookup;
+    DynamicArray<T> m_data;
+    DynamicArray<uint64_t> m_data_index;
+};
+
+template <typename T>
+const uint64_t DenseArray<T>::EMPTY;
+
+}
+
+#endif
@@ -0,0 +1,267 @@
+#ifndef DOUBLY_LINKED_LIST_H
+#define DOUBLY_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct _dats_doubly_node_t dats_doubly_node_t;
+
+/**
+ * @brief The node structure of the doubly linked list.
+ *
+ * The next_node point the next following node and the previous_node the one before, NULL if there isn't.
+ * Keeping a pointer to a node allows to remove it in O(1).
+ */
+typedef struct _dats_doubly_node_t
+{
+    dats_doubly_node_t *next_node;
+    dats_doubly_node_t *previous_node;
+    void *data;
+} dats_doubly_node_t;
+
+typedef struct
+{
+    dats_doubly_node_t *head;
+    dats_doubly_node_t *tail;
+    const uint64_t data_size;
+    uint64_t length;
+} dats_doubly_linked_list_t;
+
+/**
+ * @brief Creating and initialize new doubly linked list ready to use.
+ *
+ * @param data_size Number of bytes of the data that will be stored.
+ * @return dats_doubly_linked_list_t The resulting doubly linked list created.
+ */
+dats_doubly_linked_list_t dats_doubly_linked_list_new(uint64_t data_size);
+
+/**
+ * @brief Getting a const pointer to the data associated to the node described by his index. It walks from the nearest end.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param index The index corresponding to the node position in the doubly linked list, starting from 0.
+ * @return const void* Pointer to the heap alocated data. Must not be changed or freed.
+ */
+const void *dats_doubly_linked_list_get(const dats_doubly_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Getting the node at the given index. It walks from the nearest end.
+ *
+ * @details The node can then be used to move with next_node and previous_node or to be removed with dats_doubly_linked_list_remove_node. You must not alter its pointers.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param index The index corresponding to the node position in the doubly linked list, starting from 0.
+ * @return dats_doubly_node_t* Pointer to the node.
+ */
+dats_doubly_node_t *dats_doubly_linked_list_get_node(const dats_doubly_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Get a const void pointer to the head node data (the first one). It's a O(1) operation.
+ *
+ * @details You must call this function on a doubly linked list with at least a length of 1. The data must not be altered or even freed.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @return const void* Poiter to the data that exist in the first node.
+ */
+const void *dats_doubly_linked_list_get_head(const dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Get a const void pointer to the tail node data (the last one). It's a O(1) operation.
+ *
+ * @details You must call this function on a doubly linked list with at least a length of 1. The data must not be altered or even freed.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @return const void* Poiter to the data that exist in the last node.
+ */
+const void *dats_doubly_linked_list_get_tail(const dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Add a new node heap allocated with data at the first position of the doubly linked list.
+ *
+ * @param self Pointer to the doubly linked list waiting for the new node.
+ * @param data Void pointer to the data that will copy to the new node data.
+ */
+void dats_doubly_linked_list_insert_head(dats_doubly_linked_list_t *self, const void *data);
+
+/**
+ * @brief Add a new node heap allocated with data at the last position of the doubly linked list.
+ *
+ * @param self Pointer to the doubly linked list waiting for the new node.
+ * @param data Void pointer to the data that will copy to the new node data.
+ */
+void dats_doubly_linked_list_insert_tail(dats_doubly_linked_list_t *self, const void *data);
+
+/**
+ * @brief Add a new node heap allocated with data at the given index position. The index can be equal to the length to add at the end.
+ *
+ * @param self Pointer to the doubly linked list waiting for the new node.
+ * @param index The corresponding position that the new node will take.
+ * @param data Void pointer to the data that will copy to the new node data.
+ */
+void dats_doubly_linked_list_insert_index(dats_doubly_linked_list_t *self, uint64_t index, const void *data);
+
+/**
+ * @brief Remove the first node of the doubly linked list. It's a O(1) operation.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @return void* Pointer to the data removed, this data isn't cleared. He must be freed by the user.
+ */
+void *dats_doubly_linked_list_remove_head(dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Remove the last node of the doubly linked list. It's a O(1) operation.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @return void* Pointer to the data removed, this data isn't cleared. He must be freed by the user.
+ */
+void *dats_doubly_linked_list_remove_tail(dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Remove the node at the given index. It walks from the nearest end.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param index The precise index of the node that will be removed, starting from 0.
+ * @return void* Pointer to the data removed, this data isn't cleared. He must be freed by the user.
+ */
+void *dats_doubly_linked_list_remove_index(dats_doubly_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Remove the first node of the doubly linked list and copy its data into out. The node and its data are freed by the doubly linked list.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_doubly_linked_list_remove_head_into(dats_doubly_linked_list_t *self, void *out);
+
+/**
+ * @brief Remove and free the first node of the doubly linked list without giving back its data.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ */
+void dats_doubly_linked_list_remove_head_discard(dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Remove the last node of the doubly linked list and copy its data into out. The node and its data are freed by the doubly linked list.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_doubly_linked_list_remove_tail_into(dats_doubly_linked_list_t *self, void *out);
+
+/**
+ * @brief Remove and free the last node of the doubly linked list without giving back its data.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ */
+void dats_doubly_linked_list_remove_tail_discard(dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Insert count data stored next to each other at the head, the last one ends first in the doubly linked list.
+ *
+ * @details The nodes are chained apart and linked to the list once.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes that will be copied.
+ * @param count Number of data to insert.
+ */
+void dats_doubly_linked_list_insert_head_n(dats_doubly_linked_list_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Remove the count last nodes and copy their data next to each other into out, the tail first.
+ *
+ * @details The doubly linked list must hold at least count nodes, it's checked once. The nodes are unlinked in one step then copied and freed.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param out Buffer of at least count * data_size bytes receiving the removed data.
+ * @param count Number of nodes to remove.
+ */
+void dats_doubly_linked_list_remove_tail_n_into(dats_doubly_linked_list_t *self, void *out, uint64_t count);
+
+/**
+ * @brief Remove the node at the given index and copy its data into out. The node and its data are freed by the doubly linked list.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param index The precise index of the node that will be removed, starting from 0.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_doubly_linked_list_remove_index_into(dats_doubly_linked_list_t *self, uint64_t index, void *out);
+
+/**
+ * @brief Remove and free the node at the given index without giving back its data.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param index The precise index of the node that will be removed, starting from 0.
+ */
+void dats_doubly_linked_list_remove_index_discard(dats_doubly_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Remove a node already known, for example kept from dats_doubly_linked_list_get_node. It's a O(1) operation.
+ *
+ * @details The node must belong to this doubly linked list and must not be used after this.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param node The node that will be unlinked and freed.
+ * @return void* Pointer to the data removed, this data isn't cleared. He must be freed by the user.
+ */
+void *dats_doubly_linked_list_remove_node(dats_doubly_linked_list_t *self, dats_doubly_node_t *node);
+
+/**
+ * @brief Map through all the nodes from the head to the tail and get back each time the data associated.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param func Pointer to a function called with the data of each crossed node.
+ */
+void dats_doubly_linked_list_map(const dats_doubly_linked_list_t *self, void (*func)(const void *data));
+
+/**
+ * @brief Map through all the nodes from the tail to the head and get back each time the data associated.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param func Pointer to a function called with the data of each crossed node.
+ */
+void dats_doubly_linked_list_map_reverse(const dats_doubly_linked_list_t *self, void (*func)(const void *data));
+
+/**
+ * @brief Find the index position of the first node that match the corresponding given data. It starts at position 0.
+ *
+ * @details If the data don't match with any node the program exits and writes the error to stderr.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param data The data that must match with at least one node data. We are not comparing the pointers but the real memory that is pointed.
+ * @return uint64_t Index position of the first matching node.
+ */
+uint64_t dats_doubly_linked_list_find(const dats_doubly_linked_list_t *self, const void *data);
+
+/**
+ * @brief Check if the given data exist in at least on node in the doubly linked list.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @param data The data we are trying to find in the data structure.
+ * @return true The data exist at least once.
+ * @return false The data isn't in the given doubly linked list.
+ */
+bool dats_doubly_linked_list_contains(const dats_doubly_linked_list_t *self, const void *data);
+
+/**
+ * @brief Get back the precise size of the current doubly linked list.
+ *
+ * @param self Pointer to the existing doubly linked list to perform the function.
+ * @return uint64_t Size of the doubly linked list. Each node count as 1 element.
+ */
+uint64_t dats_doubly_linked_list_length(const dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Clear an already existing doubly linked list to be reuse direclty after this.
+ *
+ * @param self Pointer to existing doubly linked list.
+ */
+void dats_doubly_linked_list_clear(dats_doubly_linked_list_t *self);
+
+/**
+ * @brief Free an already existing doubly linked list. Freeing the every nodes and each correspondig data.
+ *
+ * @param self Pointer to existing doubly linked list.
+ */
+void dats_doubly_linked_list_free(dats_doubly_linked_list_t *self);
+
+#endif
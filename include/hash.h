@@ -0,0 +1,81 @@
+#ifndef HASH_H
+#define HASH_H
+
+#include <stdint.h>
+
+/* Seed of the hash based data structures when none is given, the 64 bits golden ratio. */
+#define DATS_HASH_DEFAULT_SEED 0x9e3779b97f4a7c15ull
+
+/**
+ * @brief Hash size bytes of data into 64 bits. It's a fast non cryptographic hash (wyhash final 4) for hash based data structures.
+ *
+ * @details The bytes are read in little endian order so a hash is the same on every machine. Different seeds give
+ * independent hashes of the same data. Keys of 4, 8 and 16 bytes have their own functions giving the same hashes.
+ *
+ * @param data Pointer to the bytes to hash, it can be NULL when size is 0.
+ * @param size Number of bytes to hash.
+ * @param seed Value mixed into the hash.
+ * @return uint64_t The hash of the data.
+ */
+uint64_t dats_hash_bytes(const void *data, uint64_t size, uint64_t seed);
+
+/**
+ * @brief Hash a key of 4 bytes, it's dats_hash_bytes(data, 4, seed) without the branches on the size.
+ *
+ * @param data Pointer to the 4 bytes to hash.
+ * @param seed Value mixed into the hash.
+ * @return uint64_t The hash of the data.
+ */
+uint64_t dats_hash_4(const void *data, uint64_t seed);
+
+/**
+ * @brief Hash a key of 8 bytes, it's dats_hash_bytes(data, 8, seed) without the branches on the size.
+ *
+ * @param data Pointer to the 8 bytes to hash.
+ * @param seed Value mixed into the hash.
+ * @return uint64_t The hash of the data.
+ */
+uint64_t dats_hash_8(const void *data, uint64_t seed);
+
+/**
+ * @brief Hash a key of 16 bytes, it's dats_hash_bytes(data, 16, seed) without the branches on the size.
+ *
+ * @param data Pointer to the 16 bytes to hash.
+ * @param seed Value mixed into the hash.
+ * @return uint64_t The hash of the data.
+ */
+uint64_t dats_hash_16(const void *data, uint64_t seed);
+
+/**
+ * @brief Hash count keys of size bytes stored one after the other, out[i] receives the hash of the key i.
+ *
+ * @details The seed is prepared once and the size is checked once, then each key is hashed independently of the
+ * others so the processor can overlap several of them. It gives the same hashes as dats_hash_bytes.
+ *
+ * @param data Pointer to the count * size bytes of the keys.
+ * @param count Number of keys.
+ * @param size Number of bytes of each key.
+ * @param seed Value mixed into the hashes.
+ * @param out Array of at least count hashes receiving the results.
+ */
+void dats_hash_n(const void *data, uint64_t count, uint64_t size, uint64_t seed, uint64_t *out);
+
+/**
+ * @brief Finalizer of MurmurHash3, gives a second independent looking hash from a first one.
+ *
+ * @details It's used to derive more probe positions from a single dats_hash_bytes call.
+ *
+ * @param hash Hash to mix.
+ * @return uint64_t The mixed hash.
+ */
+static inline uint64_t dats_hash_mix(uint64_t hash)
+{
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdull;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ull;
+    hash ^= hash >> 33;
+    return hash;
+}
+
+#endif
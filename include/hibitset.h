@@ -0,0 +1,127 @@
+#ifndef HIBITSET_H
+#define HIBITSET_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bitset.h"
+
+/**
+ * @brief Maximum number of levels of a hibitset. 11 levels of 64 bits words cover any uint64_t size.
+ */
+#define DATS_HIBITSET_MAX_LEVELS 11
+
+/**
+ * @brief A hierarchical bitset.
+ *
+ * levels[0] holds the bits themselves. Each bit of levels[n + 1] tells if the word of 64 bits at the same index in
+ * levels[n] has at least one bit set, up to a last level of a single word. Empty regions are skipped from the top, so
+ * finding the next set bit or going through the set bits costs O(levels) by set bit instead of O(size / 64).
+ */
+typedef struct
+{
+    dats_bitset_t levels[DATS_HIBITSET_MAX_LEVELS];
+    uint64_t level_count;
+    uint64_t size;
+} dats_hibitset_t;
+
+/**
+ * @brief Create and initialize a hibitset with all the bits set to 0.
+ *
+ * @details The summary levels add about 1/63 of memory on top of the bits.
+ *
+ * @param size Total number of bits of the hibitset.
+ * @return dats_hibitset_t The resulting hibitset created.
+ */
+dats_hibitset_t dats_hibitset_new(uint64_t size);
+
+/**
+ * @brief Set the state of a bit and update the summary levels above it.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @param position Place in the hibitset of the bit that will be set. Starting from 1.
+ * @param state true to set to 1 and false to set to 0 the bit.
+ */
+void dats_hibitset_set(dats_hibitset_t *self, uint64_t position, bool state);
+
+/**
+ * @brief Test if a bit is set or not at a given position.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @param position Place in the hibitset of the bit that will be tested. Starting from 1.
+ * @return true Bit is set.
+ * @return false Bit isn't set.
+ */
+bool dats_hibitset_is_set(const dats_hibitset_t *self, uint64_t position);
+
+/**
+ * @brief Test if no bit at all is set. It only reads the top level word.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @return true No bit is set.
+ * @return false At least one bit is set.
+ */
+bool dats_hibitset_is_empty(const dats_hibitset_t *self);
+
+/**
+ * @brief Find the first set bit at the given position or after it.
+ *
+ * @details It climbs the levels until a summary word has a set bit after the current one, then goes down directly to the bit.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @param position Place where the search starts, included. Starting from 1, it can be size + 1 to get 0.
+ * @return uint64_t Position of the next set bit, or 0 if there isn't any.
+ */
+uint64_t dats_hibitset_next_set(const dats_hibitset_t *self, uint64_t position);
+
+/**
+ * @brief Count the bits set. Only the non empty words are read.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @return uint64_t Number of bits set.
+ */
+uint64_t dats_hibitset_count(const dats_hibitset_t *self);
+
+/**
+ * @brief Map through the positions of the set bits in increasing order. Only the non empty words are read.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ * @param func Pointer to a function called with each position of a set bit, starting from 1.
+ */
+void dats_hibitset_map(const dats_hibitset_t *self, void (*func)(uint64_t position));
+
+/**
+ * @brief Keep in self only the bits also set in other.
+ *
+ * @details Only the blocks non empty in self are visited, the blocks empty in other are cleared without being read from other.
+ *
+ * @param self Pointer to the existing hibitset that will receive the result.
+ * @param other Pointer to the other hibitset, it must be the same size.
+ */
+void dats_hibitset_and(dats_hibitset_t *self, const dats_hibitset_t *other);
+
+/**
+ * @brief Set in self all the bits set in other.
+ *
+ * @details Only the blocks non empty in other are visited.
+ *
+ * @param self Pointer to the existing hibitset that will receive the result.
+ * @param other Pointer to the other hibitset, it must be the same size.
+ */
+void dats_hibitset_or(dats_hibitset_t *self, const dats_hibitset_t *other);
+
+/**
+ * @brief Set to 0 all the bits. Only the non empty words are written so it's cheap on a sparse hibitset.
+ *
+ * @param self Pointer to the existing hibitset to perform the function.
+ */
+void dats_hibitset_reset(dats_hibitset_t *self);
+
+/**
+ * @brief Free the hibitset completly and can't be used after this. If you just want to clear the hibitset use reset instead.
+ *
+ * @param self The hibitset that will be freed.
+ */
+void dats_hibitset_free(dats_hibitset_t *self);
+
+#endif
@@ -0,0 +1,106 @@
+#ifndef HYPERLOGLOG_H
+#define HYPERLOGLOG_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Lowest precision accepted, 16 registers.
+ */
+#define DATS_HYPERLOGLOG_MIN_PRECISION 4
+
+/**
+ * @brief Highest precision accepted, 2^18 registers.
+ */
+#define DATS_HYPERLOGLOG_MAX_PRECISION 18
+
+/**
+ * @brief Estimate the number of distinct data added, in a memory fixed by the precision.
+ *
+ * The 64-bit hash of a data chooses one of the 2^precision registers with its low bits, the register keeps the
+ * highest rank (position of the first set bit + 1) seen in the other bits. The relative standard error is about
+ * 1.04 / sqrt(2^precision): 1.6% with precision 12, 0.4% with precision 16.
+ *
+ * While few registers are used the sketch is sparse: a list of (register, rank) pairs of 4 bytes, sorted and
+ * deduplicated when it's full. It becomes dense, one byte by register, when the list would take more memory.
+ * Both give the same estimates.
+ */
+typedef struct
+{
+    uint8_t *registers;
+    uint32_t *sparse;
+    uint64_t sparse_length;
+    uint64_t sparse_capacity;
+    const uint64_t data_size;
+    const uint64_t precision;
+    const uint64_t seed;
+} dats_hyperloglog_t;
+
+/**
+ * @brief Create an empty sparse hyperloglog.
+ *
+ * @param data_size Number of bytes of the data that will be added.
+ * @param precision Base 2 logarithm of the number of registers, between DATS_HYPERLOGLOG_MIN_PRECISION and DATS_HYPERLOGLOG_MAX_PRECISION.
+ * @return dats_hyperloglog_t The direct datastructure that you will pass for others functions.
+ */
+dats_hyperloglog_t dats_hyperloglog_new(uint64_t data_size, uint64_t precision);
+
+/**
+ * @brief Add a data to the hyperloglog. Adding an already added data doesn't change the estimate.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ * @param data Pointer to the data_size bytes of the data.
+ */
+void dats_hyperloglog_add(dats_hyperloglog_t *self, const void *data);
+
+/**
+ * @brief Estimate the number of distinct data added.
+ *
+ * @details It uses the estimator of Ertl, "New cardinality estimation algorithms for HyperLogLog sketches", which is
+ * unbiased from 0 to 2^64 without correction tables.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ * @return uint64_t The estimated number of distinct data.
+ */
+uint64_t dats_hyperloglog_count(const dats_hyperloglog_t *self);
+
+/**
+ * @brief Make self the sketch of the data added to self or to other, as if they had been added to self.
+ *
+ * @param self Pointer to the existing hyperloglog that will receive the result.
+ * @param other Pointer to a hyperloglog with the same data_size and precision.
+ */
+void dats_hyperloglog_merge(dats_hyperloglog_t *self, const dats_hyperloglog_t *other);
+
+/**
+ * @brief Check if the hyperloglog is still in the sparse representation.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ * @return true Only the used registers are kept.
+ * @return false Every register is kept.
+ */
+bool dats_hyperloglog_is_sparse(const dats_hyperloglog_t *self);
+
+/**
+ * @brief Get back the number of bytes allocated by the hyperloglog.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ * @return uint64_t Number of bytes.
+ */
+uint64_t dats_hyperloglog_memory_usage(const dats_hyperloglog_t *self);
+
+/**
+ * @brief Remove all the data, the hyperloglog is sparse again and can be reused directly after this.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ */
+void dats_hyperloglog_clear(dats_hyperloglog_t *self);
+
+/**
+ * @brief Free the hyperloglog and can't be used after this.
+ *
+ * @param self Pointer to the existing hyperloglog to perform the function.
+ */
+void dats_hyperloglog_free(dats_hyperloglog_t *self);
+
+#endif
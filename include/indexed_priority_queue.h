@@ -0,0 +1,124 @@
+#ifndef INDEXED_PRIORITY_QUEUE_H
+#define INDEXED_PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dynamic_array.h"
+
+/**
+ * @brief Priority queue where every data is attached to an id, so it can be found, changed or removed in O(log n).
+ *
+ * The data live in a d-ary heap of entries (the id followed by the data). Like the lookup table of dats_dense_array_t,
+ * positions is a sparse Dynamic Array indexed by id giving the position of its entry in the dense heap, it's updated
+ * at every move so an id never has to be searched. Ids should be small integers (node numbers, slots...) because
+ * positions grows up to the biggest id pushed.
+ */
+typedef struct
+{
+    dats_dynamic_array_t heap;
+    dats_dynamic_array_t positions;
+    int64_t (*compare)(const void *a, const void *b);
+    const uint64_t data_size;
+    const uint64_t arity;
+    void *scratch;
+} dats_indexed_priority_queue_t;
+
+/**
+ * @brief Create and initialize an empty indexed priority queue.
+ *
+ * @param data_size Number of bytes the data (the priority) is made of.
+ * @param arity Number of children by node of the heap, at least 2. 4 is a good default.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]. The smallest data comes out first.
+ * @return dats_indexed_priority_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_indexed_priority_queue_t dats_indexed_priority_queue_new(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Add a copy of data attached to id. The id must not already be in the queue.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id The id the data is attached to.
+ * @param data Pointer to the data that will be copied.
+ */
+void dats_indexed_priority_queue_push(dats_indexed_priority_queue_t *self, uint64_t id, const void *data);
+
+/**
+ * @brief Remove the smallest data for compare, giving back its id and a copy of the data.
+ *
+ * @details If the queue is empty the function will throw a assertion.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id Receive the id of the removed data, can be NULL.
+ * @param out Buffer of at least data_size bytes receiving the removed data, can be NULL.
+ */
+void dats_indexed_priority_queue_pop_into(dats_indexed_priority_queue_t *self, uint64_t *id, void *out);
+
+/**
+ * @brief Get the smallest data without removing it. The pointer is only valid until the next change of the queue.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id Receive the id of the data, can be NULL.
+ * @return const void* Pointer to the data that will be popped next.
+ */
+const void *dats_indexed_priority_queue_peek(const dats_indexed_priority_queue_t *self, uint64_t *id);
+
+/**
+ * @brief Check if a data is attached to id in the queue. It's a O(1) operation.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id The id to look for.
+ * @return true The id is in the queue.
+ * @return false The id isn't in the queue.
+ */
+bool dats_indexed_priority_queue_contains(const dats_indexed_priority_queue_t *self, uint64_t id);
+
+/**
+ * @brief Get the data attached to id. The id must be in the queue and the pointer is only valid until the next change of the queue.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id The id of the data.
+ * @return const void* Pointer to the data attached to id.
+ */
+const void *dats_indexed_priority_queue_get(const dats_indexed_priority_queue_t *self, uint64_t id);
+
+/**
+ * @brief Replace the data attached to id by a smaller or equal one and move it up the heap. It's O(log n) without any search.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id The id of the data, it must be in the queue.
+ * @param data The new data, it must not be bigger than the current one for compare.
+ */
+void dats_indexed_priority_queue_decrease_key(dats_indexed_priority_queue_t *self, uint64_t id, const void *data);
+
+/**
+ * @brief Remove the data attached to id, wherever it is in the heap. It's O(log n) without any search.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @param id The id of the data, it must be in the queue.
+ */
+void dats_indexed_priority_queue_remove(dats_indexed_priority_queue_t *self, uint64_t id);
+
+/**
+ * @brief Get the number of data in the queue.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ * @return uint64_t Number of data in the queue.
+ */
+uint64_t dats_indexed_priority_queue_length(const dats_indexed_priority_queue_t *self);
+
+/**
+ * @brief Remove every data but keep the memory so the queue can be reused directly.
+ *
+ * @param self Pointer to the existing indexed priority queue to perform the function.
+ */
+void dats_indexed_priority_queue_clear(dats_indexed_priority_queue_t *self);
+
+/**
+ * @brief Free the memory used by the indexed priority queue.
+ *
+ * @param self The indexed priority queue that will be freed.
+ */
+void dats_indexed_priority_queue_free(dats_indexed_priority_queue_t *self);
+
+#endif
@@ -27,6 +27,17 @@ typedef struct _dats_linked_list_t
     uint64_t length;
 } dats_linked_list_t;
 
+/**
+ * @brief A cursor remembers a node of a linked list and its index so sequential work doesn't restart from the head.
+ *
+ * When node is NULL the cursor went past the tail. A cursor stays valid as long as its own node isn't removed from the list.
+ */
+typedef struct
+{
+    dats_node_t *node;
+    uint64_t index;
+} dats_linked_list_cursor_t;
+
 /**
  * @brief Creating and initialize new linked_list ready to use.
  * 
@@ -126,6 +137,126 @@ void *dats_linked_list_remove_tail(dats_linked_list_t *self);
  */
 void *dats_linked_list_remove_index(dats_linked_list_t *self, uint64_t index);
 
+/**
+ * @brief Remove the first node of the linked list and copy its data into out. The node and its data are freed by the linked list.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_linked_list_remove_head_into(dats_linked_list_t *self, void *out);
+
+/**
+ * @brief Remove and free the first node of the linked list without giving back its data.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ */
+void dats_linked_list_remove_head_discard(dats_linked_list_t *self);
+
+/**
+ * @brief Insert count data stored next to each other at the head, the last one ends first in the linked list.
+ *
+ * @details The nodes are chained apart and linked to the list once.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes that will be copied.
+ * @param count Number of data to insert.
+ */
+void dats_linked_list_insert_head_n(dats_linked_list_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Remove the count first nodes and copy their data next to each other into out, the head first.
+ *
+ * @details The linked list must hold at least count nodes, it's checked once. The nodes are unlinked in one step then copied and freed.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param out Buffer of at least count * data_size bytes receiving the removed data.
+ * @param count Number of nodes to remove.
+ */
+void dats_linked_list_remove_head_n_into(dats_linked_list_t *self, void *out, uint64_t count);
+
+/**
+ * @brief Remove the last node of the linked list and copy its data into out. The node and its data are freed by the linked list.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_linked_list_remove_tail_into(dats_linked_list_t *self, void *out);
+
+/**
+ * @brief Remove and free the last node of the linked list without giving back its data.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ */
+void dats_linked_list_remove_tail_discard(dats_linked_list_t *self);
+
+/**
+ * @brief Remove the node at the given index and copy its data into out. The node and its data are freed by the linked list.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param index The precise index of the node that will be removed, starting from 0.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_linked_list_remove_index_into(dats_linked_list_t *self, uint64_t index, void *out);
+
+/**
+ * @brief Remove and free the node at the given index without giving back its data.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param index The precise index of the node that will be removed, starting from 0.
+ */
+void dats_linked_list_remove_index_discard(dats_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Move every node of other at the end of self. It's a O(1) operation, no data is copied or allocated.
+ *
+ * @details Both linked lists must have the same data_size. After this other is empty and can be reused or freed.
+ *
+ * @param self Pointer to the linked list receiving the nodes.
+ * @param other Pointer to the linked list giving its nodes.
+ */
+void dats_linked_list_append_list(dats_linked_list_t *self, dats_linked_list_t *other);
+
+/**
+ * @brief Move every node of other into self so the head of other ends up at the given index. No data is copied or allocated.
+ *
+ * @details It walks to the node before index, so it's O(index). Both linked lists must have the same data_size. After this other is empty.
+ *
+ * @param self Pointer to the linked list receiving the nodes.
+ * @param index Position the first node of other will take, from 0 to the length of self.
+ * @param other Pointer to the linked list giving its nodes.
+ */
+void dats_linked_list_splice(dats_linked_list_t *self, uint64_t index, dats_linked_list_t *other);
+
+/**
+ * @brief Cut the linked list in two at the given index. The nodes from index to the tail are moved to a new linked list.
+ *
+ * @details It walks to the node before index, so it's O(index). No data is copied or allocated.
+ *
+ * @param self Pointer to the linked list that will keep the nodes before index.
+ * @param index Position of the first node moved to the new linked list, from 0 to the length of self.
+ * @return dats_linked_list_t The linked list holding the nodes from index to the previous tail. It must be freed like any linked list.
+ */
+dats_linked_list_t dats_linked_list_split_at(dats_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Sort the linked list in place by relinking its nodes. It's a bottom up merge sort: stable, O(n log n) and without any allocation (64 run heads on the stack).
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]
+ */
+void dats_linked_list_sort(dats_linked_list_t *self, int64_t (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Merge the nodes of other into self. Both linked lists must already be sorted with the same comparator. It's O(n + m) without any allocation.
+ *
+ * @details The merge is stable, for equal data the nodes of self come first. Both linked lists must have the same data_size. After this other is empty.
+ *
+ * @param self Pointer to the sorted linked list receiving the nodes.
+ * @param other Pointer to the sorted linked list giving its nodes.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]
+ */
+void dats_linked_list_merge_sorted(dats_linked_list_t *self, dats_linked_list_t *other, int64_t (*compare)(const void *a, const void *b));
+
 /**
  * @brief Map through all the nodes in passed the linked list and get back each time the data associated.
  * 
@@ -163,6 +294,91 @@ bool dats_linked_list_contains(const dats_linked_list_t *self, const void *data)
  */
 uint64_t dats_linked_list_length(const dats_linked_list_t *self);
 
+/**
+ * @brief Create a cursor on the head node of the linked list. It's a O(1) operation.
+ *
+ * @details If the linked list is empty the cursor is directly invalid.
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @return dats_linked_list_cursor_t Cursor on the first node with the index 0.
+ */
+dats_linked_list_cursor_t dats_linked_list_cursor_new(const dats_linked_list_t *self);
+
+/**
+ * @brief Create a cursor on the node at the given index. It walks from the head only once, the cursor can then move forward in O(1).
+ *
+ * @param self Pointer to the existing linked list to perform the function.
+ * @param index The index of the node the cursor will point, starting from 0. It must be lower than the length.
+ * @return dats_linked_list_cursor_t Cursor on the node at the given index.
+ */
+dats_linked_list_cursor_t dats_linked_list_cursor_at(const dats_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Check if the cursor still points to a node.
+ *
+ * @param cursor Pointer to the cursor to check.
+ * @return true The cursor points to a node and can be used.
+ * @return false The cursor went past the tail of the linked list.
+ */
+bool dats_linked_list_cursor_is_valid(const dats_linked_list_cursor_t *cursor);
+
+/**
+ * @brief Move the cursor to the following node. It's a O(1) operation.
+ *
+ * @details The cursor must be valid. After moving past the tail the cursor becomes invalid.
+ *
+ * @param cursor Pointer to the cursor to move.
+ */
+void dats_linked_list_cursor_next(dats_linked_list_cursor_t *cursor);
+
+/**
+ * @brief Get a const pointer to the data of the node under the cursor. The data must not be altered or freed.
+ *
+ * @param cursor Pointer to a valid cursor.
+ * @return const void* Pointer to the data of the node under the cursor.
+ */
+const void *dats_linked_list_cursor_get(const dats_linked_list_cursor_t *cursor);
+
+/**
+ * @brief Copy the given data in place of the data of the node under the cursor. It's a O(1) operation without allocation.
+ *
+ * @param self Pointer to the linked list the cursor comes from.
+ * @param cursor Pointer to a valid cursor.
+ * @param data Void pointer to the data that will be copied in the node.
+ */
+void dats_linked_list_cursor_replace(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, const void *data);
+
+/**
+ * @brief Add a new node with a copy of data right after the node under the cursor. It's a O(1) operation.
+ *
+ * @details If the cursor is on the tail the new node becomes the tail. The cursor doesn't move so calling next reaches the new node.
+ *
+ * @param self Pointer to the linked list the cursor comes from.
+ * @param cursor Pointer to a valid cursor.
+ * @param data Void pointer to the data that will copy to the new node data.
+ */
+void dats_linked_list_cursor_insert_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, const void *data);
+
+/**
+ * @brief Remove and free the node following the node under the cursor. It's a O(1) operation.
+ *
+ * @details There must be a node after the cursor. If the removed node was the tail the node under the cursor becomes the tail.
+ *
+ * @param self Pointer to the linked list the cursor comes from.
+ * @param cursor Pointer to a valid cursor.
+ * @return void* Pointer to the data removed, this data isn't cleared. He must be freed by the user.
+ */
+void *dats_linked_list_cursor_remove_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor);
+
+/**
+ * @brief Move every node of other right after the node under the cursor. It's a O(1) operation.
+ *
+ * @param self Pointer to the linked list the cursor comes from.
+ * @param cursor Pointer to a valid cursor.
+ * @param other Pointer to the linked list giving its nodes. It must have the same data_size and is empty after this.
+ */
+void dats_linked_list_cursor_splice_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, dats_linked_list_t *other);
+
 /**
  * @brief Clear an already existing linked_list to be reuse direclty after this. If you want to FREE all the datasctruture you should use dats_linked_list_free instead.
  * 
@@ -0,0 +1,91 @@
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomics.h"
+
+/**
+ * @brief Bounded FIFO queue that any number of producer and consumer threads can use at the same time without lock.
+ *
+ * Each cell of the ring holds a sequence number followed by the data copied inline. A producer claims the cell at
+ * enqueue_position when its sequence says it's free, a consumer claims the cell at dequeue_position when its sequence
+ * says it's filled, so threads only fight on the position they move with a compare and swap.
+ */
+typedef struct
+{
+    void *cells;
+    const uint64_t data_size;
+    const uint64_t cell_size;
+    const uint64_t capacity;
+
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) enqueue_position;
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) dequeue_position;
+} dats_mpmc_queue_t;
+
+/**
+ * @brief Create and initialize a mpmc queue. You must use this function to create a mpmc queue before sharing it between threads.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param capacity Number of data the queue can hold, rounded up to the next power of two. It must be at least 2.
+ * @return dats_mpmc_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_mpmc_queue_t dats_mpmc_queue_new(uint64_t data_size, uint64_t capacity);
+
+/**
+ * @brief Copy data at the end of the queue if there is room. Can be called by any thread.
+ *
+ * @param self Pointer to the existing mpmc queue to perform the function.
+ * @param data Pointer to the data that will be copied into the queue.
+ * @return true The data has been enqueued.
+ * @return false The queue is full, nothing has been done.
+ */
+bool dats_mpmc_queue_try_enqueue(dats_mpmc_queue_t *self, const void *data);
+
+/**
+ * @brief Remove the oldest data and copy it into out if the queue isn't empty. Can be called by any thread.
+ *
+ * @param self Pointer to the existing mpmc queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @return true A data has been copied into out.
+ * @return false The queue is empty, out isn't touched.
+ */
+bool dats_mpmc_queue_try_dequeue(dats_mpmc_queue_t *self, void *out);
+
+/**
+ * @brief Copy data at the end of the queue, waiting while the queue is full.
+ *
+ * @details The thread spins a little then yields the CPU between tries, it never sleeps on a lock.
+ *
+ * @param self Pointer to the existing mpmc queue to perform the function.
+ * @param data Pointer to the data that will be copied into the queue.
+ */
+void dats_mpmc_queue_enqueue(dats_mpmc_queue_t *self, const void *data);
+
+/**
+ * @brief Remove the oldest data and copy it into out, waiting while the queue is empty.
+ *
+ * @details The thread spins a little then yields the CPU between tries, it never sleeps on a lock.
+ *
+ * @param self Pointer to the existing mpmc queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_mpmc_queue_dequeue(dats_mpmc_queue_t *self, void *out);
+
+/**
+ * @brief Get the number of data in the queue. When others threads are working it's only an estimation.
+ *
+ * @param self Pointer to the existing mpmc queue to perform the function.
+ * @return uint64_t Number of data in the queue.
+ */
+uint64_t dats_mpmc_queue_length(dats_mpmc_queue_t *self);
+
+/**
+ * @brief Free the cells of the mpmc queue. No thread must use the queue anymore.
+ *
+ * @param self The mpmc queue that will be freed.
+ */
+void dats_mpmc_queue_free(dats_mpmc_queue_t *self);
+
+#endif
@@ -0,0 +1,92 @@
+#ifndef PRIORITY_QUEUE_H
+#define PRIORITY_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "d_ary_heap.h"
+
+/**
+ * @brief Priority queue implemented as a binary heap, the d-ary heap with an arity of 2.
+ *
+ * The data that compare puts first is always on top, the children of the data i are 2i + 1 and 2i + 2.
+ * Push and pop are O(log n) and equal priorities are allowed. Sifting keeps the moving data aside and copies each
+ * data once instead of swapping. The data live in the cache line aligned buffer of the d-ary heap rather than in a
+ * dats_dynamic_array_t, which can't give that alignment nor the padding slots before the root.
+ */
+typedef struct
+{
+    dats_d_ary_heap_t heap;
+} dats_priority_queue_t;
+
+/**
+ * @brief Create and initialize an empty priority queue.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]. The smallest data comes out first.
+ * @return dats_priority_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_priority_queue_t dats_priority_queue_new(uint64_t data_size, int64_t (*compare)(const void *a, const void *b));
+
+/**
+ * @brief Create a priority queue holding a copy of count contiguous data. The heap is built in O(n) instead of n pushes.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param compare You must provide a comparator function with respecting that system: [a < b negative] [a = b 0] [a > b positive]. The smallest data comes out first.
+ * @param data Pointer to count contiguous data of data_size bytes.
+ * @param count Number of data to copy.
+ * @return dats_priority_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_priority_queue_t dats_priority_queue_from_array(uint64_t data_size, int64_t (*compare)(const void *a, const void *b), const void *data, uint64_t count);
+
+/**
+ * @brief Add a copy of data in the priority queue.
+ *
+ * @param self Pointer to the existing priority queue to perform the function.
+ * @param data Pointer to the data that will be copied.
+ */
+void dats_priority_queue_push(dats_priority_queue_t *self, const void *data);
+
+/**
+ * @brief Remove the data with the highest priority, the smallest for compare, and copy it into out.
+ *
+ * @details If the priority queue is empty the function will throw a assertion.
+ *
+ * @param self Pointer to the existing priority queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_priority_queue_pop_into(dats_priority_queue_t *self, void *out);
+
+/**
+ * @brief Get a pointer to the data with the highest priority without removing it. It's a O(1) operation.
+ *
+ * @details The pointer is only valid until the next push or pop. You must not alter or free it.
+ *
+ * @param self Pointer to the existing priority queue to perform the function.
+ * @return const void* Pointer to the data that will be popped next.
+ */
+const void *dats_priority_queue_peek(const dats_priority_queue_t *self);
+
+/**
+ * @brief Get the number of data in the priority queue.
+ *
+ * @param self Pointer to the existing priority queue to perform the function.
+ * @return uint64_t Number of data in the priority queue.
+ */
+uint64_t dats_priority_queue_length(const dats_priority_queue_t *self);
+
+/**
+ * @brief Remove every data but keep the memory so the priority queue can be reused directly.
+ *
+ * @param self Pointer to the existing priority queue to perform the function.
+ */
+void dats_priority_queue_clear(dats_priority_queue_t *self);
+
+/**
+ * @brief Free the memory used by the priority queue.
+ *
+ * @param self The priority queue that will be freed.
+ */
+void dats_priority_queue_free(dats_priority_queue_t *self);
+
+#endif
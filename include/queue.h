@@ -4,15 +4,15 @@
 #include <stdbool.h>
 #include <stdint.h>
 
-#include "linked_list.h"
+#include "doubly_linked_list.h"
 
 /**
- * @brief This abstract data structure is implemented using a Linked List.
+ * @brief This abstract data structure is implemented using a Doubly Linked List.
  * Allowing O(1) enqueue and dequeue. The Queue data strucuture is implemented as FIFO.
  */
 typedef struct
 {
-    dats_linked_list_t ll;
+    dats_doubly_linked_list_t ll;
 } dats_queue_t;
 
 /**
@@ -41,6 +41,41 @@ void dats_queue_enqueue(dats_queue_t *self, const void *data);
  */
 void *dats_queue_dequeue(dats_queue_t *self);
 
+/**
+ * @brief Remove the data that has been added the first and copy it into out. The queue frees its own copy.
+ *
+ * @param self Pointer to the existing queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_queue_dequeue_into(dats_queue_t *self, void *out);
+
+/**
+ * @brief Remove and free the data that has been added the first without giving it back.
+ *
+ * @param self Pointer to the existing queue to perform the function.
+ */
+void dats_queue_dequeue_discard(dats_queue_t *self);
+
+/**
+ * @brief Enqueue count data stored next to each other, from the first to the last.
+ *
+ * @param self Pointer to the existing queue to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes that will be copied into the queue.
+ * @param count Number of data to enqueue.
+ */
+void dats_queue_enqueue_n(dats_queue_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Dequeue count data and copy them next to each other into out, in the order they were enqueued. The queue frees its own copies.
+ *
+ * @details The queue must hold at least count data, it's checked once for the whole batch.
+ *
+ * @param self Pointer to the existing queue to perform the function.
+ * @param out Buffer of at least count * data_size bytes receiving the removed data.
+ * @param count Number of data to dequeue.
+ */
+void dats_queue_dequeue_n(dats_queue_t *self, void *out, uint64_t count);
+
 /**
  * @brief Get a pointer to the first data to be removed using dequeue but without removing it.
  *
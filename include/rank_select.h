@@ -0,0 +1,82 @@
+#ifndef RANK_SELECT_H
+#define RANK_SELECT_H
+
+#include <stdint.h>
+
+#include "bitset.h"
+
+/**
+ * @brief Number of bits counted by one entry of the lower level of the rank select index.
+ */
+#define DATS_RANK_SELECT_BLOCK_BITS 2048
+
+/**
+ * @brief A position of the bitset is sampled for select every this number of set bits.
+ */
+#define DATS_RANK_SELECT_SAMPLE_RATE 8192
+
+/**
+ * @brief Rank and select index built once over a bitset that doesn't change anymore.
+ *
+ * Each lower entry covers 2048 bits: its 32 high bits hold the number of set bits before the block since the start of
+ * its upper block of 2^32 bits, followed by three counts of 10 bits for the first three sub-blocks of 512 bits. upper
+ * holds the number of set bits before each 2^32 bits. select_samples holds the block of every 8192th set bit. It all
+ * costs about 3.2% of the bitset memory.
+ */
+typedef struct
+{
+    const dats_bitset_t *bitset;
+    uint64_t *upper;
+    uint64_t *lower;
+    uint64_t *select_samples;
+    uint64_t lower_length;
+    uint64_t sample_length;
+    uint64_t count;
+} dats_rank_select_t;
+
+/**
+ * @brief Build the rank select index of a bitset, it reads the whole bitset once.
+ *
+ * @details The bitset is not copied. It must not be modified or freed while the index is used, a modified bitset needs a new index.
+ *
+ * @param bitset Pointer to the existing bitset to index.
+ * @return dats_rank_select_t The direct datastructure that you will pass for others functions.
+ */
+dats_rank_select_t dats_rank_select_new(const dats_bitset_t *bitset);
+
+/**
+ * @brief Count the set bits placed before a position in O(1), it reads at most 7 words of the bitset.
+ *
+ * @param self Pointer to the existing rank select index to perform the function.
+ * @param position Place in the bitset, excluded from the count. Starting from 1, it can be size + 1 to count every bit.
+ * @return uint64_t Number of set bits at the positions 1 to position - 1.
+ */
+uint64_t dats_rank_select_rank(const dats_rank_select_t *self, uint64_t position);
+
+/**
+ * @brief Find the position of the rank-th set bit.
+ *
+ * @details The samples give the block directly most of the time, a binary search between two samples is needed when the set bits are spread over many blocks.
+ *
+ * @param self Pointer to the existing rank select index to perform the function.
+ * @param rank Rank of the set bit, starting from 1 for the first set bit.
+ * @return uint64_t Position of the set bit starting from 1, or 0 if there are less than rank set bits.
+ */
+uint64_t dats_rank_select_select(const dats_rank_select_t *self, uint64_t rank);
+
+/**
+ * @brief Get back the number of set bits of the whole bitset.
+ *
+ * @param self Pointer to the existing rank select index to perform the function.
+ * @return uint64_t Number of set bits.
+ */
+uint64_t dats_rank_select_count(const dats_rank_select_t *self);
+
+/**
+ * @brief Free the rank select index. The bitset isn't freed.
+ *
+ * @param self Pointer to the existing rank select index to perform the function.
+ */
+void dats_rank_select_free(dats_rank_select_t *self);
+
+#endif
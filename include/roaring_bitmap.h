@@ -0,0 +1,168 @@
+#ifndef ROARING_BITMAP_H
+#define ROARING_BITMAP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "dynamic_array.h"
+
+/**
+ * @brief Above this number of values an array container is turned into a bitmap container, both take 8 KB there.
+ */
+#define DATS_ROARING_ARRAY_MAX_CARDINALITY 4096
+
+typedef enum
+{
+    DATS_ROARING_ARRAY,
+    DATS_ROARING_BITMAP,
+    DATS_ROARING_RUN
+} dats_roaring_container_type_t;
+
+/**
+ * @brief A container holds the values sharing the same 16 high bits, key, by their 16 low bits.
+ *
+ * An array container keeps length sorted uint16_t, a bitmap container keeps 1024 uint64_t words where the value v is
+ * the bit v % 64 of the word v / 64, a run container keeps length pairs of uint16_t (start, count - 1).
+ */
+typedef struct
+{
+    void *data;
+    uint32_t cardinality;
+    uint32_t length;
+    uint32_t capacity;
+    uint16_t key;
+    dats_roaring_container_type_t type;
+} dats_roaring_container_t;
+
+/**
+ * @brief Compressed bitmap of uint32_t values, split in chunks of 2^16 values.
+ *
+ * containers holds one dats_roaring_container_t by non empty chunk, sorted by key. A chunk only costs memory for what
+ * it holds: 2 bytes by value while sparse, 8 KB once dense, 4 bytes by run after dats_roaring_bitmap_run_optimize.
+ */
+typedef struct
+{
+    dats_dynamic_array_t containers;
+} dats_roaring_bitmap_t;
+
+/**
+ * @brief Create and initialize an empty roaring bitmap.
+ *
+ * @return dats_roaring_bitmap_t The direct datastructure that you will pass for others functions.
+ */
+dats_roaring_bitmap_t dats_roaring_bitmap_new(void);
+
+/**
+ * @brief Add a value to the roaring bitmap.
+ *
+ * @details Adding into a run container turns it back into an array or a bitmap container.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @param value The value to add.
+ * @return true The value was added.
+ * @return false The value was already there.
+ */
+bool dats_roaring_bitmap_add(dats_roaring_bitmap_t *self, uint32_t value);
+
+/**
+ * @brief Remove a value from the roaring bitmap. A container left empty is freed.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @param value The value to remove.
+ * @return true The value was removed.
+ * @return false The value wasn't there.
+ */
+bool dats_roaring_bitmap_remove(dats_roaring_bitmap_t *self, uint32_t value);
+
+/**
+ * @brief Check if a value is in the roaring bitmap. It's two binary searches at most.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @param value The value to look for.
+ * @return true The value is there.
+ * @return false The value isn't there.
+ */
+bool dats_roaring_bitmap_contains(const dats_roaring_bitmap_t *self, uint32_t value);
+
+/**
+ * @brief Get back the number of values in the roaring bitmap.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @return uint64_t Number of values stored.
+ */
+uint64_t dats_roaring_bitmap_cardinality(const dats_roaring_bitmap_t *self);
+
+/**
+ * @brief Create a new roaring bitmap with the values present in both a and b.
+ *
+ * @param a Pointer to the first roaring bitmap.
+ * @param b Pointer to the second roaring bitmap.
+ * @return dats_roaring_bitmap_t The resulting roaring bitmap, it must be freed.
+ */
+dats_roaring_bitmap_t dats_roaring_bitmap_and(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b);
+
+/**
+ * @brief Create a new roaring bitmap with the values present in a or b.
+ *
+ * @param a Pointer to the first roaring bitmap.
+ * @param b Pointer to the second roaring bitmap.
+ * @return dats_roaring_bitmap_t The resulting roaring bitmap, it must be freed.
+ */
+dats_roaring_bitmap_t dats_roaring_bitmap_or(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b);
+
+/**
+ * @brief Create a new roaring bitmap with the values present in only one of a and b.
+ *
+ * @param a Pointer to the first roaring bitmap.
+ * @param b Pointer to the second roaring bitmap.
+ * @return dats_roaring_bitmap_t The resulting roaring bitmap, it must be freed.
+ */
+dats_roaring_bitmap_t dats_roaring_bitmap_xor(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b);
+
+/**
+ * @brief Create a new roaring bitmap with the values present in a but not in b.
+ *
+ * @param a Pointer to the first roaring bitmap.
+ * @param b Pointer to the second roaring bitmap.
+ * @return dats_roaring_bitmap_t The resulting roaring bitmap, it must be freed.
+ */
+dats_roaring_bitmap_t dats_roaring_bitmap_and_not(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b);
+
+/**
+ * @brief Turn into run containers the containers that take less memory that way, like long ranges of consecutive values.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ */
+void dats_roaring_bitmap_run_optimize(dats_roaring_bitmap_t *self);
+
+/**
+ * @brief Map through all the values in increasing order.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @param func Pointer to a function called with each value.
+ */
+void dats_roaring_bitmap_map(const dats_roaring_bitmap_t *self, void (*func)(uint32_t value));
+
+/**
+ * @brief Get back the number of bytes allocated by the roaring bitmap, containers included.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ * @return uint64_t Number of bytes used.
+ */
+uint64_t dats_roaring_bitmap_memory_usage(const dats_roaring_bitmap_t *self);
+
+/**
+ * @brief Remove all the values, the roaring bitmap can be reused directly after this.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ */
+void dats_roaring_bitmap_clear(dats_roaring_bitmap_t *self);
+
+/**
+ * @brief Free the roaring bitmap and all its containers.
+ *
+ * @param self Pointer to the existing roaring bitmap to perform the function.
+ */
+void dats_roaring_bitmap_free(dats_roaring_bitmap_t *self);
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#include "atomics.h"
+#include "binary_search_tree.h"
+#include "dynamic_array.h"
+
+typedef struct _dats_scheduler_state_t dats_scheduler_state_t;
+
+/**
+ * @brief Pool of worker threads running tasks with work stealing.
+ *
+ * Each worker owns a dats_work_stealing_deque_t: the tasks it spawns go at the bottom of its own deque and it takes
+ * them back from there, an idle worker steals from the top of a random other worker. Tasks spawned from a thread
+ * that isn't a worker go through a shared dats_mpmc_queue_t. Workers with nothing to do sleep on a condition variable.
+ * The state shared with the workers is heap allocated so the scheduler can be returned by value.
+ */
+typedef struct
+{
+    dats_scheduler_state_t *state;
+    uint64_t worker_count;
+} dats_scheduler_t;
+
+/**
+ * @brief Counter of the tasks spawned in a group and not finished yet, used to wait for them with dats_scheduler_sync.
+ */
+typedef struct
+{
+    DATS_ATOMIC(uint64_t) pending;
+} dats_task_group_t;
+
+/**
+ * @brief Create a scheduler and start its worker threads.
+ *
+ * @param worker_count Number of worker threads, at least 1.
+ * @return dats_scheduler_t The direct datastructure that you will pass for others functions.
+ */
+dats_scheduler_t dats_scheduler_new(uint64_t worker_count);
+
+/**
+ * @brief Create an empty task group.
+ *
+ * @return dats_task_group_t The task group to pass to dats_scheduler_spawn and dats_scheduler_sync.
+ */
+dats_task_group_t dats_task_group_new(void);
+
+/**
+ * @brief Run func(arg) on one of the workers. It can be called from a task, or from any other thread.
+ *
+ * @details If the deque of the calling worker is full the task is run right away by the caller.
+ *
+ * @param self Pointer to the existing scheduler to perform the function.
+ * @param group The group the task is counted in until it finishes. It must live until dats_scheduler_sync returns.
+ * @param func The function run by the task.
+ * @param arg The argument given to func, it's not touched by the scheduler.
+ */
+void dats_scheduler_spawn(dats_scheduler_t *self, dats_task_group_t *group, void (*func)(void *arg), void *arg);
+
+/**
+ * @brief Wait until every task of the group is finished. The calling thread runs pending tasks meanwhile instead of sleeping.
+ *
+ * @param self Pointer to the existing scheduler to perform the function.
+ * @param group The group to wait for.
+ */
+void dats_scheduler_sync(dats_scheduler_t *self, dats_task_group_t *group);
+
+/**
+ * @brief Call func with each data of the dynamic array, in parallel and in no particular order. It returns when every call is done.
+ *
+ * @details The range is split in halves as long as a half is bigger than grain, so idle workers can steal the halves.
+ *
+ * @param self Pointer to the existing scheduler to perform the function.
+ * @param da The dynamic array to go through. It must not be changed during the call.
+ * @param func Pointer to a function called with each data. It's called from several threads at the same time.
+ * @param grain Number of data under which a range is handled by one task, at least 1.
+ */
+void dats_scheduler_parallel_map_dynamic_array(dats_scheduler_t *self, const dats_dynamic_array_t *da, void (*func)(const void *data), uint64_t grain);
+
+/**
+ * @brief Call func with each data of the binary search tree, in parallel and in no particular order. It returns when every call is done.
+ *
+ * @details The right subtrees of the first levels are spawned as tasks, the deeper ones are traversed by the task reaching them.
+ *
+ * @param self Pointer to the existing scheduler to perform the function.
+ * @param bst The binary search tree to go through. It must not be changed during the call.
+ * @param func Pointer to a function called with each data. It's called from several threads at the same time.
+ */
+void dats_scheduler_parallel_traverse_binary_search_tree(dats_scheduler_t *self, const dats_binary_search_tree_t *bst, void (*func)(const void *data));
+
+/**
+ * @brief Stop and join the worker threads then free the scheduler.
+ *
+ * @details The tasks still queued, and the ones they spawn, are run before the workers stop. Their groups must live
+ * until this returns.
+ *
+ * @param self The scheduler that will be freed.
+ */
+void dats_scheduler_free(dats_scheduler_t *self);
+
+#endif
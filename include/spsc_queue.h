@@ -0,0 +1,93 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomics.h"
+
+/**
+ * @brief Bounded FIFO queue shared by exactly one producer thread and one consumer thread, without lock nor allocation after creation.
+ *
+ * The data are copied inline in a ring buffer of capacity slots. tail is only written by the producer and head only by
+ * the consumer, each on its own cache line next to the copy of the other index it saw last, so the other line is only
+ * read again when the ring looks full (producer) or empty (consumer).
+ */
+typedef struct
+{
+    void *buffer;
+    const uint64_t data_size;
+    const uint64_t capacity;
+
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) head;
+    uint64_t cached_tail;
+
+    DATS_CACHE_ALIGNED DATS_ATOMIC(uint64_t) tail;
+    uint64_t cached_head;
+} dats_spsc_queue_t;
+
+/**
+ * @brief Create and initialize a spsc queue. You must use this function to create a spsc queue before sharing it between the two threads.
+ *
+ * @param data_size Number of bytes the data is made of that will be stored.
+ * @param capacity Number of data the queue can hold, rounded up to the next power of two.
+ * @return dats_spsc_queue_t The direct datastructure that you will pass for others functions.
+ */
+dats_spsc_queue_t dats_spsc_queue_new(uint64_t data_size, uint64_t capacity);
+
+/**
+ * @brief Copy data at the end of the queue if there is room. Must only be called by the producer thread.
+ *
+ * @param self Pointer to the existing spsc queue to perform the function.
+ * @param data Pointer to the data that will be copied into the queue.
+ * @return true The data has been enqueued.
+ * @return false The queue is full, nothing has been done.
+ */
+bool dats_spsc_queue_try_enqueue(dats_spsc_queue_t *self, const void *data);
+
+/**
+ * @brief Copy up to count contiguous data at the end of the queue and publish them at once to the consumer. Must only be called by the producer thread.
+ *
+ * @param self Pointer to the existing spsc queue to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes.
+ * @param count Number of data we try to enqueue.
+ * @return uint64_t Number of data really enqueued, from the start of data. It's lower than count when the queue gets full.
+ */
+uint64_t dats_spsc_queue_try_enqueue_n(dats_spsc_queue_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Remove the oldest data and copy it into out if the queue isn't empty. Must only be called by the consumer thread.
+ *
+ * @param self Pointer to the existing spsc queue to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ * @return true A data has been copied into out.
+ * @return false The queue is empty, out isn't touched.
+ */
+bool dats_spsc_queue_try_dequeue(dats_spsc_queue_t *self, void *out);
+
+/**
+ * @brief Remove up to count of the oldest data and copy them next to each other into out, releasing their slots at once. Must only be called by the consumer thread.
+ *
+ * @param self Pointer to the existing spsc queue to perform the function.
+ * @param out Buffer of at least count * data_size bytes.
+ * @param count Number of data we try to dequeue.
+ * @return uint64_t Number of data really copied into out.
+ */
+uint64_t dats_spsc_queue_try_dequeue_n(dats_spsc_queue_t *self, void *out, uint64_t count);
+
+/**
+ * @brief Get the number of data in the queue. When the other thread is working it's only a snapshot.
+ *
+ * @param self Pointer to the existing spsc queue to perform the function.
+ * @return uint64_t Number of data in the queue.
+ */
+uint64_t dats_spsc_queue_length(dats_spsc_queue_t *self);
+
+/**
+ * @brief Free the ring buffer of the spsc queue. No thread must use the queue anymore.
+ *
+ * @param self The spsc queue that will be freed.
+ */
+void dats_spsc_queue_free(dats_spsc_queue_t *self);
+
+#endif
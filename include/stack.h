@@ -37,6 +37,41 @@ void dats_stack_push(dats_stack_t *self, const void *data);
  */
 void *dats_stack_pop(dats_stack_t *self);
 
+/**
+ * @brief Remove the data at the first position of the stack and copy it into out. The stack frees its own copy.
+ *
+ * @param self Pointer to the existing stack to perform the function.
+ * @param out Buffer of at least data_size bytes receiving the removed data.
+ */
+void dats_stack_pop_into(dats_stack_t *self, void *out);
+
+/**
+ * @brief Remove and free the data at the first position of the stack without giving it back.
+ *
+ * @param self Pointer to the existing stack to perform the function.
+ */
+void dats_stack_pop_discard(dats_stack_t *self);
+
+/**
+ * @brief Push count data stored next to each other, from the first to the last. The last one ends at the top of the stack.
+ *
+ * @param self Pointer to the existing stack to perform the function.
+ * @param data Pointer to count contiguous data of data_size bytes that will be copied into the stack.
+ * @param count Number of data to push.
+ */
+void dats_stack_push_n(dats_stack_t *self, const void *data, uint64_t count);
+
+/**
+ * @brief Pop count data and copy them next to each other into out, the top of the stack first. The stack frees its own copies.
+ *
+ * @details The stack must hold at least count data, it's checked once for the whole batch.
+ *
+ * @param self Pointer to the existing stack to perform the function.
+ * @param out Buffer of at least count * data_size bytes receiving the removed data.
+ * @param count Number of data to pop.
+ */
+void dats_stack_pop_n(dats_stack_t *self, void *out, uint64_t count);
+
 /**
  * @brief Get a pointer to the first data to be removed using pop but without removing it.
  *
@@ -0,0 +1,442 @@
+#ifndef TYPED_H
+#define TYPED_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+
+#include "utils.h"
+#include "binary_search_tree.h"
+
+/**
+ * @brief Generate a Dynamic Array specialized for the type T. Every function is static inline and works directly with T so there is no data_size multiplication nor memcpy of unknown size.
+ *
+ * @details It generates the type name_t and the functions name_new, name_add, name_insert, name_get, name_ref, name_remove, name_contains, name_find_index, name_map, name_length, name_clear and name_free.
+ * They behave like their dats_dynamic_array_* counterparts. Data are compared byte per byte like the generic version.
+ *
+ * @param name Prefix used for the generated type and functions.
+ * @param T Type of the data stored in the Dynamic Array.
+ */
+#define DATS_DEFINE_DYNAMIC_ARRAY(name, T)                                                  \
+                                                                                            \
+typedef struct                                                                              \
+{                                                                                           \
+    uint64_t capacity;                                                                      \
+    uint64_t length;                                                                        \
+    T *buffer;                                                                              \
+} name##_t;                                                                                 \
+                                                                                            \
+static inline name##_t name##_new(uint64_t capacity)                                        \
+{                                                                                           \
+    name##_t da;                                                                            \
+    da.capacity = capacity > 0 ? capacity : 1;                                              \
+    da.length = 0;                                                                          \
+    da.buffer = (T *)DATS_OOM_GUARD(malloc(da.capacity * sizeof(T)));                       \
+    return da;                                                                              \
+}                                                                                           \
+                                                                                            \
+static inline void name##_add(name##_t *self, T data)                                       \
+{                                                                                           \
+    if (self->length == self->capacity)                                                     \
+    {                                                                                       \
+        self->capacity *= 2;                                                                \
+        self->buffer = (T *)DATS_OOM_GUARD(realloc(self->buffer, self->capacity * sizeof(T))); \
+    }                                                                                       \
+    self->buffer[self->length++] = data;                                                    \
+}                                                                                           \
+                                                                                            \
+static inline void name##_insert(name##_t *self, uint64_t index, T data)                    \
+{                                                                                           \
+    assert(index < self->length);                                                           \
+    self->buffer[index] = data;                                                             \
+}                                                                                           \
+                                                                                            \
+static inline const T *name##_get(const name##_t *self, uint64_t index)                     \
+{                                                                                           \
+    assert(index < self->length);                                                           \
+    return &self->buffer[index];                                                            \
+}                                                                                           \
+                                                                                            \
+static inline T *name##_ref(name##_t *self, uint64_t index)                                 \
+{                                                                                           \
+    assert(index < self->length);                                                           \
+    return &self->buffer[index];                                                            \
+}                                                                                           \
+                                                                                            \
+static inline bool name##_contains(const name##_t *self, const T *data)                     \
+{                                                                                           \
+    for (uint64_t i = 0; i < self->length; i++)                                             \
+    {                                                                                       \
+        if (memcmp(&self->buffer[i], data, sizeof(T)) == 0)                                 \
+        {                                                                                   \
+            return true;                                                                    \
+        }                                                                                   \
+    }                                                                                       \
+    return false;                                                                           \
+}                                                                                           \
+                                                                                            \
+static inline uint64_t name##_find_index(const name##_t *self, const T *data)               \
+{                                                                                           \
+    assert(self->length > 0);                                                               \
+                                                                                            \
+    for (uint64_t i = 0; i < self->length; i++)                                             \
+    {                                                                                       \
+        if (memcmp(&self->buffer[i], data, sizeof(T)) == 0)                                 \
+        {                                                                                   \
+            return i;                                                                       \
+        }                                                                                   \
+    }                                                                                       \
+                                                                                            \
+    DATS_RAISE_ERROR("Unable to find the data");                                            \
+    exit(EXIT_FAILURE);                                                                     \
+}                                                                                           \
+                                                                                            \
+static inline void name##_remove(name##_t *self, const T *data)                             \
+{                                                                                           \
+    uint64_t index = name##_find_index(self, data);                                         \
+    memmove(&self->buffer[index], &self->buffer[index + 1], (self->length - index - 1) * sizeof(T)); \
+    self->length--;                                                                         \
+}                                                                                           \
+                                                                                            \
+static inline void name##_map(const name##_t *self, void (*func)(const T *data))            \
+{                                                                                           \
+    for (uint64_t i = 0; i < self->length; i++)                                             \
+    {                                                                                       \
+        func(&self->buffer[i]);                                                             \
+    }                                                                                       \
+}                                                                                           \
+                                                                                            \
+static inline uint64_t name##_length(const name##_t *self)                                  \
+{                                                                                           \
+    return self->length;                                                                    \
+}                                                                                           \
+                                                                                            \
+static inline void name##_clear(name##_t *self)                                             \
+{                                                                                           \
+    self->length = 0;                                                                       \
+}                                                                                           \
+                                                                                            \
+static inline void name##_free(name##_t *self)                                              \
+{                                                                                           \
+    free(self->buffer);                                                                     \
+    self->buffer = NULL;                                                                    \
+    self->capacity = 0;                                                                     \
+    self->length = 0;                                                                       \
+}
+
+/**
+ * @brief Generate a Queue specialized for the type T. The data are stored by value in a growing ring buffer so enqueue and dequeue are O(1) without any allocation per data.
+ *
+ * @details It generates the type name_t and the functions name_new, name_enqueue, name_dequeue, name_peek, name_get, name_map, name_contains, name_length, name_clear and name_free.
+ * Like dats_queue_get the index 0 is the last data enqueued and the map goes from the last data enqueued to the first one.
+ *
+ * @param name Prefix used for the generated type and functions.
+ * @param T Type of the data stored in the Queue.
+ */
+#define DATS_DEFINE_QUEUE(name, T)                                                          \
+                                                                                            \
+typedef struct                                                                              \
+{                                                                                           \
+    uint64_t capacity;                                                                      \
+    uint64_t first;                                                                         \
+    uint64_t length;                                                                        \
+    T *buffer;                                                                              \
+} name##_t;                                                                                 \
+                                                                                            \
+static inline name##_t name##_new(void)                                                     \
+{                                                                                           \
+    name##_t q;                                                                             \
+    q.capacity = 8;                                                                         \
+    q.first = 0;                                                                            \
+    q.length = 0;                                                                           \
+    q.buffer = (T *)DATS_OOM_GUARD(malloc(q.capacity * sizeof(T)));                         \
+    return q;                                                                               \
+}                                                                                           \
+                                                                                            \
+static inline uint64_t name##_slot(const name##_t *self, uint64_t offset)                   \
+{                                                                                           \
+    return (self->first + offset) & (self->capacity - 1);                                   \
+}                                                                                           \
+                                                                                            \
+static inline void name##_enqueue(name##_t *self, T data)                                   \
+{                                                                                           \
+    if (self->length == self->capacity)                                                     \
+    {                                                                                       \
+        T *buffer = (T *)DATS_OOM_GUARD(malloc(self->capacity * 2 * sizeof(T)));            \
+        uint64_t head_part = self->capacity - self->first;                                  \
+        memcpy(buffer, &self->buffer[self->first], head_part * sizeof(T));                  \
+        memcpy(&buffer[head_part], self->buffer, self->first * sizeof(T));                  \
+        free(self->buffer);                                                                 \
+        self->buffer = buffer;                                                              \
+        self->first = 0;                                                                    \
+        self->capacity *= 2;                                                                \
+    }                                                                                       \
+    self->buffer[name##_slot(self, self->length)] = data;                                   \
+    self->length++;                                                                         \
+}                                                                                           \
+                                                                                            \
+static inline T name##_dequeue(name##_t *self)                                              \
+{                                                                                           \
+    assert(self->length > 0);                                                               \
+                                                                                            \
+    T data = self->buffer[self->first];                                                     \
+    self->first = name##_slot(self, 1);                                                     \
+    self->length--;                                                                         \
+    return data;                                                                            \
+}                                                                                           \
+                                                                                            \
+static inline const T *name##_peek(const name##_t *self)                                    \
+{                                                                                           \
+    assert(self->length > 0);                                                               \
+    return &self->buffer[self->first];                                                      \
+}                                                                                           \
+                                                                                            \
+static inline const T *name##_get(const name##_t *self, uint64_t index)                     \
+{                                                                                           \
+    assert(index < self->length);                                                           \
+    return &self->buffer[name##_slot(self, self->length - 1 - index)];                      \
+}                                                                                           \
+                                                                                            \
+static inline void name##_map(const name##_t *self, void (*func)(const T *data))            \
+{                                                                                           \
+    for (uint64_t i = 0; i < self->length; i++)                                             \
+    {                                                                                       \
+        func(name##_get(self, i));                                                          \
+    }                                                                                       \
+}                                                                                           \
+                                                                                            \
+static inline bool name##_contains(const name##_t *self, const T *data)                     \
+{                                                                                           \
+    for (uint64_t i = 0; i < self->length; i++)                                             \
+    {                                                                                       \
+        if (memcmp(&self->buffer[name##_slot(self, i)], data, sizeof(T)) == 0)              \
+        {                                                                                   \
+            return true;                                                                    \
+        }                                                                                   \
+    }                                                                                       \
+    return false;                                                                           \
+}                                                                                           \
+                                                                                            \
+static inline uint64_t name##_length(const name##_t *self)                                  \
+{                                                                                           \
+    return self->length;                                                                    \
+}                                                                                           \
+                                                                                            \
+static inline void name##_clear(name##_t *self)                                             \
+{                                                                                           \
+    self->first = 0;                                                                        \
+    self->length = 0;                                                                       \
+}                                                                                           \
+                                                                                            \
+static inline void name##_free(name##_t *self)                                              \
+{                                                                                           \
+    free(self->buffer);                                                                     \
+    self->buffer = NULL;                                                                    \
+    self->capacity = 0;                                                                     \
+    self->first = 0;                                                                        \
+    self->length = 0;                                                                       \
+}
+
+/**
+ * @brief Generate a Binary Search Tree specialized for the type T. The data are stored inside the nodes and the comparator is called directly so the compiler can inline it.
+ *
+ * @details It generates the types name_node_t and name_t and the functions name_new, name_insert, name_remove, name_contains, name_traverse, name_length and name_free.
+ * Like the generic BST duplicate data are refused and removing a data that doesn't exist raise an error.
+ *
+ * @param name Prefix used for the generated types and functions.
+ * @param T Type of the data stored in the BST.
+ * @param cmp Function or macro called as cmp(const T *a, const T *b) that respect that system: [a < b negative] [a = b 0] [a > b positive].
+ */
+#define DATS_DEFINE_BST(name, T, cmp)                                                       \
+                                                                                            \
+typedef struct name##_node_t                                                                \
+{                                                                                           \
+    T data;                                                                                 \
+    struct name##_node_t *left;                                                             \
+    struct name##_node_t *right;                                                            \
+} name##_node_t;                                                                            \
+                                                                                            \
+typedef struct                                                                              \
+{                                                                                           \
+    name##_node_t *head;                                                                    \
+    uint64_t length;                                                                        \
+} name##_t;                                                                                 \
+                                                                                            \
+static inline name##_t name##_new(void)                                                     \
+{                                                                                           \
+    name##_t bst;                                                                           \
+    bst.head = NULL;                                                                        \
+    bst.length = 0;                                                                         \
+    return bst;                                                                             \
+}                                                                                           \
+                                                                                            \
+static inline void name##_insert(name##_t *self, T data)                                    \
+{                                                                                           \
+    name##_node_t **link = &self->head;                                                     \
+                                                                                            \
+    while (*link != NULL)                                                                   \
+    {                                                                                       \
+        int64_t compare_value = cmp(&data, &(*link)->data);                                 \
+        if (compare_value < 0)                                                              \
+        {                                                                                   \
+            link = &(*link)->left;                                                          \
+        }                                                                                   \
+        else if (compare_value > 0)                                                         \
+        {                                                                                   \
+            link = &(*link)->right;                                                         \
+        }                                                                                   \
+        else                                                                                \
+        {                                                                                   \
+            DATS_RAISE_ERROR("This BST doesn't accept duplicate data.");                    \
+        }                                                                                   \
+    }                                                                                       \
+                                                                                            \
+    name##_node_t *node = (name##_node_t *)DATS_OOM_GUARD(malloc(sizeof(name##_node_t)));   \
+    node->data = data;                                                                      \
+    node->left = NULL;                                                                      \
+    node->right = NULL;                                                                     \
+    *link = node;                                                                           \
+    self->length++;                                                                         \
+}                                                                                           \
+                                                                                            \
+static inline void name##_remove(name##_t *self, const T *data)                             \
+{                                                                                           \
+    assert(self->length > 0);                                                               \
+                                                                                            \
+    name##_node_t **link = &self->head;                                                     \
+                                                                                            \
+    while (*link != NULL)                                                                   \
+    {                                                                                       \
+        int64_t compare_value = cmp(data, &(*link)->data);                                  \
+        if (compare_value == 0)                                                             \
+        {                                                                                   \
+            break;                                                                          \
+        }                                                                                   \
+        link = compare_value < 0 ? &(*link)->left : &(*link)->right;                        \
+    }                                                                                       \
+                                                                                            \
+    name##_node_t *node = *link;                                                            \
+    if (node == NULL)                                                                       \
+    {                                                                                       \
+        DATS_RAISE_ERROR("Unable to find the node to remove.");                             \
+    }                                                                                       \
+                                                                                            \
+    if (node->left == NULL)                                                                 \
+    {                                                                                       \
+        *link = node->right;                                                                \
+    }                                                                                       \
+    else if (node->right == NULL)                                                           \
+    {                                                                                       \
+        *link = node->left;                                                                 \
+    }                                                                                       \
+    else                                                                                    \
+    {                                                                                       \
+        name##_node_t **successor_link = &node->right;                                      \
+        while ((*successor_link)->left != NULL)                                             \
+        {                                                                                   \
+            successor_link = &(*successor_link)->left;                                      \
+        }                                                                                   \
+        name##_node_t *successor = *successor_link;                                         \
+        node->data = successor->data;                                                       \
+        *successor_link = successor->right;                                                 \
+        node = successor;                                                                   \
+    }                                                                                       \
+                                                                                            \
+    free(node);                                                                             \
+    self->length--;                                                                         \
+}                                                                                           \
+                                                                                            \
+static inline bool name##_contains(const name##_t *self, const T *data)                     \
+{                                                                                           \
+    const name##_node_t *node = self->head;                                                 \
+                                                                                            \
+    while (node != NULL)                                                                    \
+    {                                                                                       \
+        int64_t compare_value = cmp(data, &node->data);                                     \
+        if (compare_value == 0)                                                             \
+        {                                                                                   \
+            return true;                                                                    \
+        }                                                                                   \
+        node = compare_value < 0 ? node->left : node->right;                                \
+    }                                                                                       \
+    return false;                                                                           \
+}                                                                                           \
+                                                                                            \
+static inline void name##_traverse_node(const name##_node_t *node, dats_binary_search_tree_traversal way, void (*traverse)(const T *data)) \
+{                                                                                           \
+    if (node == NULL)                                                                       \
+    {                                                                                       \
+        return;                                                                             \
+    }                                                                                       \
+    if (way == DATS_BINARY_SEARCH_TREE_PRE_ORDER)                                           \
+    {                                                                                       \
+        traverse(&node->data);                                                              \
+    }                                                                                       \
+    name##_traverse_node(node->left, way, traverse);                                        \
+    if (way == DATS_BINARY_SEARCH_TREE_IN_ORDER)                                            \
+    {                                                                                       \
+        traverse(&node->data);                                                              \
+    }                                                                                       \
+    name##_traverse_node(node->right, way, traverse);                                       \
+    if (way == DATS_BINARY_SEARCH_TREE_POST_ORDER)                                          \
+    {                                                                                       \
+        traverse(&node->data);                                                              \
+    }                                                                                       \
+}                                                                                           \
+                                                                                            \
+static inline void name##_traverse(const name##_t *self, dats_binary_search_tree_traversal way, void (*traverse)(const T *data)) \
+{                                                                                           \
+    if (way != DATS_BINARY_SEARCH_TREE_LEVEL_ORDER)                                         \
+    {                                                                                       \
+        name##_traverse_node(self->head, way, traverse);                                    \
+        return;                                                                             \
+    }                                                                                       \
+    if (self->head == NULL)                                                                 \
+    {                                                                                       \
+        return;                                                                             \
+    }                                                                                       \
+                                                                                            \
+    const name##_node_t **level = (const name##_node_t **)DATS_OOM_GUARD(malloc(self->length * sizeof(name##_node_t *))); \
+    uint64_t end = 0;                                                                       \
+    level[end++] = self->head;                                                              \
+    for (uint64_t i = 0; i < end; i++)                                                      \
+    {                                                                                       \
+        traverse(&level[i]->data);                                                          \
+        if (level[i]->left != NULL)                                                         \
+        {                                                                                   \
+            level[end++] = level[i]->left;                                                  \
+        }                                                                                   \
+        if (level[i]->right != NULL)                                                        \
+        {                                                                                   \
+            level[end++] = level[i]->right;                                                 \
+        }                                                                                   \
+    }                                                                                       \
+    free((void *)level);                                                                    \
+}                                                                                           \
+                                                                                            \
+static inline uint64_t name##_length(const name##_t *self)                                  \
+{                                                                                           \
+    return self->length;                                                                    \
+}                                                                                           \
+                                                                                            \
+static inline void name##_free_node(name##_node_t *node)                                    \
+{                                                                                           \
+    if (node == NULL)                                                                       \
+    {                                                                                       \
+        return;                                                                             \
+    }                                                                                       \
+    name##_free_node(node->left);                                                           \
+    name##_free_node(node->right);                                                          \
+    free(node);                                                                             \
+}                                                                                           \
+                                                                                            \
+static inline void name##_free(name##_t *self)                                              \
+{                                                                                           \
+    name##_free_node(self->head);                                                           \
+    self->head = NULL;                                                                      \
+    self->length = 0;                                                                       \
+}
+
+#endif
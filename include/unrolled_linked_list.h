@@ -0,0 +1,157 @@
+#ifndef UNROLLED_LINKED_LIST_H
+#define UNROLLED_LINKED_LIST_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Number of bytes targeted for one node of the unrolled linked list (header + data), it's 4 cache lines of 64 bytes.
+ */
+#define DATS_UNROLLED_LINKED_LIST_NODE_BYTES 256
+
+typedef struct _dats_unrolled_node_t dats_unrolled_node_t;
+
+/**
+ * @brief The node structure of the unrolled linked list.
+ *
+ * The node is allocated in one block with its data right after it. data points to count contiguous elements
+ * of data_size bytes, so going through a node is going through an array.
+ */
+typedef struct _dats_unrolled_node_t
+{
+    dats_unrolled_node_t *next_node;
+    uint64_t count;
+    void *data;
+} dats_unrolled_node_t;
+
+typedef struct
+{
+    dats_unrolled_node_t *head;
+    dats_unrolled_node_t *tail;
+    const uint64_t data_size;
+    const uint64_t node_capacity;
+    uint64_t length;
+} dats_unrolled_linked_list_t;
+
+/**
+ * @brief Creating and initialize new unrolled linked list ready to use.
+ *
+ * @details The number of elements stored by node is chosen from data_size so a node fills about DATS_UNROLLED_LINKED_LIST_NODE_BYTES, with at least 4 elements by node.
+ *
+ * @param data_size Number of bytes of the data that will be stored.
+ * @return dats_unrolled_linked_list_t The resulting unrolled linked list created.
+ */
+dats_unrolled_linked_list_t dats_unrolled_linked_list_new(uint64_t data_size);
+
+/**
+ * @brief Creating and initialize new unrolled linked list with a given number of elements by node.
+ *
+ * @param data_size Number of bytes of the data that will be stored.
+ * @param node_capacity Number of elements a node can hold. It must be at least 2.
+ * @return dats_unrolled_linked_list_t The resulting unrolled linked list created.
+ */
+dats_unrolled_linked_list_t dats_unrolled_linked_list_new_with_node_capacity(uint64_t data_size, uint64_t node_capacity);
+
+/**
+ * @brief Getting a const pointer to the data at the given index. It walks node by node instead of element by element.
+ *
+ * @details The pointer is only valid until the next insertion or removal because elements move inside and between nodes.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param index The index of the data, starting from 0.
+ * @return const void* Pointer to the data. Must not be changed or freed.
+ */
+const void *dats_unrolled_linked_list_get(const dats_unrolled_linked_list_t *self, uint64_t index);
+
+/**
+ * @brief Add a copy of data at the first position of the unrolled linked list.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param data Void pointer to the data that will be copied.
+ */
+void dats_unrolled_linked_list_insert_head(dats_unrolled_linked_list_t *self, const void *data);
+
+/**
+ * @brief Add a copy of data at the last position of the unrolled linked list.
+ *
+ * @details When the tail node is full a new node is started so appending keeps every node full.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param data Void pointer to the data that will be copied.
+ */
+void dats_unrolled_linked_list_insert_tail(dats_unrolled_linked_list_t *self, const void *data);
+
+/**
+ * @brief Add a copy of data at the given index position. The index can be equal to the length to add at the end.
+ *
+ * @details If the node receiving the data is full it's split in two half full nodes.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param index The position that the new data will take.
+ * @param data Void pointer to the data that will be copied.
+ */
+void dats_unrolled_linked_list_insert_index(dats_unrolled_linked_list_t *self, uint64_t index, const void *data);
+
+/**
+ * @brief Remove the data at the given index position.
+ *
+ * @details The data is stored inside the node so it's copied into out before being removed. When a node goes under half full it's merged with or borrows from the following node.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param index The position of the data to remove, starting from 0.
+ * @param out Buffer of at least data_size bytes receiving the removed data, or NULL to discard it.
+ */
+void dats_unrolled_linked_list_remove_index(dats_unrolled_linked_list_t *self, uint64_t index, void *out);
+
+/**
+ * @brief Map through all the data from the first to the last one.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param func Pointer to a function called with each data. The data must not be modified or freed.
+ */
+void dats_unrolled_linked_list_map(const dats_unrolled_linked_list_t *self, void (*func)(const void *data));
+
+/**
+ * @brief Find the index position of the first data that match the given data.
+ *
+ * @details If the data don't match with anything the program exits and writes the error to stderr.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param data The data that must match with at least one data. We compare the memory pointed, not the pointers.
+ * @return uint64_t Index position, starting by 0, of the first match.
+ */
+uint64_t dats_unrolled_linked_list_find(const dats_unrolled_linked_list_t *self, const void *data);
+
+/**
+ * @brief Check if the given data exist at least once in the unrolled linked list.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @param data The data we are trying to find in the data structure.
+ * @return true The data exist at least once.
+ * @return false The data isn't in the given unrolled linked list.
+ */
+bool dats_unrolled_linked_list_contains(const dats_unrolled_linked_list_t *self, const void *data);
+
+/**
+ * @brief Get back the number of data stored in the unrolled linked list.
+ *
+ * @param self Pointer to the existing unrolled linked list to perform the function.
+ * @return uint64_t Number of data stored.
+ */
+uint64_t dats_unrolled_linked_list_length(const dats_unrolled_linked_list_t *self);
+
+/**
+ * @brief Clear an already existing unrolled linked list to be reuse direclty after this.
+ *
+ * @param self Pointer to existing unrolled linked list.
+ */
+void dats_unrolled_linked_list_clear(dats_unrolled_linked_list_t *self);
+
+/**
+ * @brief Free an already existing unrolled linked list and every node.
+ *
+ * @param self Pointer to existing unrolled linked list.
+ */
+void dats_unrolled_linked_list_free(dats_unrolled_linked_list_t *self);
+
+#endif
@@ -0,0 +1,78 @@
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "atomics.h"
+
+/**
+ * @brief Bounded Chase-Lev work stealing deque of pointers.
+ *
+ * One owner thread pushes and pops at the bottom like a stack, any other thread can steal from the top. The owner
+ * only synchronizes with the thieves when a single item is left. The items are pointers (typically tasks) so the
+ * slots can be read and written atomically.
+ */
+typedef struct
+{
+    DATS_ATOMIC(void *) *items;
+    const uint64_t capacity;
+
+    DATS_CACHE_ALIGNED DATS_ATOMIC(int64_t) top;
+    DATS_CACHE_ALIGNED DATS_ATOMIC(int64_t) bottom;
+} dats_work_stealing_deque_t;
+
+/**
+ * @brief Create and initialize a work stealing deque. You must use this function to create a deque before sharing it between threads.
+ *
+ * @param capacity Number of pointers the deque can hold, rounded up to the next power of two.
+ * @return dats_work_stealing_deque_t The direct datastructure that you will pass for others functions.
+ */
+dats_work_stealing_deque_t dats_work_stealing_deque_new(uint64_t capacity);
+
+/**
+ * @brief Add an item at the bottom of the deque. Must only be called by the owner thread.
+ *
+ * @param self Pointer to the existing deque to perform the function.
+ * @param item The pointer stored, it's not dereferenced by the deque.
+ * @return true The item has been pushed.
+ * @return false The deque is full, nothing has been done.
+ */
+bool dats_work_stealing_deque_push(dats_work_stealing_deque_t *self, void *item);
+
+/**
+ * @brief Remove the item at the bottom of the deque, the last one pushed. Must only be called by the owner thread.
+ *
+ * @param self Pointer to the existing deque to perform the function.
+ * @param item Receive the removed item.
+ * @return true An item has been removed.
+ * @return false The deque is empty or a thief took the last item.
+ */
+bool dats_work_stealing_deque_pop(dats_work_stealing_deque_t *self, void **item);
+
+/**
+ * @brief Remove the item at the top of the deque, the oldest one pushed. Can be called by any thread.
+ *
+ * @param self Pointer to the existing deque to perform the function.
+ * @param item Receive the stolen item.
+ * @return true An item has been stolen.
+ * @return false The deque is empty or another thread took the item first.
+ */
+bool dats_work_stealing_deque_steal(dats_work_stealing_deque_t *self, void **item);
+
+/**
+ * @brief Get the number of items in the deque. When others threads are working it's only an estimation.
+ *
+ * @param self Pointer to the existing deque to perform the function.
+ * @return uint64_t Number of items in the deque.
+ */
+uint64_t dats_work_stealing_deque_length(dats_work_stealing_deque_t *self);
+
+/**
+ * @brief Free the slots of the deque. The items themselves aren't freed and no thread must use the deque anymore.
+ *
+ * @param self The deque that will be freed.
+ */
+void dats_work_stealing_deque_free(dats_work_stealing_deque_t *self);
+
+#endif
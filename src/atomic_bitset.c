@@ -0,0 +1,108 @@
+#include <assert.h>
+#include <stdatomic.h>
+
+#include "bits.h"
+#include "atomic_bitset.h"
+
+static _Atomic uint64_t *_word(const dats_bitset_t *self, uint64_t index);
+static uint64_t _logical(uint64_t native);
+
+bool dats_atomic_bitset_test_and_set(dats_bitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+    assert(position <= self->size);
+
+    uint64_t mask = _logical(0x8000000000000000ull >> ((position - 1) % 64));
+    uint64_t previous = atomic_fetch_or_explicit(_word(self, (position - 1) / 64), mask, memory_order_acq_rel);
+
+    return (previous & mask) != 0;
+}
+
+void dats_atomic_bitset_set(dats_bitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+    assert(position <= self->size);
+
+    uint64_t mask = _logical(0x8000000000000000ull >> ((position - 1) % 64));
+    atomic_fetch_or_explicit(_word(self, (position - 1) / 64), mask, memory_order_release);
+}
+
+void dats_atomic_bitset_clear(dats_bitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+    assert(position <= self->size);
+
+    uint64_t mask = _logical(0x8000000000000000ull >> ((position - 1) % 64));
+    atomic_fetch_and_explicit(_word(self, (position - 1) / 64), ~mask, memory_order_release);
+}
+
+bool dats_atomic_bitset_is_set(const dats_bitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+    assert(position <= self->size);
+
+    uint64_t mask = _logical(0x8000000000000000ull >> ((position - 1) % 64));
+    return (atomic_load_explicit(_word(self, (position - 1) / 64), memory_order_acquire) & mask) != 0;
+}
+
+uint64_t dats_atomic_bitset_fetch_or_word(dats_bitset_t *self, uint64_t index, uint64_t word)
+{
+    assert(index < (self->size + 63) / 64);
+
+    uint64_t native = _logical(word & dats_bits_valid_mask(self->size, index));
+    return _logical(atomic_fetch_or_explicit(_word(self, index), native, memory_order_acq_rel));
+}
+
+uint64_t dats_atomic_bitset_claim_first_free(dats_bitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+
+    uint64_t word_length = (self->size + 63) / 64;
+
+    for (uint64_t index = (position - 1) / 64; index < word_length; index++)
+    {
+        _Atomic uint64_t *word = _word(self, index);
+        uint64_t free_bits = dats_bits_valid_mask(self->size, index);
+
+        if (index == (position - 1) / 64)
+        {
+            free_bits &= UINT64_MAX >> ((position - 1) % 64);
+        }
+
+        uint64_t current = _logical(atomic_load_explicit(word, memory_order_relaxed));
+
+        /* Try the first free bit until one is set by this call, the word is refreshed by each failed attempt. */
+        while ((~current & free_bits) != 0)
+        {
+            uint64_t offset = dats_bits_clz64(~current & free_bits);
+            uint64_t mask = 0x8000000000000000ull >> offset;
+            uint64_t previous = _logical(atomic_fetch_or_explicit(word, _logical(mask), memory_order_acq_rel));
+
+            if ((previous & mask) == 0)
+            {
+                return index * 64 + offset + 1;
+            }
+            current = previous;
+        }
+    }
+    return 0;
+}
+
+static _Atomic uint64_t *_word(const dats_bitset_t *self, uint64_t index)
+{
+    return (_Atomic uint64_t *)self->buffer + index;
+}
+
+/*
+ * The buffer is a sequence of bytes where the first position is the most significant bit of the first byte. Loaded
+ * as a native uint64_t on a little endian machine the bytes are reversed, swapping them gives the layout of
+ * dats_bitset_get_word. Swapping is its own inverse so it also turns a logical mask into the native one.
+ */
+static uint64_t _logical(uint64_t native)
+{
+    if (dats_bits_is_little_endian())
+    {
+        return dats_bits_bswap64(native);
+    }
+    return native;
+}
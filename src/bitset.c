@@ -4,9 +4,21 @@
 #include <assert.h>
 #include <string.h>
 
+#include "bits.h"
 #include "bitset.h"
 #include "utils.h"
 
+typedef enum
+{
+    _SET,
+    _CLEAR,
+    _FLIP
+} _range_operation_t;
+
+static uint64_t _allocated_bytes(uint64_t bytes_needed);
+static void _apply_range(dats_bitset_t *self, uint64_t first, uint64_t last, _range_operation_t operation);
+static void _apply_word(dats_bitset_t *self, uint64_t index, uint64_t mask, _range_operation_t operation);
+
 dats_bitset_t dats_bitset_new(uint64_t size)
 {
     assert(size > 0);
@@ -17,8 +29,9 @@ dats_bitset_t dats_bitset_new(uint64_t size)
         bytes_needed++;
     }
 
+    /* Rounded to whole 64 bits words so the last one can be read or updated atomically. */
     dats_bitset_t bt = {
-        .buffer = DATS_OOM_GUARD(calloc(bytes_needed, 1)),
+        .buffer = DATS_OOM_GUARD(calloc(_allocated_bytes(bytes_needed), 1)),
         .size = size,
         .bytes_needed = bytes_needed
     };
@@ -56,6 +69,44 @@ void dats_bitset_set(dats_bitset_t *self, uint64_t position, bool state)
     }
 }
 
+void dats_bitset_resize(dats_bitset_t *self, uint64_t size)
+{
+    assert(size > 0);
+
+    uint64_t bytes_needed = (size + 7) / 8;
+    uint64_t allocated = _allocated_bytes(bytes_needed);
+    uint64_t kept = size < self->size ? size : self->size;
+
+    self->buffer = DATS_OOM_GUARD(realloc(self->buffer, allocated));
+    uint8_t *bytes = self->buffer;
+
+    /* Everything after the kept bits is cleared, including bits a flip may have set past the old size. */
+    if (kept % 8 != 0)
+    {
+        bytes[kept / 8] &= (uint8_t)(0xff << (8 - kept % 8));
+    }
+    uint64_t first_cleared = (kept + 7) / 8;
+    memset(&bytes[first_cleared], 0, allocated - first_cleared);
+
+    self->size = size;
+    self->bytes_needed = bytes_needed;
+}
+
+void dats_bitset_set_range(dats_bitset_t *self, uint64_t first, uint64_t last)
+{
+    _apply_range(self, first, last, _SET);
+}
+
+void dats_bitset_clear_range(dats_bitset_t *self, uint64_t first, uint64_t last)
+{
+    _apply_range(self, first, last, _CLEAR);
+}
+
+void dats_bitset_flip_range(dats_bitset_t *self, uint64_t first, uint64_t last)
+{
+    _apply_range(self, first, last, _FLIP);
+}
+
 void dats_bitset_flip(dats_bitset_t * self)
 {
     uint8_t *bytes = self->buffer;
@@ -105,6 +156,100 @@ bool dats_bitset_is_set_bitset(const dats_bitset_t *self, const dats_bitset_t *o
     return true;
 }
 
+bool dats_bitset_all(const dats_bitset_t *self)
+{
+    uint64_t full_words = self->size / 64;
+
+    /* Whole words are compared to all ones whatever the byte order, only the last partial word needs the layout. */
+    for (uint64_t i = 0; i < full_words; i++)
+    {
+        uint64_t word;
+        memcpy(&word, (const uint8_t *)self->buffer + i * 8, sizeof(uint64_t));
+        if (word != UINT64_MAX)
+        {
+            return false;
+        }
+    }
+
+    if (self->size % 64 != 0)
+    {
+        return dats_bitset_get_word(self, full_words) == dats_bits_valid_mask(self->size, full_words);
+    }
+    return true;
+}
+
+bool dats_bitset_any(const dats_bitset_t *self)
+{
+    uint64_t full_words = self->size / 64;
+
+    for (uint64_t i = 0; i < full_words; i++)
+    {
+        uint64_t word;
+        memcpy(&word, (const uint8_t *)self->buffer + i * 8, sizeof(uint64_t));
+        if (word != 0)
+        {
+            return true;
+        }
+    }
+
+    if (self->size % 64 != 0)
+    {
+        return dats_bitset_get_word(self, full_words) != 0;
+    }
+    return false;
+}
+
+bool dats_bitset_none(const dats_bitset_t *self)
+{
+    return !dats_bitset_any(self);
+}
+
+uint64_t dats_bitset_get_word(const dats_bitset_t *self, uint64_t index)
+{
+    assert(index < (self->size + 63) / 64);
+
+    const uint8_t *bytes = self->buffer;
+    uint64_t first_byte = index * 8;
+    uint64_t word = 0;
+
+    if (first_byte + 8 <= self->bytes_needed)
+    {
+        return dats_bits_load_be64(&bytes[first_byte]);
+    }
+
+    /* The last partial word, only the bytes inside the bitset are read. */
+    for (uint64_t i = 0; i < 8; i++)
+    {
+        word = word << 8;
+        if (first_byte + i < self->bytes_needed)
+        {
+            word |= bytes[first_byte + i];
+        }
+    }
+    return word & dats_bits_valid_mask(self->size, index);
+}
+
+void dats_bitset_set_word(dats_bitset_t *self, uint64_t index, uint64_t word)
+{
+    assert(index < (self->size + 63) / 64);
+
+    uint8_t *bytes = self->buffer;
+    uint64_t first_byte = index * 8;
+
+    word &= dats_bits_valid_mask(self->size, index);
+
+    if (first_byte + 8 <= self->bytes_needed)
+    {
+        dats_bits_store_be64(&bytes[first_byte], word);
+        return;
+    }
+
+    for (uint64_t i = 0; first_byte + i < self->bytes_needed; i++)
+    {
+        bytes[first_byte + i] = (uint8_t)(word >> (56 - 8 * i));
+    }
+}
+
 void dats_bitset_reset(dats_bitset_t *self)
 {
     memset(self->buffer, 0, self->bytes_needed);
@@ -145,3 +290,70 @@ void dats_bitset_free(dats_bitset_t *self)
     self->bytes_needed = 0;
     self->size = 0;
 }
+
+static uint64_t _allocated_bytes(uint64_t bytes_needed)
+{
+    return (bytes_needed + 7) & ~(uint64_t)7;
+}
+
+/*
+ * The edges are updated through 64 bits masks on the first and last words, the words between them are whole: set and
+ * cleared with memset, flipped a word at a time. dats_bitset_set_word drops the bits past the size in the last word.
+ */
+static void _apply_range(dats_bitset_t *self, uint64_t first, uint64_t last, _range_operation_t operation)
+{
+    assert(first > 0);
+    assert(first <= last);
+    assert(last <= self->size);
+
+    uint8_t *bytes = self->buffer;
+    uint64_t first_word = (first - 1) / 64;
+    uint64_t last_word = (last - 1) / 64;
+    uint64_t head_mask = UINT64_MAX >> ((first - 1) % 64);
+    uint64_t tail_mask = UINT64_MAX << (63 - (last - 1) % 64);
+
+    if (first_word == last_word)
+    {
+        _apply_word(self, first_word, head_mask & tail_mask, operation);
+        return;
+    }
+
+    _apply_word(self, first_word, head_mask, operation);
+    _apply_word(self, last_word, tail_mask, operation);
+
+    uint64_t length = (last_word - first_word - 1) * 8;
+    switch (operation)
+    {
+    case _SET:
+        memset(&bytes[(first_word + 1) * 8], 0xff, length);
+        break;
+    case _CLEAR:
+        memset(&bytes[(first_word + 1) * 8], 0, length);
+        break;
+    case _FLIP:
+        for (uint64_t i = first_word + 1; i < last_word; i++)
+        {
+            dats_bitset_set_word(self, i, ~dats_bitset_get_word(self, i));
+        }
+        break;
+    }
+}
+
+static void _apply_word(dats_bitset_t *self, uint64_t index, uint64_t mask, _range_operation_t operation)
+{
+    uint64_t word = dats_bitset_get_word(self, index);
+
+    switch (operation)
+    {
+    case _SET:
+        word |= mask;
+        break;
+    case _CLEAR:
+        word &= ~mask;
+        break;
+    case _FLIP:
+        word ^= mask;
+        break;
+    }
+    dats_bitset_set_word(self, index, word);
+}
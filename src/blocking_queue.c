@@ -0,0 +1,180 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "utils.h"
+#include "blocking_queue.h"
+#include "queue.h"
+
+struct _dats_blocking_queue_sync_t
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t not_empty;
+};
+
+static dats_blocking_queue_status_t _dequeue_locked(dats_blocking_queue_t *self, void *out, const struct timespec *deadline);
+
+dats_blocking_queue_t dats_blocking_queue_new(uint64_t data_size)
+{
+    dats_blocking_queue_sync_t *sync = DATS_OOM_GUARD(malloc(sizeof(dats_blocking_queue_sync_t)));
+
+    /* The timed waits use CLOCK_MONOTONIC so a change of the wall clock doesn't shorten or lengthen them. */
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_mutex_init(&sync->mutex, NULL);
+    pthread_cond_init(&sync->not_empty, &attr);
+    pthread_condattr_destroy(&attr);
+
+    dats_blocking_queue_t bq = {
+        .queue = dats_queue_new(data_size),
+        .sync = sync,
+        .waiting = 0,
+        .closed = false
+    };
+    return bq;
+}
+
+bool dats_blocking_queue_enqueue(dats_blocking_queue_t *self, const void *data)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+
+    if (self->closed)
+    {
+        pthread_mutex_unlock(&self->sync->mutex);
+        return false;
+    }
+
+    dats_queue_enqueue(&self->queue, data);
+    if (self->waiting > 0)
+    {
+        pthread_cond_signal(&self->sync->not_empty);
+    }
+
+    pthread_mutex_unlock(&self->sync->mutex);
+    return true;
+}
+
+bool dats_blocking_queue_enqueue_n(dats_blocking_queue_t *self, const void *data, uint64_t count)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+
+    if (self->closed)
+    {
+        pthread_mutex_unlock(&self->sync->mutex);
+        return false;
+    }
+
+    dats_queue_enqueue_n(&self->queue, data, count);
+    if (self->waiting > 0 && count > 0)
+    {
+        if (count == 1)
+        {
+            pthread_cond_signal(&self->sync->not_empty);
+        }
+        else
+        {
+            pthread_cond_broadcast(&self->sync->not_empty);
+        }
+    }
+
+    pthread_mutex_unlock(&self->sync->mutex);
+    return true;
+}
+
+bool dats_blocking_queue_try_dequeue(dats_blocking_queue_t *self, void *out)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+
+    bool dequeued = dats_queue_length(&self->queue) > 0;
+    if (dequeued)
+    {
+        dats_queue_dequeue_into(&self->queue, out);
+    }
+
+    pthread_mutex_unlock(&self->sync->mutex);
+    return dequeued;
+}
+
+dats_blocking_queue_status_t dats_blocking_queue_dequeue(dats_blocking_queue_t *self, void *out)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+    dats_blocking_queue_status_t status = _dequeue_locked(self, out, NULL);
+    pthread_mutex_unlock(&self->sync->mutex);
+
+    return status;
+}
+
+dats_blocking_queue_status_t dats_blocking_queue_dequeue_wait(dats_blocking_queue_t *self, void *out, uint64_t timeout_ns)
+{
+    /* pthread_cond_timedwait takes an absolute time on the clock of the condition variable, CLOCK_MONOTONIC here. */
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    uint64_t nanoseconds = (uint64_t)deadline.tv_nsec + timeout_ns % 1000000000ull;
+    deadline.tv_sec += (time_t)(timeout_ns / 1000000000ull + nanoseconds / 1000000000ull);
+    deadline.tv_nsec = (long)(nanoseconds % 1000000000ull);
+
+    pthread_mutex_lock(&self->sync->mutex);
+    dats_blocking_queue_status_t status = _dequeue_locked(self, out, &deadline);
+    pthread_mutex_unlock(&self->sync->mutex);
+
+    return status;
+}
+
+void dats_blocking_queue_close(dats_blocking_queue_t *self)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+    self->closed = true;
+    pthread_cond_broadcast(&self->sync->not_empty);
+    pthread_mutex_unlock(&self->sync->mutex);
+}
+
+uint64_t dats_blocking_queue_length(dats_blocking_queue_t *self)
+{
+    pthread_mutex_lock(&self->sync->mutex);
+    uint64_t length = dats_queue_length(&self->queue);
+    pthread_mutex_unlock(&self->sync->mutex);
+
+    return length;
+}
+
+void dats_blocking_queue_free(dats_blocking_queue_t *self)
+{
+    assert(self->waiting == 0);
+
+    dats_queue_free(&self->queue);
+    pthread_cond_destroy(&self->sync->not_empty);
+    pthread_mutex_destroy(&self->sync->mutex);
+    free(self->sync);
+    self->sync = NULL;
+}
+
+/* Must be called with the mutex held. A NULL deadline waits without limit. */
+static dats_blocking_queue_status_t _dequeue_locked(dats_blocking_queue_t *self, void *out, const struct timespec *deadline)
+{
+    while (dats_queue_length(&self->queue) == 0)
+    {
+        if (self->closed)
+        {
+            return DATS_BLOCKING_QUEUE_CLOSED;
+        }
+
+        self->waiting++;
+        int result = deadline == NULL
+            ? pthread_cond_wait(&self->sync->not_empty, &self->sync->mutex)
+            : pthread_cond_timedwait(&self->sync->not_empty, &self->sync->mutex, deadline);
+        self->waiting--;
+
+        if (result == ETIMEDOUT && dats_queue_length(&self->queue) == 0)
+        {
+            return self->closed ? DATS_BLOCKING_QUEUE_CLOSED : DATS_BLOCKING_QUEUE_TIMEOUT;
+        }
+    }
+
+    dats_queue_dequeue_into(&self->queue, out);
+    return DATS_BLOCKING_QUEUE_OK;
+}
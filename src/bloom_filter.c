@@ -0,0 +1,200 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "hash.h"
+#include "bloom_filter.h"
+
+#define LN2 0.69314718055994530942
+/* Bits of the hash used by position inside a block of 512 bits. */
+#define BLOCK_OFFSET_BITS 9
+#define OFFSETS_BY_HASH (64 / BLOCK_OFFSET_BITS)
+
+static dats_bitset_t _new_aligned_bitset(uint64_t bits);
+static void _assert_compatible(const dats_bloom_filter_t *self, const dats_bloom_filter_t *other);
+
+uint64_t dats_bloom_filter_optimal_bits(uint64_t expected_count, double false_positive_rate)
+{
+    assert(expected_count > 0);
+    assert(false_positive_rate > 0.0 && false_positive_rate < 1.0);
+
+    double bits = -(double)expected_count * log(false_positive_rate) / (LN2 * LN2);
+    uint64_t blocks = (uint64_t)ceil(bits / DATS_BLOOM_FILTER_BLOCK_BITS);
+
+    return (blocks > 0 ? blocks : 1) * DATS_BLOOM_FILTER_BLOCK_BITS;
+}
+
+uint64_t dats_bloom_filter_optimal_hash_count(uint64_t bits, uint64_t expected_count)
+{
+    assert(expected_count > 0);
+
+    uint64_t hash_count = (uint64_t)llround((double)bits / (double)expected_count * LN2);
+    return hash_count > 0 ? hash_count : 1;
+}
+
+dats_bloom_filter_t dats_bloom_filter_new(uint64_t data_size, uint64_t expected_count, double false_positive_rate, bool blocked)
+{
+    uint64_t bits = dats_bloom_filter_optimal_bits(expected_count, false_positive_rate);
+
+    return dats_bloom_filter_new_with_size(data_size, bits, dats_bloom_filter_optimal_hash_count(bits, expected_count), DATS_HASH_DEFAULT_SEED, blocked);
+}
+
+dats_bloom_filter_t dats_bloom_filter_new_with_size(uint64_t data_size, uint64_t bits, uint64_t hash_count, uint64_t seed, bool blocked)
+{
+    assert(data_size > 0);
+    assert(bits > 0);
+    assert(hash_count > 0);
+
+    dats_bloom_filter_t bf = {
+        .bits = _new_aligned_bitset(bits),
+        .data_size = data_size,
+        .hash_count = hash_count,
+        .seed = seed,
+        .blocked = blocked
+    };
+    return bf;
+}
+
+void dats_bloom_filter_add(dats_bloom_filter_t *self, const void *data)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+    uint64_t size = self->bits.size;
+
+    if (self->blocked)
+    {
+        uint64_t first = (hash % (size / DATS_BLOOM_FILTER_BLOCK_BITS)) * DATS_BLOOM_FILTER_BLOCK_BITS + 1;
+        uint64_t offsets = dats_hash_mix(hash);
+
+        for (uint64_t i = 0; i < self->hash_count; i++)
+        {
+            if (i > 0 && i % OFFSETS_BY_HASH == 0)
+            {
+                offsets = dats_hash_mix(offsets);
+            }
+            dats_bitset_set(&self->bits, first + (offsets & (DATS_BLOOM_FILTER_BLOCK_BITS - 1)), true);
+            offsets >>= BLOCK_OFFSET_BITS;
+        }
+        return;
+    }
+
+    /* The size is a multiple of 512, an odd step keeps the probes from being confined to part of the bits. */
+    uint64_t position = hash % size;
+    uint64_t step = (dats_hash_mix(hash) % size) | 1;
+
+    for (uint64_t i = 0; i < self->hash_count; i++)
+    {
+        dats_bitset_set(&self->bits, position + 1, true);
+        position += step;
+        if (position >= size)
+        {
+            position -= size;
+        }
+    }
+}
+
+bool dats_bloom_filter_contains(const dats_bloom_filter_t *self, const void *data)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+    uint64_t size = self->bits.size;
+
+    if (self->blocked)
+    {
+        uint64_t first = (hash % (size / DATS_BLOOM_FILTER_BLOCK_BITS)) * DATS_BLOOM_FILTER_BLOCK_BITS + 1;
+        uint64_t offsets = dats_hash_mix(hash);
+
+        for (uint64_t i = 0; i < self->hash_count; i++)
+        {
+            if (i > 0 && i % OFFSETS_BY_HASH == 0)
+            {
+                offsets = dats_hash_mix(offsets);
+            }
+            if (!dats_bitset_is_set(&self->bits, first + (offsets & (DATS_BLOOM_FILTER_BLOCK_BITS - 1))))
+            {
+                return false;
+            }
+            offsets >>= BLOCK_OFFSET_BITS;
+        }
+        return true;
+    }
+
+    uint64_t position = hash % size;
+    uint64_t step = (dats_hash_mix(hash) % size) | 1;
+
+    for (uint64_t i = 0; i < self->hash_count; i++)
+    {
+        if (!dats_bitset_is_set(&self->bits, position + 1))
+        {
+            return false;
+        }
+        position += step;
+        if (position >= size)
+        {
+            position -= size;
+        }
+    }
+    return true;
+}
+
+void dats_bloom_filter_union(dats_bloom_filter_t *self, const dats_bloom_filter_t *other)
+{
+    _assert_compatible(self, other);
+
+    uint64_t *words = self->bits.buffer;
+    const uint64_t *other_words = other->bits.buffer;
+
+    for (uint64_t i = 0; i < self->bits.bytes_needed / 8; i++)
+    {
+        words[i] |= other_words[i];
+    }
+}
+
+void dats_bloom_filter_intersect(dats_bloom_filter_t *self, const dats_bloom_filter_t *other)
+{
+    _assert_compatible(self, other);
+
+    uint64_t *words = self->bits.buffer;
+    const uint64_t *other_words = other->bits.buffer;
+
+    for (uint64_t i = 0; i < self->bits.bytes_needed / 8; i++)
+    {
+        words[i] &= other_words[i];
+    }
+}
+
+void dats_bloom_filter_clear(dats_bloom_filter_t *self)
+{
+    dats_bitset_reset(&self->bits);
+}
+
+void dats_bloom_filter_free(dats_bloom_filter_t *self)
+{
+    dats_bitset_free(&self->bits);
+}
+
+/* Like dats_bitset_new with a size rounded to whole blocks and a buffer starting on a cache line, so each block is exactly one line. */
+static dats_bitset_t _new_aligned_bitset(uint64_t bits)
+{
+    uint64_t blocks = (bits + DATS_BLOOM_FILTER_BLOCK_BITS - 1) / DATS_BLOOM_FILTER_BLOCK_BITS;
+    uint64_t bytes = blocks * DATS_BLOOM_FILTER_BLOCK_BITS / 8;
+
+    dats_bitset_t bt = {
+        .buffer = DATS_OOM_GUARD(aligned_alloc(DATS_BLOOM_FILTER_BLOCK_BITS / 8, bytes)),
+        .size = blocks * DATS_BLOOM_FILTER_BLOCK_BITS,
+        .bytes_needed = bytes
+    };
+    memset(bt.buffer, 0, bytes);
+    return bt;
+}
+
+static void _assert_compatible(const dats_bloom_filter_t *self, const dats_bloom_filter_t *other)
+{
+    assert(self->bits.size == other->bits.size);
+    assert(self->data_size == other->data_size);
+    assert(self->hash_count == other->hash_count);
+    assert(self->seed == other->seed);
+    assert(self->blocked == other->blocked);
+    (void)self;
+    (void)other;
+}
@@ -0,0 +1,141 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "concurrent_stack.h"
+
+/* Index meaning there is no node, the end of a stack. */
+#define NO_NODE UINT32_MAX
+
+/* The data follows the index of the next node, the node size is rounded so the data stays aligned for any type. */
+#define NODE_HEADER_SIZE 16
+
+static _Atomic uint32_t *_node_next(const dats_concurrent_stack_t *self, uint32_t index);
+static uint8_t *_node_data(const dats_concurrent_stack_t *self, uint32_t index);
+static uint32_t _pop_node(const dats_concurrent_stack_t *self, _Atomic uint64_t *top);
+static void _push_node(const dats_concurrent_stack_t *self, _Atomic uint64_t *top, uint32_t index);
+static uint64_t _pack(uint64_t tag, uint32_t index);
+static uint32_t _index(uint64_t top);
+
+dats_concurrent_stack_t dats_concurrent_stack_new(uint64_t data_size, uint64_t capacity)
+{
+    assert(data_size > 0);
+    assert(capacity > 0 && capacity < NO_NODE);
+
+    uint64_t node_size = (NODE_HEADER_SIZE + data_size + 15) & ~(uint64_t)15;
+
+    dats_concurrent_stack_t s = {
+        .nodes = DATS_OOM_GUARD(malloc(capacity * node_size)),
+        .data_size = data_size,
+        .node_size = node_size,
+        .capacity = capacity,
+        .top = _pack(0, NO_NODE),
+        .free_top = _pack(0, 0)
+    };
+
+    for (uint64_t i = 0; i < capacity; i++)
+    {
+        atomic_init(_node_next(&s, (uint32_t)i), i + 1 < capacity ? (uint32_t)(i + 1) : NO_NODE);
+    }
+    return s;
+}
+
+bool dats_concurrent_stack_try_push(dats_concurrent_stack_t *self, const void *data)
+{
+    uint32_t index = _pop_node(self, &self->free_top);
+
+    if (index == NO_NODE)
+    {
+        return false;
+    }
+
+    memcpy(_node_data(self, index), data, self->data_size);
+    _push_node(self, &self->top, index);
+    return true;
+}
+
+bool dats_concurrent_stack_try_pop(dats_concurrent_stack_t *self, void *out)
+{
+    uint32_t index = _pop_node(self, &self->top);
+
+    if (index == NO_NODE)
+    {
+        return false;
+    }
+
+    memcpy(out, _node_data(self, index), self->data_size);
+    _push_node(self, &self->free_top, index);
+    return true;
+}
+
+bool dats_concurrent_stack_is_empty(dats_concurrent_stack_t *self)
+{
+    return _index(atomic_load_explicit(&self->top, memory_order_acquire)) == NO_NODE;
+}
+
+void dats_concurrent_stack_free(dats_concurrent_stack_t *self)
+{
+    free(self->nodes);
+    self->nodes = NULL;
+    atomic_store_explicit(&self->top, _pack(0, NO_NODE), memory_order_relaxed);
+    atomic_store_explicit(&self->free_top, _pack(0, NO_NODE), memory_order_relaxed);
+}
+
+static _Atomic uint32_t *_node_next(const dats_concurrent_stack_t *self, uint32_t index)
+{
+    uint8_t *nodes = self->nodes;
+    return (_Atomic uint32_t *)&nodes[index * self->node_size];
+}
+
+static uint8_t *_node_data(const dats_concurrent_stack_t *self, uint32_t index)
+{
+    uint8_t *nodes = self->nodes;
+    return &nodes[index * self->node_size + NODE_HEADER_SIZE];
+}
+
+/* The next index read may be stale if another thread took the node meanwhile, then the tag makes the compare and swap fail. */
+static uint32_t _pop_node(const dats_concurrent_stack_t *self, _Atomic uint64_t *top)
+{
+    uint64_t old_top = atomic_load_explicit(top, memory_order_acquire);
+
+    for (;;)
+    {
+        uint32_t index = _index(old_top);
+        if (index == NO_NODE)
+        {
+            return NO_NODE;
+        }
+
+        uint32_t next = atomic_load_explicit(_node_next(self, index), memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(top, &old_top, _pack((old_top >> 32) + 1, next), memory_order_acquire, memory_order_acquire))
+        {
+            return index;
+        }
+    }
+}
+
+static void _push_node(const dats_concurrent_stack_t *self, _Atomic uint64_t *top, uint32_t index)
+{
+    uint64_t old_top = atomic_load_explicit(top, memory_order_relaxed);
+
+    for (;;)
+    {
+        atomic_store_explicit(_node_next(self, index), _index(old_top), memory_order_relaxed);
+        if (atomic_compare_exchange_weak_explicit(top, &old_top, _pack((old_top >> 32) + 1, index), memory_order_release, memory_order_relaxed))
+        {
+            return;
+        }
+    }
+}
+
+static uint64_t _pack(uint64_t tag, uint32_t index)
+{
+    return (tag << 32) | index;
+}
+
+static uint32_t _index(uint64_t top)
+{
+    return (uint32_t)top;
+}
@@ -0,0 +1,109 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "hash.h"
+#include "count_min_sketch.h"
+
+#define E 2.71828182845904523536
+
+dats_count_min_sketch_t dats_count_min_sketch_new(uint64_t data_size, double epsilon, double delta)
+{
+    assert(epsilon > 0.0 && epsilon < 1.0);
+    assert(delta > 0.0 && delta < 1.0);
+
+    uint64_t width = (uint64_t)ceil(E / epsilon);
+    uint64_t depth = (uint64_t)ceil(log(1.0 / delta));
+
+    return dats_count_min_sketch_new_with_size(data_size, width, depth > 0 ? depth : 1);
+}
+
+dats_count_min_sketch_t dats_count_min_sketch_new_with_size(uint64_t data_size, uint64_t width, uint64_t depth)
+{
+    assert(data_size > 0);
+    assert(width > 0);
+    assert(depth > 0);
+
+    width = dats_bits_next_power_of_two(width);
+
+    dats_count_min_sketch_t cms = {
+        .counters = DATS_OOM_GUARD(calloc(width * depth, sizeof(uint64_t))),
+        .total = 0,
+        .width = width,
+        .depth = depth,
+        .data_size = data_size,
+        .seed = DATS_HASH_DEFAULT_SEED
+    };
+    return cms;
+}
+
+/* The rows use h1 + row * h2 from a single hash (double hashing), h2 odd to reach every column. */
+void dats_count_min_sketch_add(dats_count_min_sketch_t *self, const void *data, uint64_t count)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+    uint64_t step = dats_hash_mix(hash) | 1;
+    uint64_t *row = self->counters;
+
+    for (uint64_t i = 0; i < self->depth; i++)
+    {
+        row[hash & (self->width - 1)] += count;
+        hash += step;
+        row += self->width;
+    }
+    self->total += count;
+}
+
+uint64_t dats_count_min_sketch_estimate(const dats_count_min_sketch_t *self, const void *data)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+    uint64_t step = dats_hash_mix(hash) | 1;
+    const uint64_t *row = self->counters;
+    uint64_t estimate = UINT64_MAX;
+
+    for (uint64_t i = 0; i < self->depth; i++)
+    {
+        uint64_t counter = row[hash & (self->width - 1)];
+        if (counter < estimate)
+        {
+            estimate = counter;
+        }
+        hash += step;
+        row += self->width;
+    }
+    return estimate;
+}
+
+uint64_t dats_count_min_sketch_total(const dats_count_min_sketch_t *self)
+{
+    return self->total;
+}
+
+void dats_count_min_sketch_merge(dats_count_min_sketch_t *self, const dats_count_min_sketch_t *other)
+{
+    assert(self->width == other->width);
+    assert(self->depth == other->depth);
+    assert(self->data_size == other->data_size);
+    assert(self->seed == other->seed);
+
+    for (uint64_t i = 0; i < self->width * self->depth; i++)
+    {
+        self->counters[i] += other->counters[i];
+    }
+    self->total += other->total;
+}
+
+void dats_count_min_sketch_clear(dats_count_min_sketch_t *self)
+{
+    memset(self->counters, 0, self->width * self->depth * sizeof(uint64_t));
+    self->total = 0;
+}
+
+void dats_count_min_sketch_free(dats_count_min_sketch_t *self)
+{
+    free(self->counters);
+    self->counters = NULL;
+    self->total = 0;
+}
@@ -0,0 +1,279 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "hash.h"
+#include "cuckoo_filter.h"
+
+#define MAX_LOAD 0.95
+/* Padding after the last bucket so a bucket of 6 bytes can always be loaded as 8 bytes. */
+#define PADDING_BYTES 8
+
+static uint64_t _bucket_bytes(const dats_cuckoo_filter_t *self);
+static uint64_t _load(const dats_cuckoo_filter_t *self, uint64_t bucket);
+static void _store(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t word);
+static uint64_t _lanes_equal(const dats_cuckoo_filter_t *self, uint64_t word, uint64_t fingerprint);
+static void _index_and_fingerprint(const dats_cuckoo_filter_t *self, const void *data, uint64_t *bucket, uint64_t *fingerprint);
+static uint64_t _alternate_bucket(const dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint);
+static bool _try_add(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint);
+static bool _try_remove(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint);
+static void _insert_fingerprint(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint);
+static uint64_t _next_random(dats_cuckoo_filter_t *self);
+
+dats_cuckoo_filter_t dats_cuckoo_filter_new(uint64_t data_size, uint64_t capacity, uint64_t fingerprint_bits)
+{
+    assert(data_size > 0);
+    assert(capacity > 0);
+    assert(fingerprint_bits == 8 || fingerprint_bits == 12 || fingerprint_bits == 16);
+
+    uint64_t minimum_buckets = (uint64_t)((double)capacity / (DATS_CUCKOO_FILTER_BUCKET_SIZE * MAX_LOAD)) + 1;
+    uint64_t bucket_count = dats_bits_next_power_of_two(minimum_buckets);
+    uint64_t bytes = bucket_count * fingerprint_bits * DATS_CUCKOO_FILTER_BUCKET_SIZE / 8 + PADDING_BYTES;
+
+    dats_cuckoo_filter_t cf = {
+        .buckets = DATS_OOM_GUARD(calloc(bytes, 1)),
+        .bucket_count = bucket_count,
+        .length = 0,
+        .random_state = DATS_HASH_DEFAULT_SEED,
+        .victim_bucket = 0,
+        .victim_fingerprint = 0,
+        .has_victim = false,
+        .data_size = data_size,
+        .fingerprint_bits = fingerprint_bits,
+        .seed = DATS_HASH_DEFAULT_SEED
+    };
+    return cf;
+}
+
+bool dats_cuckoo_filter_insert(dats_cuckoo_filter_t *self, const void *data)
+{
+    if (self->has_victim)
+    {
+        return false;
+    }
+
+    uint64_t bucket;
+    uint64_t fingerprint;
+    _index_and_fingerprint(self, data, &bucket, &fingerprint);
+
+    _insert_fingerprint(self, bucket, fingerprint);
+    self->length++;
+    return true;
+}
+
+bool dats_cuckoo_filter_contains(const dats_cuckoo_filter_t *self, const void *data)
+{
+    uint64_t bucket;
+    uint64_t fingerprint;
+    _index_and_fingerprint(self, data, &bucket, &fingerprint);
+    uint64_t alternate = _alternate_bucket(self, bucket, fingerprint);
+
+    if (self->has_victim && self->victim_fingerprint == fingerprint
+        && (self->victim_bucket == bucket || self->victim_bucket == alternate))
+    {
+        return true;
+    }
+
+    /* Both buckets are always read, this avoids a branch that the fingerprints make unpredictable. */
+    return (_lanes_equal(self, _load(self, bucket), fingerprint) | _lanes_equal(self, _load(self, alternate), fingerprint)) != 0;
+}
+
+bool dats_cuckoo_filter_remove(dats_cuckoo_filter_t *self, const void *data)
+{
+    uint64_t bucket;
+    uint64_t fingerprint;
+    _index_and_fingerprint(self, data, &bucket, &fingerprint);
+    uint64_t alternate = _alternate_bucket(self, bucket, fingerprint);
+
+    if (!_try_remove(self, bucket, fingerprint) && !_try_remove(self, alternate, fingerprint))
+    {
+        if (!self->has_victim || self->victim_fingerprint != fingerprint
+            || (self->victim_bucket != bucket && self->victim_bucket != alternate))
+        {
+            return false;
+        }
+        self->has_victim = false;
+        self->length--;
+        return true;
+    }
+
+    self->length--;
+
+    /* A slot is free now, the victim gets another chance to find a place. */
+    if (self->has_victim)
+    {
+        self->has_victim = false;
+        _insert_fingerprint(self, self->victim_bucket, self->victim_fingerprint);
+    }
+    return true;
+}
+
+uint64_t dats_cuckoo_filter_length(const dats_cuckoo_filter_t *self)
+{
+    return self->length;
+}
+
+uint64_t dats_cuckoo_filter_capacity(const dats_cuckoo_filter_t *self)
+{
+    return self->bucket_count * DATS_CUCKOO_FILTER_BUCKET_SIZE;
+}
+
+void dats_cuckoo_filter_clear(dats_cuckoo_filter_t *self)
+{
+    memset(self->buckets, 0, self->bucket_count * _bucket_bytes(self) + PADDING_BYTES);
+    self->length = 0;
+    self->has_victim = false;
+    self->random_state = DATS_HASH_DEFAULT_SEED;
+}
+
+void dats_cuckoo_filter_free(dats_cuckoo_filter_t *self)
+{
+    free(self->buckets);
+    self->buckets = NULL;
+    self->bucket_count = 0;
+    self->length = 0;
+    self->has_victim = false;
+}
+
+static uint64_t _bucket_bytes(const dats_cuckoo_filter_t *self)
+{
+    return self->fingerprint_bits * DATS_CUCKOO_FILTER_BUCKET_SIZE / 8;
+}
+
+/*
+ * A bucket is read as one word whose lane i, from the least significant bits, is the slot i. The bytes are stored
+ * little end first so a bucket of 4 or 6 bytes sits in the low bits of the word whatever the machine.
+ */
+static uint64_t _load(const dats_cuckoo_filter_t *self, uint64_t bucket)
+{
+    uint64_t word = dats_bits_load_le64((const uint8_t *)self->buckets + bucket * _bucket_bytes(self));
+
+    return word & (UINT64_MAX >> (64 - self->fingerprint_bits * DATS_CUCKOO_FILTER_BUCKET_SIZE));
+}
+
+/* The whole 8 bytes are written back, the bytes after the bucket are first read again to be kept as they are. */
+static void _store(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t word)
+{
+    uint8_t *address = (uint8_t *)self->buckets + bucket * _bucket_bytes(self);
+    uint64_t bucket_mask = UINT64_MAX >> (64 - self->fingerprint_bits * DATS_CUCKOO_FILTER_BUCKET_SIZE);
+
+    dats_bits_store_le64(address, (dats_bits_load_le64(address) & ~bucket_mask) | word);
+}
+
+/*
+ * The 4 slots are compared at once (SWAR): after the xor a matching lane is zero, and subtracting 1 from each lane
+ * borrows through its high bit only when the lane was zero. The lowest set high bit always marks a true match, a
+ * higher one may come from a borrow and is only used to know that there is at least one.
+ */
+static uint64_t _lanes_equal(const dats_cuckoo_filter_t *self, uint64_t word, uint64_t fingerprint)
+{
+    uint64_t bits = self->fingerprint_bits;
+    uint64_t low_bits = 1 | (1ull << bits) | (1ull << (2 * bits)) | (1ull << (3 * bits));
+    uint64_t high_bits = low_bits << (bits - 1);
+    uint64_t difference = word ^ (fingerprint * low_bits);
+
+    return (difference - low_bits) & ~difference & high_bits;
+}
+
+/* The low bits of the hash give the bucket and the high bits the fingerprint, 0 being kept for the empty slots. */
+static void _index_and_fingerprint(const dats_cuckoo_filter_t *self, const void *data, uint64_t *bucket, uint64_t *fingerprint)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+
+    *bucket = hash & (self->bucket_count - 1);
+    *fingerprint = (hash >> 32) & ((1ull << self->fingerprint_bits) - 1);
+    if (*fingerprint == 0)
+    {
+        *fingerprint = 1;
+    }
+}
+
+/* The xor makes the relation symmetric: the alternate of the alternate bucket is the first one. */
+static uint64_t _alternate_bucket(const dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint)
+{
+    return (bucket ^ (fingerprint * 0x5bd1e995ull)) & (self->bucket_count - 1);
+}
+
+static bool _try_add(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint)
+{
+    uint64_t word = _load(self, bucket);
+    uint64_t empty = _lanes_equal(self, word, 0);
+
+    if (empty == 0)
+    {
+        return false;
+    }
+
+    uint64_t lane = dats_bits_ctz64(empty) / self->fingerprint_bits;
+    _store(self, bucket, word | (fingerprint << (lane * self->fingerprint_bits)));
+    return true;
+}
+
+static bool _try_remove(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint)
+{
+    uint64_t word = _load(self, bucket);
+    uint64_t matching = _lanes_equal(self, word, fingerprint);
+
+    if (matching == 0)
+    {
+        return false;
+    }
+
+    uint64_t lane = dats_bits_ctz64(matching) / self->fingerprint_bits;
+    uint64_t lane_mask = ((1ull << self->fingerprint_bits) - 1) << (lane * self->fingerprint_bits);
+    _store(self, bucket, word & ~lane_mask);
+    return true;
+}
+
+/* Place the fingerprint moving others to their alternate bucket, the one left after the maximum moves becomes the victim. */
+static void _insert_fingerprint(dats_cuckoo_filter_t *self, uint64_t bucket, uint64_t fingerprint)
+{
+    uint64_t alternate = _alternate_bucket(self, bucket, fingerprint);
+
+    if (_try_add(self, bucket, fingerprint) || _try_add(self, alternate, fingerprint))
+    {
+        return;
+    }
+
+    uint64_t bits = self->fingerprint_bits;
+    uint64_t fingerprint_mask = (1ull << bits) - 1;
+
+    if (_next_random(self) & 1)
+    {
+        bucket = alternate;
+    }
+
+    for (uint64_t kick = 0; kick < DATS_CUCKOO_FILTER_MAX_KICKS; kick++)
+    {
+        uint64_t shift = (_next_random(self) % DATS_CUCKOO_FILTER_BUCKET_SIZE) * bits;
+        uint64_t word = _load(self, bucket);
+        uint64_t evicted = (word >> shift) & fingerprint_mask;
+
+        _store(self, bucket, (word & ~(fingerprint_mask << shift)) | (fingerprint << shift));
+        fingerprint = evicted;
+        bucket = _alternate_bucket(self, bucket, fingerprint);
+
+        if (_try_add(self, bucket, fingerprint))
+        {
+            return;
+        }
+    }
+
+    self->victim_bucket = bucket;
+    self->victim_fingerprint = (uint16_t)fingerprint;
+    self->has_victim = true;
+}
+
+/* xorshift64, only used to choose which fingerprint is moved. */
+static uint64_t _next_random(dats_cuckoo_filter_t *self)
+{
+    uint64_t x = self->random_state;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    self->random_state = x;
+    return x;
+}
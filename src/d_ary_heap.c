@@ -0,0 +1,184 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "d_ary_heap.h"
+
+#define INITIAL_CAPACITY 16
+
+static uint8_t *_allocate(uint64_t data_size, uint64_t arity, uint64_t capacity);
+static void _grow(dats_d_ary_heap_t *self);
+static uint8_t *_at(const dats_d_ary_heap_t *self, uint64_t index);
+static void _sift_up(dats_d_ary_heap_t *self, uint64_t index);
+static void _sift_down(dats_d_ary_heap_t *self, uint64_t index);
+
+dats_d_ary_heap_t dats_d_ary_heap_new(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b))
+{
+    return dats_d_ary_heap_from_array(data_size, arity, compare, NULL, 0);
+}
+
+dats_d_ary_heap_t dats_d_ary_heap_from_array(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b), const void *data, uint64_t count)
+{
+    assert(data_size > 0);
+    assert(arity >= 2);
+    assert(compare != NULL);
+
+    uint64_t capacity = count > INITIAL_CAPACITY ? count : INITIAL_CAPACITY;
+
+    dats_d_ary_heap_t heap = {
+        .buffer = _allocate(data_size, arity, capacity),
+        .length = count,
+        .capacity = capacity,
+        .data_size = data_size,
+        .compare = compare,
+        .arity = arity,
+        .scratch = DATS_OOM_GUARD(malloc(data_size))
+    };
+
+    if (count > 0)
+    {
+        memcpy(_at(&heap, 0), data, count * data_size);
+    }
+
+    /* Floyd's heap construction from the last parent, (count - 2) / arity. */
+    for (uint64_t i = count > 1 ? (count - 2) / arity + 1 : 0; i > 0; i--)
+    {
+        _sift_down(&heap, i - 1);
+    }
+    return heap;
+}
+
+void dats_d_ary_heap_push(dats_d_ary_heap_t *self, const void *data)
+{
+    if (self->length == self->capacity)
+    {
+        _grow(self);
+    }
+
+    memcpy(_at(self, self->length), data, self->data_size);
+    self->length++;
+    _sift_up(self, self->length - 1);
+}
+
+void dats_d_ary_heap_pop_into(dats_d_ary_heap_t *self, void *out)
+{
+    assert(self->length > 0);
+
+    memcpy(out, _at(self, 0), self->data_size);
+
+    self->length--;
+    if (self->length > 0)
+    {
+        memcpy(_at(self, 0), _at(self, self->length), self->data_size);
+        _sift_down(self, 0);
+    }
+}
+
+const void *dats_d_ary_heap_peek(const dats_d_ary_heap_t *self)
+{
+    assert(self->length > 0);
+
+    return _at(self, 0);
+}
+
+uint64_t dats_d_ary_heap_length(const dats_d_ary_heap_t *self)
+{
+    return self->length;
+}
+
+void dats_d_ary_heap_clear(dats_d_ary_heap_t *self)
+{
+    self->length = 0;
+}
+
+void dats_d_ary_heap_free(dats_d_ary_heap_t *self)
+{
+    free(self->buffer);
+    free(self->scratch);
+    self->buffer = NULL;
+    self->scratch = NULL;
+    self->length = 0;
+    self->capacity = 0;
+}
+
+/* Room for the arity - 1 padding slots and capacity data, rounded to whole cache lines as aligned_alloc needs. */
+static uint8_t *_allocate(uint64_t data_size, uint64_t arity, uint64_t capacity)
+{
+    uint64_t bytes = (capacity + arity - 1) * data_size;
+    bytes = (bytes + DATS_D_ARY_HEAP_ALIGNMENT - 1) & ~(uint64_t)(DATS_D_ARY_HEAP_ALIGNMENT - 1);
+
+    return DATS_OOM_GUARD(aligned_alloc(DATS_D_ARY_HEAP_ALIGNMENT, bytes));
+}
+
+static void _grow(dats_d_ary_heap_t *self)
+{
+    uint64_t capacity = self->capacity * 2;
+    uint8_t *buffer = _allocate(self->data_size, self->arity, capacity);
+
+    memcpy(buffer, self->buffer, (self->length + self->arity - 1) * self->data_size);
+    free(self->buffer);
+    self->buffer = buffer;
+    self->capacity = capacity;
+}
+
+/* The data i is in the slot i + arity - 1, so the first child of i is in the slot arity * (i + 1). */
+static uint8_t *_at(const dats_d_ary_heap_t *self, uint64_t index)
+{
+    return &self->buffer[(index + self->arity - 1) * self->data_size];
+}
+
+/* The moving data waits in scratch while the parents it beats are moved down, then it's copied once into the hole. */
+static void _sift_up(dats_d_ary_heap_t *self, uint64_t index)
+{
+    uint64_t data_size = self->data_size;
+    memcpy(self->scratch, _at(self, index), data_size);
+
+    while (index > 0)
+    {
+        uint64_t parent = (index - 1) / self->arity;
+        if (self->compare(self->scratch, _at(self, parent)) >= 0)
+        {
+            break;
+        }
+        memcpy(_at(self, index), _at(self, parent), data_size);
+        index = parent;
+    }
+
+    memcpy(_at(self, index), self->scratch, data_size);
+}
+
+static void _sift_down(dats_d_ary_heap_t *self, uint64_t index)
+{
+    uint64_t data_size = self->data_size;
+    uint64_t length = self->length;
+    memcpy(self->scratch, _at(self, index), data_size);
+
+    for (;;)
+    {
+        uint64_t first_child = self->arity * index + 1;
+        if (first_child >= length)
+        {
+            break;
+        }
+
+        uint64_t last_child = first_child + self->arity < length ? first_child + self->arity : length;
+        uint64_t best = first_child;
+        for (uint64_t child = first_child + 1; child < last_child; child++)
+        {
+            if (self->compare(_at(self, child), _at(self, best)) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (self->compare(_at(self, best), self->scratch) >= 0)
+        {
+            break;
+        }
+        memcpy(_at(self, index), _at(self, best), data_size);
+        index = best;
+    }
+
+    memcpy(_at(self, index), self->scratch, data_size);
+}
@@ -0,0 +1,409 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "doubly_linked_list.h"
+
+static dats_doubly_node_t *_alloc_node(uint64_t data_size, const void *data);
+static void *_free_node(dats_doubly_node_t *node_to_free);
+static void _move_data(void *data, void *out, uint64_t data_size);
+static dats_doubly_node_t *_get_node(const dats_doubly_linked_list_t *self, uint64_t index);
+static void _insert_before_node(dats_doubly_linked_list_t *self, dats_doubly_node_t *node, const void *data);
+
+dats_doubly_linked_list_t dats_doubly_linked_list_new(uint64_t data_size)
+{
+    assert(data_size > 0);
+
+    dats_doubly_linked_list_t dll = {
+        .head = NULL,
+        .tail = NULL,
+        .data_size = data_size,
+        .length = 0
+    };
+    return dll;
+}
+
+const void *dats_doubly_linked_list_get(const dats_doubly_linked_list_t *self, uint64_t index)
+{
+    assert(index < self->length);
+
+    return _get_node(self, index)->data;
+}
+
+dats_doubly_node_t *dats_doubly_linked_list_get_node(const dats_doubly_linked_list_t *self, uint64_t index)
+{
+    assert(index < self->length);
+
+    return _get_node(self, index);
+}
+
+const void *dats_doubly_linked_list_get_head(const dats_doubly_linked_list_t *self)
+{
+    assert(self->length > 0);
+
+    return self->head->data;
+}
+
+const void *dats_doubly_linked_list_get_tail(const dats_doubly_linked_list_t *self)
+{
+    assert(self->length > 0);
+
+    return self->tail->data;
+}
+
+void dats_doubly_linked_list_insert_head(dats_doubly_linked_list_t *self, const void *data)
+{
+    dats_doubly_node_t *node = _alloc_node(self->data_size, data);
+
+    node->next_node = self->head;
+    if (self->head != NULL)
+    {
+        self->head->previous_node = node;
+    }
+    else
+    {
+        self->tail = node;
+    }
+    self->head = node;
+    self->length++;
+}
+
+void dats_doubly_linked_list_insert_tail(dats_doubly_linked_list_t *self, const void *data)
+{
+    dats_doubly_node_t *node = _alloc_node(self->data_size, data);
+
+    node->previous_node = self->tail;
+    if (self->tail != NULL)
+    {
+        self->tail->next_node = node;
+    }
+    else
+    {
+        self->head = node;
+    }
+    self->tail = node;
+    self->length++;
+}
+
+void dats_doubly_linked_list_insert_index(dats_doubly_linked_list_t *self, uint64_t index, const void *data)
+{
+    assert(index <= self->length);
+
+    if (index == 0)
+    {
+        dats_doubly_linked_list_insert_head(self, data);
+    }
+    else if (index == self->length)
+    {
+        dats_doubly_linked_list_insert_tail(self, data);
+    }
+    else
+    {
+        _insert_before_node(self, _get_node(self, index), data);
+    }
+}
+
+void *dats_doubly_linked_list_remove_head(dats_doubly_linked_list_t *self)
+{
+    assert(self->length > 0);
+
+    return dats_doubly_linked_list_remove_node(self, self->head);
+}
+
+void *dats_doubly_linked_list_remove_tail(dats_doubly_linked_list_t *self)
+{
+    assert(self->length > 0);
+
+    return dats_doubly_linked_list_remove_node(self, self->tail);
+}
+
+void *dats_doubly_linked_list_remove_index(dats_doubly_linked_list_t *self, uint64_t index)
+{
+    assert(index < self->length);
+
+    return dats_doubly_linked_list_remove_node(self, _get_node(self, index));
+}
+
+void dats_doubly_linked_list_remove_head_into(dats_doubly_linked_list_t *self, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_doubly_linked_list_remove_head(self), out, self->data_size);
+}
+
+void dats_doubly_linked_list_remove_head_discard(dats_doubly_linked_list_t *self)
+{
+    _move_data(dats_doubly_linked_list_remove_head(self), NULL, self->data_size);
+}
+
+void dats_doubly_linked_list_remove_tail_into(dats_doubly_linked_list_t *self, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_doubly_linked_list_remove_tail(self), out, self->data_size);
+}
+
+void dats_doubly_linked_list_remove_tail_discard(dats_doubly_linked_list_t *self)
+{
+    _move_data(dats_doubly_linked_list_remove_tail(self), NULL, self->data_size);
+}
+
+void dats_doubly_linked_list_remove_index_into(dats_doubly_linked_list_t *self, uint64_t index, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_doubly_linked_list_remove_index(self, index), out, self->data_size);
+}
+
+void dats_doubly_linked_list_remove_index_discard(dats_doubly_linked_list_t *self, uint64_t index)
+{
+    _move_data(dats_doubly_linked_list_remove_index(self, index), NULL, self->data_size);
+}
+
+void dats_doubly_linked_list_insert_head_n(dats_doubly_linked_list_t *self, const void *data, uint64_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const uint8_t *bytes = data;
+    dats_doubly_node_t *last_node = _alloc_node(self->data_size, bytes);
+
+    /* The chain is built from its end, each new node goes in front of the previous one. */
+    dats_doubly_node_t *first_node = last_node;
+    for (uint64_t i = 1; i < count; i++)
+    {
+        dats_doubly_node_t *node = _alloc_node(self->data_size, &bytes[i * self->data_size]);
+        node->next_node = first_node;
+        first_node->previous_node = node;
+        first_node = node;
+    }
+
+    last_node->next_node = self->head;
+    if (self->head != NULL)
+    {
+        self->head->previous_node = last_node;
+    }
+    else
+    {
+        self->tail = last_node;
+    }
+    self->head = first_node;
+    self->length += count;
+}
+
+void dats_doubly_linked_list_remove_tail_n_into(dats_doubly_linked_list_t *self, void *out, uint64_t count)
+{
+    assert(count <= self->length);
+    assert(count == 0 || out != NULL);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    dats_doubly_node_t *node = self->tail;
+    dats_doubly_node_t *first_node = node;
+    for (uint64_t i = 1; i < count; i++)
+    {
+        first_node = first_node->previous_node;
+    }
+
+    self->tail = first_node->previous_node;
+    if (self->tail != NULL)
+    {
+        self->tail->next_node = NULL;
+    }
+    else
+    {
+        self->head = NULL;
+    }
+    self->length -= count;
+
+    uint8_t *bytes = out;
+    for (uint64_t i = 0; i < count; i++)
+    {
+        dats_doubly_node_t *previous_node = node->previous_node;
+        _move_data(_free_node(node), &bytes[i * self->data_size], self->data_size);
+        node = previous_node;
+    }
+}
+
+void *dats_doubly_linked_list_remove_node(dats_doubly_linked_list_t *self, dats_doubly_node_t *node)
+{
+    assert(self->length > 0);
+    assert(node != NULL);
+
+    if (node->previous_node != NULL)
+    {
+        node->previous_node->next_node = node->next_node;
+    }
+    else
+    {
+        self->head = node->next_node;
+    }
+
+    if (node->next_node != NULL)
+    {
+        node->next_node->previous_node = node->previous_node;
+    }
+    else
+    {
+        self->tail = node->previous_node;
+    }
+
+    self->length--;
+    return _free_node(node);
+}
+
+void dats_doubly_linked_list_map(const dats_doubly_linked_list_t *self, void (*func)(const void *data))
+{
+    dats_doubly_node_t *current_node = self->head;
+
+    while (current_node != NULL)
+    {
+        dats_doubly_node_t *next_node = current_node->next_node;
+
+        func(current_node->data);
+
+        current_node = next_node;
+    }
+}
+
+void dats_doubly_linked_list_map_reverse(const dats_doubly_linked_list_t *self, void (*func)(const void *data))
+{
+    dats_doubly_node_t *current_node = self->tail;
+
+    while (current_node != NULL)
+    {
+        dats_doubly_node_t *previous_node = current_node->previous_node;
+
+        func(current_node->data);
+
+        current_node = previous_node;
+    }
+}
+
+uint64_t dats_doubly_linked_list_find(const dats_doubly_linked_list_t *self, const void *data)
+{
+    assert(self->length > 0);
+
+    dats_doubly_node_t *current_node = self->head;
+
+    for (uint64_t index = 0; current_node != NULL; index++)
+    {
+        if (memcmp(current_node->data, data, self->data_size) == 0)
+        {
+            return index;
+        }
+        current_node = current_node->next_node;
+    }
+
+    DATS_RAISE_ERROR("Unable to find data");
+    exit(EXIT_FAILURE);
+}
+
+bool dats_doubly_linked_list_contains(const dats_doubly_linked_list_t *self, const void *data)
+{
+    for (dats_doubly_node_t *current_node = self->head; current_node != NULL; current_node = current_node->next_node)
+    {
+        if (memcmp(current_node->data, data, self->data_size) == 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t dats_doubly_linked_list_length(const dats_doubly_linked_list_t *self)
+{
+    return self->length;
+}
+
+void dats_doubly_linked_list_clear(dats_doubly_linked_list_t *self)
+{
+    dats_doubly_linked_list_free(self);
+}
+
+void dats_doubly_linked_list_free(dats_doubly_linked_list_t *self)
+{
+    dats_doubly_node_t *current_node = self->head;
+
+    while (current_node != NULL)
+    {
+        dats_doubly_node_t *next_node = current_node->next_node;
+
+        free(current_node->data);
+        current_node->data = NULL;
+        free(current_node);
+
+        current_node = next_node;
+    }
+
+    self->head = NULL;
+    self->tail = NULL;
+    self->length = 0;
+}
+
+static dats_doubly_node_t *_alloc_node(uint64_t data_size, const void *data)
+{
+    dats_doubly_node_t *node = DATS_OOM_GUARD(malloc(sizeof(dats_doubly_node_t)));
+    node->data = DATS_OOM_GUARD(malloc(data_size));
+    memcpy(node->data, data, data_size);
+    node->next_node = NULL;
+    node->previous_node = NULL;
+    return node;
+}
+
+static void *_free_node(dats_doubly_node_t *node_to_free)
+{
+    void *data = node_to_free->data;
+    free(node_to_free);
+    return data;
+}
+
+static dats_doubly_node_t *_get_node(const dats_doubly_linked_list_t *self, uint64_t index)
+{
+    dats_doubly_node_t *node;
+
+    if (index < self->length / 2)
+    {
+        node = self->head;
+        for (uint64_t i = 0; i < index; i++)
+        {
+            node = node->next_node;
+        }
+    }
+    else
+    {
+        node = self->tail;
+        for (uint64_t i = self->length - 1; i > index; i--)
+        {
+            node = node->previous_node;
+        }
+    }
+    return node;
+}
+
+static void _insert_before_node(dats_doubly_linked_list_t *self, dats_doubly_node_t *node, const void *data)
+{
+    dats_doubly_node_t *new_node = _alloc_node(self->data_size, data);
+
+    new_node->next_node = node;
+    new_node->previous_node = node->previous_node;
+    node->previous_node->next_node = new_node;
+    node->previous_node = new_node;
+    self->length++;
+}
+
+static void _move_data(void *data, void *out, uint64_t data_size)
+{
+    if (out != NULL)
+    {
+        memcpy(out, data, data_size);
+    }
+    free(data);
+}
@@ -0,0 +1,195 @@
+#include "bits.h"
+#include "hash.h"
+
+/* Default secret of wyhash final 4, odd numbers with 32 set bits chosen for the multiplications. */
+#define SECRET_0 0x2d358dccaa6c78a5ull
+#define SECRET_1 0x8bb84b93962eacc9ull
+#define SECRET_2 0x4b33a62ed433d4a3ull
+#define SECRET_3 0x4d5a2da51de1aa47ull
+
+static void _multiply(uint64_t *a, uint64_t *b);
+static uint64_t _mix(uint64_t a, uint64_t b);
+static uint64_t _prepare_seed(uint64_t seed);
+static uint64_t _finish(uint64_t a, uint64_t b, uint64_t size, uint64_t seed);
+static uint64_t _hash(const uint8_t *bytes, uint64_t size, uint64_t seed);
+static uint64_t _hash_4(const uint8_t *bytes, uint64_t seed);
+static uint64_t _hash_8(const uint8_t *bytes, uint64_t seed);
+static uint64_t _hash_16(const uint8_t *bytes, uint64_t seed);
+
+uint64_t dats_hash_bytes(const void *data, uint64_t size, uint64_t seed)
+{
+    return _hash(data, size, _prepare_seed(seed));
+}
+
+uint64_t dats_hash_4(const void *data, uint64_t seed)
+{
+    return _hash_4(data, _prepare_seed(seed));
+}
+
+uint64_t dats_hash_8(const void *data, uint64_t seed)
+{
+    return _hash_8(data, _prepare_seed(seed));
+}
+
+uint64_t dats_hash_16(const void *data, uint64_t seed)
+{
+    return _hash_16(data, _prepare_seed(seed));
+}
+
+void dats_hash_n(const void *data, uint64_t count, uint64_t size, uint64_t seed, uint64_t *out)
+{
+    const uint8_t *bytes = data;
+    seed = _prepare_seed(seed);
+
+    switch (size)
+    {
+    case 4:
+        for (uint64_t i = 0; i < count; i++)
+        {
+            out[i] = _hash_4(&bytes[i * 4], seed);
+        }
+        break;
+    case 8:
+        for (uint64_t i = 0; i < count; i++)
+        {
+            out[i] = _hash_8(&bytes[i * 8], seed);
+        }
+        break;
+    case 16:
+        for (uint64_t i = 0; i < count; i++)
+        {
+            out[i] = _hash_16(&bytes[i * 16], seed);
+        }
+        break;
+    default:
+        for (uint64_t i = 0; i < count; i++)
+        {
+            out[i] = _hash(&bytes[i * size], size, seed);
+        }
+        break;
+    }
+}
+
+/* Full 64 x 64 bits multiplication, a receives the low half of the 128 bits product and b the high half. */
+static void _multiply(uint64_t *a, uint64_t *b)
+{
+#if defined(__SIZEOF_INT128__)
+    __uint128_t product = (__uint128_t)*a * *b;
+    *a = (uint64_t)product;
+    *b = (uint64_t)(product >> 64);
+#else
+    uint64_t a_high = *a >> 32, a_low = (uint32_t)*a;
+    uint64_t b_high = *b >> 32, b_low = (uint32_t)*b;
+    uint64_t high_low = a_high * b_low, low_high = a_low * b_high, low_low = a_low * b_low;
+    uint64_t partial = low_low + (high_low << 32);
+    uint64_t carry = partial < low_low;
+    uint64_t low = partial + (low_high << 32);
+
+    carry += low < partial;
+    *b = a_high * b_high + (high_low >> 32) + (low_high >> 32) + carry;
+    *a = low;
+#endif
+}
+
+/* The two halves of the product folded with a xor. */
+static uint64_t _mix(uint64_t a, uint64_t b)
+{
+    _multiply(&a, &b);
+    return a ^ b;
+}
+
+static uint64_t _prepare_seed(uint64_t seed)
+{
+    return seed ^ _mix(seed ^ SECRET_0, SECRET_1);
+}
+
+static uint64_t _finish(uint64_t a, uint64_t b, uint64_t size, uint64_t seed)
+{
+    a ^= SECRET_1;
+    b ^= seed;
+    _multiply(&a, &b);
+    return _mix(a ^ SECRET_0 ^ size, b ^ SECRET_1);
+}
+
+/*
+ * Up to 16 bytes the key is read as two overlapping pairs of 4 bytes words, above it's consumed by 16 bytes, or by
+ * 48 bytes in three independent lanes, and the last 16 bytes are read again from the end.
+ */
+static uint64_t _hash(const uint8_t *bytes, uint64_t size, uint64_t seed)
+{
+    uint64_t a;
+    uint64_t b;
+
+    if (size <= 16)
+    {
+        if (size >= 4)
+        {
+            uint64_t offset = (size >> 3) << 2;
+            a = (dats_bits_load_le32(bytes) << 32) | dats_bits_load_le32(&bytes[offset]);
+            b = (dats_bits_load_le32(&bytes[size - 4]) << 32) | dats_bits_load_le32(&bytes[size - 4 - offset]);
+        }
+        else if (size > 0)
+        {
+            a = ((uint64_t)bytes[0] << 16) | ((uint64_t)bytes[size >> 1] << 8) | bytes[size - 1];
+            b = 0;
+        }
+        else
+        {
+            a = 0;
+            b = 0;
+        }
+        return _finish(a, b, size, seed);
+    }
+
+    uint64_t remaining = size;
+    if (remaining > 48)
+    {
+        uint64_t second_seed = seed;
+        uint64_t third_seed = seed;
+
+        do
+        {
+            seed = _mix(dats_bits_load_le64(bytes) ^ SECRET_1, dats_bits_load_le64(&bytes[8]) ^ seed);
+            second_seed = _mix(dats_bits_load_le64(&bytes[16]) ^ SECRET_2, dats_bits_load_le64(&bytes[24]) ^ second_seed);
+            third_seed = _mix(dats_bits_load_le64(&bytes[32]) ^ SECRET_3, dats_bits_load_le64(&bytes[40]) ^ third_seed);
+            bytes += 48;
+            remaining -= 48;
+        } while (remaining > 48);
+        seed ^= second_seed ^ third_seed;
+    }
+
+    while (remaining > 16)
+    {
+        seed = _mix(dats_bits_load_le64(bytes) ^ SECRET_1, dats_bits_load_le64(&bytes[8]) ^ seed);
+        bytes += 16;
+        remaining -= 16;
+    }
+
+    a = dats_bits_load_le64(&bytes[remaining] - 16);
+    b = dats_bits_load_le64(&bytes[remaining] - 8);
+    return _finish(a, b, size, seed);
+}
+
+static uint64_t _hash_4(const uint8_t *bytes, uint64_t seed)
+{
+    uint64_t word = dats_bits_load_le32(bytes);
+    uint64_t a = (word << 32) | word;
+
+    return _finish(a, a, 4, seed);
+}
+
+static uint64_t _hash_8(const uint8_t *bytes, uint64_t seed)
+{
+    uint64_t low = dats_bits_load_le32(bytes);
+    uint64_t high = dats_bits_load_le32(&bytes[4]);
+
+    return _finish((low << 32) | high, (high << 32) | low, 8, seed);
+}
+
+static uint64_t _hash_16(const uint8_t *bytes, uint64_t seed)
+{
+    uint64_t a = (dats_bits_load_le32(bytes) << 32) | dats_bits_load_le32(&bytes[8]);
+    uint64_t b = (dats_bits_load_le32(&bytes[12]) << 32) | dats_bits_load_le32(&bytes[4]);
+
+    return _finish(a, b, 16, seed);
+}
@@ -0,0 +1,293 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "bits.h"
+#include "hibitset.h"
+
+/* Bit of a word for the position at the given offset, the first position being the most significant bit. */
+#define OFFSET_MASK(offset) (0x8000000000000000ull >> (offset))
+
+static uint64_t _get_word(const dats_hibitset_t *self, uint64_t level, uint64_t index);
+static void _set_word(dats_hibitset_t *self, uint64_t level, uint64_t index, uint64_t word);
+static bool _and_block(dats_hibitset_t *self, const dats_hibitset_t *other, uint64_t level, uint64_t index);
+static void _or_block(dats_hibitset_t *self, const dats_hibitset_t *other, uint64_t level, uint64_t index);
+static void _clear_block(dats_hibitset_t *self, uint64_t level, uint64_t index);
+static uint64_t _count_block(const dats_hibitset_t *self, uint64_t level, uint64_t index);
+static void _map_block(const dats_hibitset_t *self, uint64_t level, uint64_t index, void (*func)(uint64_t position));
+
+dats_hibitset_t dats_hibitset_new(uint64_t size)
+{
+    assert(size > 0);
+
+    dats_hibitset_t hbs = {
+        .level_count = 0,
+        .size = size
+    };
+
+    uint64_t level_size = size;
+    while (true)
+    {
+        hbs.levels[hbs.level_count] = dats_bitset_new(level_size);
+        hbs.level_count++;
+
+        if (level_size <= 64)
+        {
+            break;
+        }
+        level_size = (level_size + 63) / 64;
+    }
+
+    return hbs;
+}
+
+void dats_hibitset_set(dats_hibitset_t *self, uint64_t position, bool state)
+{
+    assert(position > 0);
+    assert(position <= self->size);
+
+    uint64_t index = position - 1;
+
+    for (uint64_t level = 0; level < self->level_count; level++)
+    {
+        uint64_t word = _get_word(self, level, index / 64);
+        uint64_t mask = OFFSET_MASK(index % 64);
+
+        if (state == true)
+        {
+            /* The summaries above an already set bit are already set. */
+            if ((word & mask) != 0)
+            {
+                return;
+            }
+            _set_word(self, level, index / 64, word | mask);
+        }
+        else
+        {
+            word &= ~mask;
+            _set_word(self, level, index / 64, word);
+
+            /* The word still has a bit set so its summary bit stays. */
+            if (word != 0)
+            {
+                return;
+            }
+        }
+        index /= 64;
+    }
+}
+
+bool dats_hibitset_is_set(const dats_hibitset_t *self, uint64_t position)
+{
+    return dats_bitset_is_set(&self->levels[0], position);
+}
+
+bool dats_hibitset_is_empty(const dats_hibitset_t *self)
+{
+    return _get_word(self, self->level_count - 1, 0) == 0;
+}
+
+uint64_t dats_hibitset_next_set(const dats_hibitset_t *self, uint64_t position)
+{
+    assert(position > 0);
+
+    uint64_t level = 0;
+    uint64_t index = position - 1;
+
+    while (true)
+    {
+        if (index < self->levels[level].size)
+        {
+            uint64_t word = _get_word(self, level, index / 64) & (UINT64_MAX >> (index % 64));
+
+            if (word != 0)
+            {
+                index = (index & ~(uint64_t)63) + dats_bits_clz64(word);
+
+                /* Every summary bit set leads to a non empty word below it. */
+                while (level > 0)
+                {
+                    level--;
+                    index = index * 64 + dats_bits_clz64(_get_word(self, level, index));
+                }
+                return index + 1;
+            }
+        }
+
+        if (level + 1 == self->level_count)
+        {
+            return 0;
+        }
+
+        /* The rest of this word is empty, continue from the next word summarized one level up. */
+        index = index / 64 + 1;
+        level++;
+    }
+}
+
+uint64_t dats_hibitset_count(const dats_hibitset_t *self)
+{
+    return _count_block(self, self->level_count - 1, 0);
+}
+
+void dats_hibitset_map(const dats_hibitset_t *self, void (*func)(uint64_t position))
+{
+    _map_block(self, self->level_count - 1, 0, func);
+}
+
+void dats_hibitset_and(dats_hibitset_t *self, const dats_hibitset_t *other)
+{
+    assert(self->size == other->size);
+
+    _and_block(self, other, self->level_count - 1, 0);
+}
+
+void dats_hibitset_or(dats_hibitset_t *self, const dats_hibitset_t *other)
+{
+    assert(self->size == other->size);
+
+    _or_block(self, other, self->level_count - 1, 0);
+}
+
+void dats_hibitset_reset(dats_hibitset_t *self)
+{
+    _clear_block(self, self->level_count - 1, 0);
+}
+
+void dats_hibitset_free(dats_hibitset_t *self)
+{
+    for (uint64_t level = 0; level < self->level_count; level++)
+    {
+        dats_bitset_free(&self->levels[level]);
+    }
+    self->level_count = 0;
+    self->size = 0;
+}
+
+static uint64_t _get_word(const dats_hibitset_t *self, uint64_t level, uint64_t index)
+{
+    return dats_bitset_get_word(&self->levels[level], index);
+}
+
+static void _set_word(dats_hibitset_t *self, uint64_t level, uint64_t index, uint64_t word)
+{
+    dats_bitset_set_word(&self->levels[level], index, word);
+}
+
+/* Returns true if the word is still non empty after the intersection. */
+static bool _and_block(dats_hibitset_t *self, const dats_hibitset_t *other, uint64_t level, uint64_t index)
+{
+    uint64_t word = _get_word(self, level, index);
+
+    if (word == 0)
+    {
+        return false;
+    }
+
+    if (level == 0)
+    {
+        word &= _get_word(other, 0, index);
+        _set_word(self, 0, index, word);
+        return word != 0;
+    }
+
+    uint64_t common = word & _get_word(other, level, index);
+    uint64_t remaining = word;
+
+    while (remaining != 0)
+    {
+        uint64_t offset = dats_bits_clz64(remaining);
+        uint64_t mask = OFFSET_MASK(offset);
+        remaining &= ~mask;
+
+        if ((common & mask) == 0)
+        {
+            _clear_block(self, level - 1, index * 64 + offset);
+            word &= ~mask;
+        }
+        else if (!_and_block(self, other, level - 1, index * 64 + offset))
+        {
+            word &= ~mask;
+        }
+    }
+
+    _set_word(self, level, index, word);
+    return word != 0;
+}
+
+static void _or_block(dats_hibitset_t *self, const dats_hibitset_t *other, uint64_t level, uint64_t index)
+{
+    uint64_t other_word = _get_word(other, level, index);
+
+    if (other_word == 0)
+    {
+        return;
+    }
+
+    if (level > 0)
+    {
+        for (uint64_t remaining = other_word; remaining != 0; remaining &= remaining - 1)
+        {
+            _or_block(self, other, level - 1, index * 64 + 63 - dats_bits_ctz64(remaining));
+        }
+    }
+
+    _set_word(self, level, index, _get_word(self, level, index) | other_word);
+}
+
+static void _clear_block(dats_hibitset_t *self, uint64_t level, uint64_t index)
+{
+    uint64_t word = _get_word(self, level, index);
+
+    if (word == 0)
+    {
+        return;
+    }
+
+    if (level > 0)
+    {
+        for (uint64_t remaining = word; remaining != 0; remaining &= remaining - 1)
+        {
+            _clear_block(self, level - 1, index * 64 + 63 - dats_bits_ctz64(remaining));
+        }
+    }
+
+    _set_word(self, level, index, 0);
+}
+
+static uint64_t _count_block(const dats_hibitset_t *self, uint64_t level, uint64_t index)
+{
+    uint64_t word = _get_word(self, level, index);
+
+    if (level == 0)
+    {
+        return dats_bits_popcount64(word);
+    }
+
+    uint64_t count = 0;
+    for (uint64_t remaining = word; remaining != 0; remaining &= remaining - 1)
+    {
+        count += _count_block(self, level - 1, index * 64 + 63 - dats_bits_ctz64(remaining));
+    }
+    return count;
+}
+
+static void _map_block(const dats_hibitset_t *self, uint64_t level, uint64_t index, void (*func)(uint64_t position))
+{
+    uint64_t remaining = _get_word(self, level, index);
+
+    /* Walking from the most significant bit keeps the positions in increasing order. */
+    while (remaining != 0)
+    {
+        uint64_t offset = dats_bits_clz64(remaining);
+        remaining &= ~OFFSET_MASK(offset);
+
+        if (level == 0)
+        {
+            func(index * 64 + offset + 1);
+        }
+        else
+        {
+            _map_block(self, level - 1, index * 64 + offset, func);
+        }
+    }
+}
@@ -0,0 +1,304 @@
+#include <assert.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "hash.h"
+#include "hyperloglog.h"
+
+#define INITIAL_SPARSE_CAPACITY 16
+/* A sparse entry is the register index followed by 6 bits of rank, the rank is at most 61. */
+#define RANK_BITS 6
+#define RANK_MASK 0x3fu
+
+static uint64_t _register_count(const dats_hyperloglog_t *self);
+static uint64_t _sparse_limit(const dats_hyperloglog_t *self);
+static void _add_entry(dats_hyperloglog_t *self, uint32_t entry);
+static void _compact(dats_hyperloglog_t *self);
+static uint64_t _sort_unique(uint32_t *entries, uint64_t length);
+static int _compare_entries(const void *a, const void *b);
+static void _to_dense(dats_hyperloglog_t *self);
+static double _sigma(double x);
+static double _tau(double x);
+
+dats_hyperloglog_t dats_hyperloglog_new(uint64_t data_size, uint64_t precision)
+{
+    assert(data_size > 0);
+    assert(precision >= DATS_HYPERLOGLOG_MIN_PRECISION && precision <= DATS_HYPERLOGLOG_MAX_PRECISION);
+
+    dats_hyperloglog_t hll = {
+        .registers = NULL,
+        .sparse = NULL,
+        .sparse_length = 0,
+        .sparse_capacity = 0,
+        .data_size = data_size,
+        .precision = precision,
+        .seed = DATS_HASH_DEFAULT_SEED
+    };
+
+    hll.sparse_capacity = INITIAL_SPARSE_CAPACITY < _sparse_limit(&hll) ? INITIAL_SPARSE_CAPACITY : _sparse_limit(&hll);
+    hll.sparse = DATS_OOM_GUARD(malloc(hll.sparse_capacity * sizeof(uint32_t)));
+    return hll;
+}
+
+void dats_hyperloglog_add(dats_hyperloglog_t *self, const void *data)
+{
+    uint64_t hash = dats_hash_bytes(data, self->data_size, self->seed);
+    uint64_t index = hash & (_register_count(self) - 1);
+    uint64_t remaining = hash >> self->precision;
+    uint64_t rank = remaining != 0 ? dats_bits_ctz64(remaining) + 1 : 64 - self->precision + 1;
+
+    if (self->registers != NULL)
+    {
+        if (rank > self->registers[index])
+        {
+            self->registers[index] = (uint8_t)rank;
+        }
+        return;
+    }
+
+    _add_entry(self, (uint32_t)(index << RANK_BITS | rank));
+}
+
+uint64_t dats_hyperloglog_count(const dats_hyperloglog_t *self)
+{
+    uint64_t m = _register_count(self);
+    uint64_t q = 64 - self->precision;
+    uint64_t histogram[64 + 2] = { 0 };
+
+    if (self->registers != NULL)
+    {
+        for (uint64_t i = 0; i < m; i++)
+        {
+            histogram[self->registers[i]]++;
+        }
+    }
+    else
+    {
+        uint32_t *entries = DATS_OOM_GUARD(malloc((self->sparse_length + 1) * sizeof(uint32_t)));
+        memcpy(entries, self->sparse, self->sparse_length * sizeof(uint32_t));
+
+        uint64_t length = _sort_unique(entries, self->sparse_length);
+        for (uint64_t i = 0; i < length; i++)
+        {
+            histogram[entries[i] & RANK_MASK]++;
+        }
+        histogram[0] = m - length;
+        free(entries);
+    }
+
+    double z = (double)m * _tau(1.0 - (double)histogram[q + 1] / (double)m);
+    for (uint64_t k = q; k >= 1; k--)
+    {
+        z = 0.5 * (z + (double)histogram[k]);
+    }
+    z += (double)m * _sigma((double)histogram[0] / (double)m);
+
+    /* alpha for an infinite number of registers, 1 / (2 ln 2). */
+    return (uint64_t)llround(0.721347520444481703680 * (double)m * (double)m / z);
+}
+
+void dats_hyperloglog_merge(dats_hyperloglog_t *self, const dats_hyperloglog_t *other)
+{
+    assert(self->data_size == other->data_size);
+    assert(self->precision == other->precision);
+    assert(self->seed == other->seed);
+
+    if (other->registers == NULL)
+    {
+        for (uint64_t i = 0; i < other->sparse_length; i++)
+        {
+            _add_entry(self, other->sparse[i]);
+        }
+        return;
+    }
+
+    if (self->registers == NULL)
+    {
+        _to_dense(self);
+    }
+    for (uint64_t i = 0; i < _register_count(self); i++)
+    {
+        if (other->registers[i] > self->registers[i])
+        {
+            self->registers[i] = other->registers[i];
+        }
+    }
+}
+
+bool dats_hyperloglog_is_sparse(const dats_hyperloglog_t *self)
+{
+    return self->registers == NULL;
+}
+
+uint64_t dats_hyperloglog_memory_usage(const dats_hyperloglog_t *self)
+{
+    if (self->registers != NULL)
+    {
+        return _register_count(self);
+    }
+    return self->sparse_capacity * sizeof(uint32_t);
+}
+
+void dats_hyperloglog_clear(dats_hyperloglog_t *self)
+{
+    free(self->registers);
+    free(self->sparse);
+    self->registers = NULL;
+    self->sparse_length = 0;
+    self->sparse_capacity = INITIAL_SPARSE_CAPACITY < _sparse_limit(self) ? INITIAL_SPARSE_CAPACITY : _sparse_limit(self);
+    self->sparse = DATS_OOM_GUARD(malloc(self->sparse_capacity * sizeof(uint32_t)));
+}
+
+void dats_hyperloglog_free(dats_hyperloglog_t *self)
+{
+    free(self->registers);
+    free(self->sparse);
+    self->registers = NULL;
+    self->sparse = NULL;
+    self->sparse_length = 0;
+    self->sparse_capacity = 0;
+}
+
+static uint64_t _register_count(const dats_hyperloglog_t *self)
+{
+    return (uint64_t)1 << self->precision;
+}
+
+/* Past this number of entries the sparse list would take more bytes than the dense registers. */
+static uint64_t _sparse_limit(const dats_hyperloglog_t *self)
+{
+    return _register_count(self) / sizeof(uint32_t);
+}
+
+static void _add_entry(dats_hyperloglog_t *self, uint32_t entry)
+{
+    if (self->registers != NULL)
+    {
+        uint64_t index = entry >> RANK_BITS;
+        if ((entry & RANK_MASK) > self->registers[index])
+        {
+            self->registers[index] = (uint8_t)(entry & RANK_MASK);
+        }
+        return;
+    }
+
+    if (self->sparse_length == self->sparse_capacity)
+    {
+        _compact(self);
+
+        /* Still more than half full after removing the duplicates, growing is worth it only below the limit. */
+        if (self->sparse_length > self->sparse_capacity / 2)
+        {
+            if (self->sparse_capacity * 2 > _sparse_limit(self))
+            {
+                _to_dense(self);
+                _add_entry(self, entry);
+                return;
+            }
+            self->sparse_capacity *= 2;
+            self->sparse = DATS_OOM_GUARD(realloc(self->sparse, self->sparse_capacity * sizeof(uint32_t)));
+        }
+    }
+
+    self->sparse[self->sparse_length] = entry;
+    self->sparse_length++;
+}
+
+static void _compact(dats_hyperloglog_t *self)
+{
+    self->sparse_length = _sort_unique(self->sparse, self->sparse_length);
+}
+
+/* Sorting the entries puts those of a register together with the highest rank last, it's the one kept. */
+static uint64_t _sort_unique(uint32_t *entries, uint64_t length)
+{
+    if (length == 0)
+    {
+        return 0;
+    }
+
+    qsort(entries, length, sizeof(uint32_t), _compare_entries);
+
+    uint64_t unique = 0;
+    for (uint64_t i = 0; i < length; i++)
+    {
+        if (i + 1 < length && entries[i] >> RANK_BITS == entries[i + 1] >> RANK_BITS)
+        {
+            continue;
+        }
+        entries[unique] = entries[i];
+        unique++;
+    }
+    return unique;
+}
+
+static int _compare_entries(const void *a, const void *b)
+{
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void _to_dense(dats_hyperloglog_t *self)
+{
+    uint32_t *sparse = self->sparse;
+    uint64_t sparse_length = self->sparse_length;
+
+    self->registers = DATS_OOM_GUARD(calloc(_register_count(self), 1));
+    self->sparse = NULL;
+    self->sparse_length = 0;
+    self->sparse_capacity = 0;
+
+    for (uint64_t i = 0; i < sparse_length; i++)
+    {
+        _add_entry(self, sparse[i]);
+    }
+    free(sparse);
+}
+
+/* sigma(x) = x + sum over k >= 1 of x^(2^k) * 2^(k-1), the correction for the empty registers. */
+static double _sigma(double x)
+{
+    if (x == 1.0)
+    {
+        return INFINITY;
+    }
+
+    double y = 1.0;
+    double z = x;
+    double previous;
+
+    do
+    {
+        x *= x;
+        previous = z;
+        z += x * y;
+        y += y;
+    } while (z != previous);
+    return z;
+}
+
+/* tau(x) = (1 - x - sum over k >= 1 of (1 - x^(2^-k))^2 * 2^-k) / 3, the correction for the saturated registers. */
+static double _tau(double x)
+{
+    if (x == 0.0 || x == 1.0)
+    {
+        return 0.0;
+    }
+
+    double y = 1.0;
+    double z = 1.0 - x;
+    double previous;
+
+    do
+    {
+        x = sqrt(x);
+        previous = z;
+        y *= 0.5;
+        z -= (1.0 - x) * (1.0 - x) * y;
+    } while (z != previous);
+    return z / 3.0;
+}
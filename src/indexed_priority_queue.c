@@ -0,0 +1,235 @@
+#include <assert.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "indexed_priority_queue.h"
+#include "dynamic_array.h"
+
+#define INITIAL_CAPACITY 16
+
+/* Position of an id that isn't in the heap. */
+#define NO_POSITION UINT64_MAX
+
+/* An entry is the id followed by the data, its size is rounded so the data stays 8 bytes aligned. */
+#define ENTRY_HEADER_SIZE sizeof(uint64_t)
+
+static uint8_t *_entry(const dats_indexed_priority_queue_t *self, uint64_t index);
+static uint64_t _entry_id(const void *entry);
+static uint64_t *_position(const dats_indexed_priority_queue_t *self, uint64_t id);
+static void _place(dats_indexed_priority_queue_t *self, uint64_t index, const void *entry);
+static bool _sift_up(dats_indexed_priority_queue_t *self, uint64_t index);
+static void _sift_down(dats_indexed_priority_queue_t *self, uint64_t index);
+
+dats_indexed_priority_queue_t dats_indexed_priority_queue_new(uint64_t data_size, uint64_t arity, int64_t (*compare)(const void *a, const void *b))
+{
+    assert(data_size > 0);
+    assert(arity >= 2);
+    assert(compare != NULL);
+
+    uint64_t entry_size = (ENTRY_HEADER_SIZE + data_size + 7) & ~(uint64_t)7;
+
+    dats_indexed_priority_queue_t ipq = {
+        .heap = dats_dynamic_array_new(INITIAL_CAPACITY, entry_size),
+        .positions = dats_dynamic_array_new(INITIAL_CAPACITY, sizeof(uint64_t)),
+        .compare = compare,
+        .data_size = data_size,
+        .arity = arity,
+        .scratch = DATS_OOM_GUARD(malloc(entry_size))
+    };
+    return ipq;
+}
+
+void dats_indexed_priority_queue_push(dats_indexed_priority_queue_t *self, uint64_t id, const void *data)
+{
+    assert(!dats_indexed_priority_queue_contains(self, id));
+
+    uint64_t no_position = NO_POSITION;
+    while (self->positions.length <= id)
+    {
+        dats_dynamic_array_add(&self->positions, &no_position);
+    }
+
+    uint8_t *entry = self->scratch;
+    memcpy(entry, &id, ENTRY_HEADER_SIZE);
+    memcpy(&entry[ENTRY_HEADER_SIZE], data, self->data_size);
+
+    dats_dynamic_array_add(&self->heap, entry);
+    *_position(self, id) = self->heap.length - 1;
+    _sift_up(self, self->heap.length - 1);
+}
+
+void dats_indexed_priority_queue_pop_into(dats_indexed_priority_queue_t *self, uint64_t *id, void *out)
+{
+    assert(self->heap.length > 0);
+
+    const uint8_t *top = _entry(self, 0);
+    if (id != NULL)
+    {
+        *id = _entry_id(top);
+    }
+    if (out != NULL)
+    {
+        memcpy(out, &top[ENTRY_HEADER_SIZE], self->data_size);
+    }
+
+    dats_indexed_priority_queue_remove(self, _entry_id(top));
+}
+
+const void *dats_indexed_priority_queue_peek(const dats_indexed_priority_queue_t *self, uint64_t *id)
+{
+    assert(self->heap.length > 0);
+
+    const uint8_t *top = _entry(self, 0);
+    if (id != NULL)
+    {
+        *id = _entry_id(top);
+    }
+    return &top[ENTRY_HEADER_SIZE];
+}
+
+bool dats_indexed_priority_queue_contains(const dats_indexed_priority_queue_t *self, uint64_t id)
+{
+    return id < self->positions.length && *_position(self, id) != NO_POSITION;
+}
+
+const void *dats_indexed_priority_queue_get(const dats_indexed_priority_queue_t *self, uint64_t id)
+{
+    assert(dats_indexed_priority_queue_contains(self, id));
+
+    return &_entry(self, *_position(self, id))[ENTRY_HEADER_SIZE];
+}
+
+void dats_indexed_priority_queue_decrease_key(dats_indexed_priority_queue_t *self, uint64_t id, const void *data)
+{
+    assert(dats_indexed_priority_queue_contains(self, id));
+
+    uint64_t index = *_position(self, id);
+    uint8_t *entry = _entry(self, index);
+    assert(self->compare(data, &entry[ENTRY_HEADER_SIZE]) <= 0);
+
+    memcpy(&entry[ENTRY_HEADER_SIZE], data, self->data_size);
+    _sift_up(self, index);
+}
+
+void dats_indexed_priority_queue_remove(dats_indexed_priority_queue_t *self, uint64_t id)
+{
+    assert(dats_indexed_priority_queue_contains(self, id));
+
+    uint64_t index = *_position(self, id);
+    *_position(self, id) = NO_POSITION;
+
+    self->heap.length--;
+    if (index == self->heap.length)
+    {
+        return;
+    }
+
+    /* The last entry fills the hole, it may have to go up or down from there. */
+    _place(self, index, _entry(self, self->heap.length));
+    if (!_sift_up(self, index))
+    {
+        _sift_down(self, index);
+    }
+}
+
+uint64_t dats_indexed_priority_queue_length(const dats_indexed_priority_queue_t *self)
+{
+    return self->heap.length;
+}
+
+void dats_indexed_priority_queue_clear(dats_indexed_priority_queue_t *self)
+{
+    dats_dynamic_array_clear(&self->heap);
+    dats_dynamic_array_clear(&self->positions);
+}
+
+void dats_indexed_priority_queue_free(dats_indexed_priority_queue_t *self)
+{
+    dats_dynamic_array_free(&self->heap);
+    dats_dynamic_array_free(&self->positions);
+    free(self->scratch);
+    self->scratch = NULL;
+}
+
+static uint8_t *_entry(const dats_indexed_priority_queue_t *self, uint64_t index)
+{
+    uint8_t *buffer = self->heap.buffer;
+    return &buffer[index * self->heap.data_size];
+}
+
+static uint64_t _entry_id(const void *entry)
+{
+    uint64_t id;
+    memcpy(&id, entry, ENTRY_HEADER_SIZE);
+    return id;
+}
+
+static uint64_t *_position(const dats_indexed_priority_queue_t *self, uint64_t id)
+{
+    uint64_t *positions = self->positions.buffer;
+    return &positions[id];
+}
+
+static void _place(dats_indexed_priority_queue_t *self, uint64_t index, const void *entry)
+{
+    memcpy(_entry(self, index), entry, self->heap.data_size);
+    *_position(self, _entry_id(entry)) = index;
+}
+
+/* Returns true if the entry moved. Every entry moved down gets its new position, the moving one is placed once at the end. */
+static bool _sift_up(dats_indexed_priority_queue_t *self, uint64_t index)
+{
+    uint8_t *moving = self->scratch;
+    uint64_t start = index;
+    memcpy(moving, _entry(self, index), self->heap.data_size);
+
+    while (index > 0)
+    {
+        uint64_t parent = (index - 1) / self->arity;
+        if (self->compare(&moving[ENTRY_HEADER_SIZE], &_entry(self, parent)[ENTRY_HEADER_SIZE]) >= 0)
+        {
+            break;
+        }
+        _place(self, index, _entry(self, parent));
+        index = parent;
+    }
+
+    _place(self, index, moving);
+    return index != start;
+}
+
+static void _sift_down(dats_indexed_priority_queue_t *self, uint64_t index)
+{
+    uint8_t *moving = self->scratch;
+    uint64_t length = self->heap.length;
+    memcpy(moving, _entry(self, index), self->heap.data_size);
+
+    for (;;)
+    {
+        uint64_t first_child = self->arity * index + 1;
+        if (first_child >= length)
+        {
+            break;
+        }
+
+        uint64_t last_child = first_child + self->arity < length ? first_child + self->arity : length;
+        uint64_t best = first_child;
+        for (uint64_t child = first_child + 1; child < last_child; child++)
+        {
+            if (self->compare(&_entry(self, child)[ENTRY_HEADER_SIZE], &_entry(self, best)[ENTRY_HEADER_SIZE]) < 0)
+            {
+                best = child;
+            }
+        }
+
+        if (self->compare(&_entry(self, best)[ENTRY_HEADER_SIZE], &moving[ENTRY_HEADER_SIZE]) >= 0)
+        {
+            break;
+        }
+        _place(self, index, _entry(self, best));
+        index = best;
+    }
+
+    _place(self, index, moving);
+}
@@ -8,7 +8,12 @@
 
 static dats_node_t *_alloc_node(uint64_t data_size);
 static void *_free_node(dats_node_t *node_to_free);
+static void _move_data(void *data, void *out, uint64_t data_size);
 static dats_node_t *_get_node(dats_node_t *start, uint64_t index);
+static void _insert_after_node(dats_linked_list_t *self, dats_node_t *node, const void *data);
+static void *_remove_after_node(dats_linked_list_t *self, dats_node_t *node);
+static void _splice_after_node(dats_linked_list_t *self, dats_node_t *node, dats_linked_list_t *other);
+static dats_node_t *_merge_runs(dats_node_t *a, dats_node_t *b, int64_t (*compare)(const void *a, const void *b), dats_node_t **tail);
 
 dats_linked_list_t dats_linked_list_new(uint64_t data_size)
 {
@@ -93,12 +98,7 @@ void dats_linked_list_insert_index(dats_linked_list_t *self, uint64_t index, con
     else
     {
         dats_node_t *previous_node_from_index = _get_node(self->head, index-1);
-        dats_node_t *following_node_from_index = previous_node_from_index->next_node;
-        
-        dats_node_t *new_node = _alloc_node(self->data_size);
-        previous_node_from_index->next_node = new_node;
-        new_node->next_node = following_node_from_index;
-        self->length++;
+        _insert_after_node(self, previous_node_from_index, data);
     }
 }
 
@@ -157,13 +157,232 @@ void *dats_linked_list_remove_index(dats_linked_list_t *self, uint64_t index)
     }
 
     dats_node_t *previous_node_from_index = _get_node(self->head, index-1);
-    dats_node_t *following_node_from_index = previous_node_from_index->next_node->next_node;
-    
-    void *data = _free_node(previous_node_from_index->next_node);
-    previous_node_from_index->next_node = following_node_from_index;
-    self->length--;
-    
-    return data;
+
+    return _remove_after_node(self, previous_node_from_index);
+}
+
+void dats_linked_list_remove_head_into(dats_linked_list_t *self, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_linked_list_remove_head(self), out, self->data_size);
+}
+
+void dats_linked_list_remove_head_discard(dats_linked_list_t *self)
+{
+    _move_data(dats_linked_list_remove_head(self), NULL, self->data_size);
+}
+
+void dats_linked_list_remove_tail_into(dats_linked_list_t *self, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_linked_list_remove_tail(self), out, self->data_size);
+}
+
+void dats_linked_list_remove_tail_discard(dats_linked_list_t *self)
+{
+    _move_data(dats_linked_list_remove_tail(self), NULL, self->data_size);
+}
+
+void dats_linked_list_remove_index_into(dats_linked_list_t *self, uint64_t index, void *out)
+{
+    assert(out != NULL);
+
+    _move_data(dats_linked_list_remove_index(self, index), out, self->data_size);
+}
+
+void dats_linked_list_remove_index_discard(dats_linked_list_t *self, uint64_t index)
+{
+    _move_data(dats_linked_list_remove_index(self, index), NULL, self->data_size);
+}
+
+void dats_linked_list_insert_head_n(dats_linked_list_t *self, const void *data, uint64_t count)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    const uint8_t *bytes = data;
+    dats_node_t *last_node = _alloc_node(self->data_size);
+    memcpy(last_node->data, bytes, self->data_size);
+
+    /* The chain is built from its end, each new node goes in front of the previous one. */
+    dats_node_t *first_node = last_node;
+    for (uint64_t i = 1; i < count; i++)
+    {
+        dats_node_t *node = _alloc_node(self->data_size);
+        memcpy(node->data, &bytes[i * self->data_size], self->data_size);
+        node->next_node = first_node;
+        first_node = node;
+    }
+
+    last_node->next_node = self->head;
+    if (self->tail == NULL)
+    {
+        self->tail = last_node;
+    }
+    self->head = first_node;
+    self->length += count;
+}
+
+void dats_linked_list_remove_head_n_into(dats_linked_list_t *self, void *out, uint64_t count)
+{
+    assert(count <= self->length);
+    assert(count == 0 || out != NULL);
+
+    if (count == 0)
+    {
+        return;
+    }
+
+    dats_node_t *node = self->head;
+    dats_node_t *last_node = _get_node(node, count - 1);
+
+    self->head = last_node->next_node;
+    self->length -= count;
+    if (self->head == NULL)
+    {
+        self->tail = NULL;
+    }
+
+    uint8_t *bytes = out;
+    for (uint64_t i = 0; i < count; i++)
+    {
+        dats_node_t *next_node = node->next_node;
+        _move_data(_free_node(node), &bytes[i * self->data_size], self->data_size);
+        node = next_node;
+    }
+}
+
+void dats_linked_list_append_list(dats_linked_list_t *self, dats_linked_list_t *other)
+{
+    _splice_after_node(self, self->tail, other);
+}
+
+void dats_linked_list_splice(dats_linked_list_t *self, uint64_t index, dats_linked_list_t *other)
+{
+    assert(index <= self->length);
+
+    if (index == 0)
+    {
+        _splice_after_node(self, NULL, other);
+    }
+    else
+    {
+        _splice_after_node(self, _get_node(self->head, index - 1), other);
+    }
+}
+
+dats_linked_list_t dats_linked_list_split_at(dats_linked_list_t *self, uint64_t index)
+{
+    assert(index <= self->length);
+
+    dats_linked_list_t second = dats_linked_list_new(self->data_size);
+
+    if (index == self->length)
+    {
+        return second;
+    }
+
+    second.length = self->length - index;
+    second.tail = self->tail;
+
+    if (index == 0)
+    {
+        second.head = self->head;
+        self->head = NULL;
+        self->tail = NULL;
+    }
+    else
+    {
+        dats_node_t *last_kept = _get_node(self->head, index - 1);
+        second.head = last_kept->next_node;
+        last_kept->next_node = NULL;
+        self->tail = last_kept;
+    }
+
+    self->length = index;
+    return second;
+}
+
+void dats_linked_list_sort(dats_linked_list_t *self, int64_t (*compare)(const void *a, const void *b))
+{
+    assert(compare != NULL);
+
+    if (self->length < 2)
+    {
+        return;
+    }
+
+    /* runs[i] is empty or holds a sorted run of 2^i nodes. Nodes are taken one by one and carried up like a binary counter, so merges happen while the nodes are still in cache. */
+    dats_node_t *runs[64] = { NULL };
+    dats_node_t *node = self->head;
+
+    while (node != NULL)
+    {
+        dats_node_t *next_node = node->next_node;
+        node->next_node = NULL;
+
+        dats_node_t *carry = node;
+        uint64_t i = 0;
+        for (; runs[i] != NULL; i++)
+        {
+            carry = _merge_runs(runs[i], carry, compare, NULL);
+            runs[i] = NULL;
+        }
+        runs[i] = carry;
+
+        node = next_node;
+    }
+
+    dats_node_t *head = NULL;
+    dats_node_t *tail = NULL;
+    for (uint64_t i = 0; i < 64; i++)
+    {
+        if (runs[i] != NULL)
+        {
+            head = head == NULL ? runs[i] : _merge_runs(runs[i], head, compare, &tail);
+        }
+    }
+
+    /* With a power of two length a single run is left and no final merge gives the tail. */
+    if (tail == NULL)
+    {
+        for (tail = head; tail->next_node != NULL; tail = tail->next_node)
+        {
+        }
+    }
+
+    self->head = head;
+    self->tail = tail;
+}
+
+void dats_linked_list_merge_sorted(dats_linked_list_t *self, dats_linked_list_t *other, int64_t (*compare)(const void *a, const void *b))
+{
+    assert(self->data_size == other->data_size);
+    assert(self != other);
+    assert(compare != NULL);
+
+    if (other->length == 0)
+    {
+        return;
+    }
+    if (self->length == 0)
+    {
+        _splice_after_node(self, NULL, other);
+        return;
+    }
+
+    dats_node_t *tail;
+    self->head = _merge_runs(self->head, other->head, compare, &tail);
+    self->tail = tail;
+    self->length += other->length;
+
+    other->head = NULL;
+    other->tail = NULL;
+    other->length = 0;
 }
 
 void dats_linked_list_map(const dats_linked_list_t *self, void (*func)(const void *data))
@@ -184,20 +403,14 @@ uint64_t dats_linked_list_find(const dats_linked_list_t *self, const void *data)
 {
     assert(self->length > 0);
 
-    dats_node_t *current_node = self->head;
-    uint64_t index = 0;
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(self);
 
-    while (current_node != NULL)
+    for (; dats_linked_list_cursor_is_valid(&cursor); dats_linked_list_cursor_next(&cursor))
     {
-        dats_node_t *next_node = current_node->next_node;
-
-        if (memcmp(current_node->data, data, self->data_size) == 0)
+        if (memcmp(dats_linked_list_cursor_get(&cursor), data, self->data_size) == 0)
         {
-            return index;
+            return cursor.index;
         }
-
-        current_node = next_node;
-        index++;
     }
 
     DATS_RAISE_ERROR("Unable to find data");
@@ -206,18 +419,14 @@ uint64_t dats_linked_list_find(const dats_linked_list_t *self, const void *data)
 
 bool dats_linked_list_contains(const dats_linked_list_t *self, const void *data)
 {
-    dats_node_t *current_node = self->head;
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(self);
 
-    while (current_node != NULL)
+    for (; dats_linked_list_cursor_is_valid(&cursor); dats_linked_list_cursor_next(&cursor))
     {
-        dats_node_t *next_node = current_node->next_node;
-
-        if (memcmp(current_node->data, data, self->data_size) == 0)
+        if (memcmp(dats_linked_list_cursor_get(&cursor), data, self->data_size) == 0)
         {
             return true;
         }
-
-        current_node = next_node;
     }
     return false;
 }
@@ -227,6 +436,75 @@ uint64_t dats_linked_list_length(const dats_linked_list_t *self)
     return self->length;
 }
 
+dats_linked_list_cursor_t dats_linked_list_cursor_new(const dats_linked_list_t *self)
+{
+    dats_linked_list_cursor_t cursor = {
+        .node = self->head,
+        .index = 0
+    };
+    return cursor;
+}
+
+dats_linked_list_cursor_t dats_linked_list_cursor_at(const dats_linked_list_t *self, uint64_t index)
+{
+    assert(index < self->length);
+
+    dats_linked_list_cursor_t cursor = {
+        .node = _get_node(self->head, index),
+        .index = index
+    };
+    return cursor;
+}
+
+bool dats_linked_list_cursor_is_valid(const dats_linked_list_cursor_t *cursor)
+{
+    return cursor->node != NULL;
+}
+
+void dats_linked_list_cursor_next(dats_linked_list_cursor_t *cursor)
+{
+    assert(cursor->node != NULL);
+
+    cursor->node = cursor->node->next_node;
+    cursor->index++;
+}
+
+const void *dats_linked_list_cursor_get(const dats_linked_list_cursor_t *cursor)
+{
+    assert(cursor->node != NULL);
+
+    return cursor->node->data;
+}
+
+void dats_linked_list_cursor_replace(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, const void *data)
+{
+    assert(cursor->node != NULL);
+
+    memcpy(cursor->node->data, data, self->data_size);
+}
+
+void dats_linked_list_cursor_insert_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, const void *data)
+{
+    assert(cursor->node != NULL);
+
+    _insert_after_node(self, cursor->node, data);
+}
+
+void *dats_linked_list_cursor_remove_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor)
+{
+    assert(cursor->node != NULL);
+    assert(cursor->node->next_node != NULL);
+
+    return _remove_after_node(self, cursor->node);
+}
+
+void dats_linked_list_cursor_splice_after(dats_linked_list_t *self, const dats_linked_list_cursor_t *cursor, dats_linked_list_t *other)
+{
+    assert(cursor->node != NULL);
+
+    _splice_after_node(self, cursor->node, other);
+}
+
 void dats_linked_list_clear(dats_linked_list_t *self)
 {
     dats_linked_list_free(self);
@@ -275,4 +553,109 @@ static dats_node_t *_get_node(dats_node_t *start, uint64_t index)
         start = start->next_node;
     }
     return start;
-}
\ No newline at end of file
+}
+
+static void _insert_after_node(dats_linked_list_t *self, dats_node_t *node, const void *data)
+{
+    dats_node_t *new_node = _alloc_node(self->data_size);
+    memcpy(new_node->data, data, self->data_size);
+
+    new_node->next_node = node->next_node;
+    node->next_node = new_node;
+    self->length++;
+
+    if (self->tail == node)
+    {
+        self->tail = new_node;
+    }
+}
+
+static void *_remove_after_node(dats_linked_list_t *self, dats_node_t *node)
+{
+    dats_node_t *node_to_remove = node->next_node;
+    node->next_node = node_to_remove->next_node;
+    self->length--;
+
+    if (self->tail == node_to_remove)
+    {
+        self->tail = node;
+    }
+
+    return _free_node(node_to_remove);
+}
+
+static void _splice_after_node(dats_linked_list_t *self, dats_node_t *node, dats_linked_list_t *other)
+{
+    assert(self->data_size == other->data_size);
+    assert(self != other);
+
+    if (other->length == 0)
+    {
+        return;
+    }
+
+    dats_node_t *following_node = node == NULL ? self->head : node->next_node;
+
+    if (node == NULL)
+    {
+        self->head = other->head;
+    }
+    else
+    {
+        node->next_node = other->head;
+    }
+    other->tail->next_node = following_node;
+
+    if (following_node == NULL)
+    {
+        self->tail = other->tail;
+    }
+    self->length += other->length;
+
+    other->head = NULL;
+    other->tail = NULL;
+    other->length = 0;
+}
+
+/* Merge two sorted runs, the nodes of a come first for equal data. The tail is only searched when asked. */
+static dats_node_t *_merge_runs(dats_node_t *a, dats_node_t *b, int64_t (*compare)(const void *a, const void *b), dats_node_t **tail)
+{
+    dats_node_t merged_head = { .next_node = NULL, .data = NULL };
+    dats_node_t *last = &merged_head;
+
+    while (a != NULL && b != NULL)
+    {
+        if (compare(b->data, a->data) < 0)
+        {
+            last->next_node = b;
+            b = b->next_node;
+        }
+        else
+        {
+            last->next_node = a;
+            a = a->next_node;
+        }
+        last = last->next_node;
+    }
+
+    last->next_node = a != NULL ? a : b;
+
+    if (tail != NULL)
+    {
+        while (last->next_node != NULL)
+        {
+            last = last->next_node;
+        }
+        *tail = last;
+    }
+    return merged_head.next_node;
+}
+
+static void _move_data(void *data, void *out, uint64_t data_size)
+{
+    if (out != NULL)
+    {
+        memcpy(out, data, data_size);
+    }
+    free(data);
+}
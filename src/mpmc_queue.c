@@ -0,0 +1,155 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "mpmc_queue.h"
+
+/* Number of failed tries spent spinning before the blocking functions start to yield the CPU. */
+#define SPIN_TRIES 64
+
+/* The data follows the sequence number in the cell, the cell size is rounded so the data stays aligned for any type. */
+#define CELL_HEADER_SIZE 16
+
+static _Atomic uint64_t *_cell_sequence(const dats_mpmc_queue_t *self, uint64_t position);
+static uint8_t *_cell_data(const dats_mpmc_queue_t *self, uint64_t position);
+static void _backoff(uint64_t tries);
+
+dats_mpmc_queue_t dats_mpmc_queue_new(uint64_t data_size, uint64_t capacity)
+{
+    assert(data_size > 0);
+    assert(capacity >= 2);
+
+    capacity = dats_bits_next_power_of_two(capacity);
+    uint64_t cell_size = (CELL_HEADER_SIZE + data_size + 15) & ~(uint64_t)15;
+
+    dats_mpmc_queue_t q = {
+        .cells = DATS_OOM_GUARD(malloc(capacity * cell_size)),
+        .data_size = data_size,
+        .cell_size = cell_size,
+        .capacity = capacity,
+        .enqueue_position = 0,
+        .dequeue_position = 0
+    };
+
+    for (uint64_t i = 0; i < capacity; i++)
+    {
+        atomic_init(_cell_sequence(&q, i), i);
+    }
+    return q;
+}
+
+bool dats_mpmc_queue_try_enqueue(dats_mpmc_queue_t *self, const void *data)
+{
+    uint64_t position = atomic_load_explicit(&self->enqueue_position, memory_order_relaxed);
+
+    for (;;)
+    {
+        _Atomic uint64_t *sequence = _cell_sequence(self, position);
+        int64_t difference = (int64_t)(atomic_load_explicit(sequence, memory_order_acquire) - position);
+
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&self->enqueue_position, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                memcpy(_cell_data(self, position), data, self->data_size);
+                atomic_store_explicit(sequence, position + 1, memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = atomic_load_explicit(&self->enqueue_position, memory_order_relaxed);
+        }
+    }
+}
+
+bool dats_mpmc_queue_try_dequeue(dats_mpmc_queue_t *self, void *out)
+{
+    uint64_t position = atomic_load_explicit(&self->dequeue_position, memory_order_relaxed);
+
+    for (;;)
+    {
+        _Atomic uint64_t *sequence = _cell_sequence(self, position);
+        int64_t difference = (int64_t)(atomic_load_explicit(sequence, memory_order_acquire) - (position + 1));
+
+        if (difference == 0)
+        {
+            if (atomic_compare_exchange_weak_explicit(&self->dequeue_position, &position, position + 1, memory_order_relaxed, memory_order_relaxed))
+            {
+                memcpy(out, _cell_data(self, position), self->data_size);
+                atomic_store_explicit(sequence, position + self->capacity, memory_order_release);
+                return true;
+            }
+        }
+        else if (difference < 0)
+        {
+            return false;
+        }
+        else
+        {
+            position = atomic_load_explicit(&self->dequeue_position, memory_order_relaxed);
+        }
+    }
+}
+
+void dats_mpmc_queue_enqueue(dats_mpmc_queue_t *self, const void *data)
+{
+    for (uint64_t tries = 0; !dats_mpmc_queue_try_enqueue(self, data); tries++)
+    {
+        _backoff(tries);
+    }
+}
+
+void dats_mpmc_queue_dequeue(dats_mpmc_queue_t *self, void *out)
+{
+    for (uint64_t tries = 0; !dats_mpmc_queue_try_dequeue(self, out); tries++)
+    {
+        _backoff(tries);
+    }
+}
+
+uint64_t dats_mpmc_queue_length(dats_mpmc_queue_t *self)
+{
+    uint64_t dequeue_position = atomic_load_explicit(&self->dequeue_position, memory_order_acquire);
+    uint64_t enqueue_position = atomic_load_explicit(&self->enqueue_position, memory_order_acquire);
+
+    return enqueue_position > dequeue_position ? enqueue_position - dequeue_position : 0;
+}
+
+void dats_mpmc_queue_free(dats_mpmc_queue_t *self)
+{
+    free(self->cells);
+    self->cells = NULL;
+    atomic_store_explicit(&self->enqueue_position, 0, memory_order_relaxed);
+    atomic_store_explicit(&self->dequeue_position, 0, memory_order_relaxed);
+}
+
+static _Atomic uint64_t *_cell_sequence(const dats_mpmc_queue_t *self, uint64_t position)
+{
+    uint8_t *cells = self->cells;
+    return (_Atomic uint64_t *)&cells[(position & (self->capacity - 1)) * self->cell_size];
+}
+
+static uint8_t *_cell_data(const dats_mpmc_queue_t *self, uint64_t position)
+{
+    uint8_t *cells = self->cells;
+    return &cells[(position & (self->capacity - 1)) * self->cell_size + CELL_HEADER_SIZE];
+}
+
+static void _backoff(uint64_t tries)
+{
+    if (tries >= SPIN_TRIES)
+    {
+        sched_yield();
+    }
+}
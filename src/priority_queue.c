@@ -0,0 +1,50 @@
+#include "priority_queue.h"
+#include "d_ary_heap.h"
+
+#define ARITY 2
+
+dats_priority_queue_t dats_priority_queue_new(uint64_t data_size, int64_t (*compare)(const void *a, const void *b))
+{
+    dats_priority_queue_t pq = {
+        .heap = dats_d_ary_heap_new(data_size, ARITY, compare)
+    };
+    return pq;
+}
+
+dats_priority_queue_t dats_priority_queue_from_array(uint64_t data_size, int64_t (*compare)(const void *a, const void *b), const void *data, uint64_t count)
+{
+    dats_priority_queue_t pq = {
+        .heap = dats_d_ary_heap_from_array(data_size, ARITY, compare, data, count)
+    };
+    return pq;
+}
+
+void dats_priority_queue_push(dats_priority_queue_t *self, const void *data)
+{
+    dats_d_ary_heap_push(&self->heap, data);
+}
+
+void dats_priority_queue_pop_into(dats_priority_queue_t *self, void *out)
+{
+    dats_d_ary_heap_pop_into(&self->heap, out);
+}
+
+const void *dats_priority_queue_peek(const dats_priority_queue_t *self)
+{
+    return dats_d_ary_heap_peek(&self->heap);
+}
+
+uint64_t dats_priority_queue_length(const dats_priority_queue_t *self)
+{
+    return dats_d_ary_heap_length(&self->heap);
+}
+
+void dats_priority_queue_clear(dats_priority_queue_t *self)
+{
+    dats_d_ary_heap_clear(&self->heap);
+}
+
+void dats_priority_queue_free(dats_priority_queue_t *self)
+{
+    dats_d_ary_heap_free(&self->heap);
+}
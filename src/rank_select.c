@@ -0,0 +1,208 @@
+#include <assert.h>
+#include <stdlib.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "rank_select.h"
+
+#define WORDS_BY_BLOCK (DATS_RANK_SELECT_BLOCK_BITS / 64)
+#define WORDS_BY_SUB_BLOCK 8
+#define SUB_BLOCK_COUNT_BITS 10
+#define SUB_BLOCK_COUNT_MASK 0x3ffull
+/* Number of lower blocks in an upper block of 2^32 bits. */
+#define UPPER_SHIFT 21
+
+static uint64_t _block_rank(const dats_rank_select_t *self, uint64_t block);
+static uint64_t _sub_block_count(uint64_t entry, uint64_t sub_block);
+static uint64_t _select_in_word(uint64_t word, uint64_t rank);
+
+dats_rank_select_t dats_rank_select_new(const dats_bitset_t *bitset)
+{
+    uint64_t word_length = (bitset->size + 63) / 64;
+    uint64_t lower_length = (word_length + WORDS_BY_BLOCK - 1) / WORDS_BY_BLOCK;
+
+    dats_rank_select_t rs = {
+        .bitset = bitset,
+        .upper = DATS_OOM_GUARD(malloc(((lower_length >> UPPER_SHIFT) + 1) * sizeof(uint64_t))),
+        .lower = DATS_OOM_GUARD(malloc(lower_length * sizeof(uint64_t))),
+        .select_samples = NULL,
+        .lower_length = lower_length,
+        .sample_length = 0,
+        .count = 0
+    };
+
+    for (uint64_t block = 0; block < lower_length; block++)
+    {
+        if ((block & (((uint64_t)1 << UPPER_SHIFT) - 1)) == 0)
+        {
+            rs.upper[block >> UPPER_SHIFT] = rs.count;
+        }
+
+        uint64_t sub_counts[4] = { 0, 0, 0, 0 };
+        for (uint64_t word = block * WORDS_BY_BLOCK; word < (block + 1) * WORDS_BY_BLOCK && word < word_length; word++)
+        {
+            sub_counts[(word % WORDS_BY_BLOCK) / WORDS_BY_SUB_BLOCK] += dats_bits_popcount64(dats_bitset_get_word(bitset, word));
+        }
+
+        /* The last sub-block count is never needed, the next block entry gives it. */
+        rs.lower[block] = ((rs.count - rs.upper[block >> UPPER_SHIFT]) << 32)
+            | (sub_counts[0] << (2 + 2 * SUB_BLOCK_COUNT_BITS))
+            | (sub_counts[1] << (2 + SUB_BLOCK_COUNT_BITS))
+            | (sub_counts[2] << 2);
+        rs.count += sub_counts[0] + sub_counts[1] + sub_counts[2] + sub_counts[3];
+    }
+
+    rs.select_samples = DATS_OOM_GUARD(malloc((rs.count / DATS_RANK_SELECT_SAMPLE_RATE + 1) * sizeof(uint64_t)));
+    for (uint64_t block = 0; block < lower_length; block++)
+    {
+        uint64_t next_rank = block + 1 < lower_length ? _block_rank(&rs, block + 1) : rs.count;
+
+        while (rs.sample_length * DATS_RANK_SELECT_SAMPLE_RATE < next_rank)
+        {
+            rs.select_samples[rs.sample_length] = block;
+            rs.sample_length++;
+        }
+    }
+
+    return rs;
+}
+
+uint64_t dats_rank_select_rank(const dats_rank_select_t *self, uint64_t position)
+{
+    assert(position > 0);
+    assert(position <= self->bitset->size + 1);
+
+    uint64_t index = position - 1;
+
+    if (index == self->bitset->size)
+    {
+        return self->count;
+    }
+
+    uint64_t block = index / DATS_RANK_SELECT_BLOCK_BITS;
+    uint64_t sub_block = (index % DATS_RANK_SELECT_BLOCK_BITS) / (WORDS_BY_SUB_BLOCK * 64);
+    uint64_t rank = _block_rank(self, block);
+
+    for (uint64_t i = 0; i < sub_block; i++)
+    {
+        rank += _sub_block_count(self->lower[block], i);
+    }
+
+    uint64_t last_word = index / 64;
+    for (uint64_t word = block * WORDS_BY_BLOCK + sub_block * WORDS_BY_SUB_BLOCK; word < last_word; word++)
+    {
+        rank += dats_bits_popcount64(dats_bitset_get_word(self->bitset, word));
+    }
+
+    /* The first position of a word is its most significant bit, the bits before index are the high ones. */
+    if (index % 64 != 0)
+    {
+        rank += dats_bits_popcount64(dats_bitset_get_word(self->bitset, last_word) >> (64 - index % 64));
+    }
+    return rank;
+}
+
+uint64_t dats_rank_select_select(const dats_rank_select_t *self, uint64_t rank)
+{
+    assert(rank > 0);
+
+    if (rank > self->count)
+    {
+        return 0;
+    }
+
+    uint64_t remaining = rank - 1;
+    uint64_t sample = remaining / DATS_RANK_SELECT_SAMPLE_RATE;
+
+    /* The wanted block is the last one starting with a rank not above remaining, between this sample and the next. */
+    uint64_t low = self->select_samples[sample];
+    uint64_t high = sample + 1 < self->sample_length ? self->select_samples[sample + 1] + 1 : self->lower_length;
+
+    while (high - low > 1)
+    {
+        uint64_t middle = low + (high - low) / 2;
+        if (_block_rank(self, middle) <= remaining)
+        {
+            low = middle;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    uint64_t block = low;
+    uint64_t word = block * WORDS_BY_BLOCK;
+    remaining -= _block_rank(self, block);
+
+    for (uint64_t i = 0; i < 3; i++)
+    {
+        uint64_t count = _sub_block_count(self->lower[block], i);
+        if (remaining < count)
+        {
+            break;
+        }
+        remaining -= count;
+        word += WORDS_BY_SUB_BLOCK;
+    }
+
+    while (true)
+    {
+        uint64_t bits = dats_bitset_get_word(self->bitset, word);
+        uint64_t count = dats_bits_popcount64(bits);
+
+        if (remaining < count)
+        {
+            return word * 64 + _select_in_word(bits, remaining) + 1;
+        }
+        remaining -= count;
+        word++;
+    }
+}
+
+uint64_t dats_rank_select_count(const dats_rank_select_t *self)
+{
+    return self->count;
+}
+
+void dats_rank_select_free(dats_rank_select_t *self)
+{
+    free(self->upper);
+    free(self->lower);
+    free(self->select_samples);
+    self->upper = NULL;
+    self->lower = NULL;
+    self->select_samples = NULL;
+    self->bitset = NULL;
+    self->lower_length = 0;
+    self->sample_length = 0;
+    self->count = 0;
+}
+
+static uint64_t _block_rank(const dats_rank_select_t *self, uint64_t block)
+{
+    return self->upper[block >> UPPER_SHIFT] + (self->lower[block] >> 32);
+}
+
+static uint64_t _sub_block_count(uint64_t entry, uint64_t sub_block)
+{
+    return (entry >> (2 + (2 - sub_block) * SUB_BLOCK_COUNT_BITS)) & SUB_BLOCK_COUNT_MASK;
+}
+
+/* Offset from the most significant bit of the set bit having rank set bits before it, found by halving the word. */
+static uint64_t _select_in_word(uint64_t word, uint64_t rank)
+{
+    uint64_t offset = 0;
+
+    for (uint64_t width = 32; width > 0; width /= 2)
+    {
+        uint64_t count = dats_bits_popcount64(word >> (64 - width));
+        if (rank >= count)
+        {
+            rank -= count;
+            word <<= width;
+            offset += width;
+        }
+    }
+    return offset;
+}
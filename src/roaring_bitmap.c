@@ -0,0 +1,771 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "roaring_bitmap.h"
+
+#define INITIAL_CAPACITY 16
+#define INITIAL_ARRAY_CAPACITY 4
+#define BITMAP_WORDS 1024
+#define CHUNK_SIZE 65536
+
+typedef enum
+{
+    _AND,
+    _OR,
+    _XOR,
+    _AND_NOT
+} _operation_t;
+
+static dats_roaring_container_t *_containers(const dats_roaring_bitmap_t *self);
+static bool _find_container(const dats_roaring_bitmap_t *self, uint16_t key, uint64_t *index);
+static bool _array_search(const uint16_t *values, uint32_t length, uint16_t value, uint32_t *index);
+static void _array_reserve(dats_roaring_container_t *c, uint32_t capacity);
+static bool _container_contains(const dats_roaring_container_t *c, uint16_t low);
+static bool _container_add(dats_roaring_container_t *c, uint16_t low);
+static bool _container_remove(dats_roaring_container_t *c, uint16_t low);
+static dats_roaring_container_t _container_from_words(uint16_t key, const uint64_t *words, uint32_t cardinality);
+static void _container_to_words(const dats_roaring_container_t *c, uint64_t *words);
+static void _container_convert(dats_roaring_container_t *c);
+static dats_roaring_container_t _container_copy(const dats_roaring_container_t *c);
+static dats_roaring_container_t _container_combine(const dats_roaring_container_t *a, const dats_roaring_container_t *b, _operation_t operation);
+static dats_roaring_container_t _filter_array(const dats_roaring_container_t *array, const dats_roaring_container_t *other, bool keep_contained);
+static dats_roaring_container_t _merge_arrays(const dats_roaring_container_t *a, const dats_roaring_container_t *b, _operation_t operation);
+static uint32_t _next_bit(const uint64_t *words, uint32_t from, bool state);
+static uint32_t _words_to_runs(const uint64_t *words, uint16_t *runs);
+static uint32_t _array_run_count(const dats_roaring_container_t *c);
+static uint64_t _container_bytes(const dats_roaring_container_t *c);
+static dats_roaring_bitmap_t _combine(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b, _operation_t operation);
+
+dats_roaring_bitmap_t dats_roaring_bitmap_new(void)
+{
+    dats_roaring_bitmap_t rb = {
+        .containers = dats_dynamic_array_new(INITIAL_CAPACITY, sizeof(dats_roaring_container_t))
+    };
+    return rb;
+}
+
+bool dats_roaring_bitmap_add(dats_roaring_bitmap_t *self, uint32_t value)
+{
+    uint16_t key = (uint16_t)(value >> 16);
+    uint64_t index;
+
+    if (!_find_container(self, key, &index))
+    {
+        dats_roaring_container_t c = {
+            .data = DATS_OOM_GUARD(malloc(INITIAL_ARRAY_CAPACITY * sizeof(uint16_t))),
+            .cardinality = 0,
+            .length = 0,
+            .capacity = INITIAL_ARRAY_CAPACITY,
+            .key = key,
+            .type = DATS_ROARING_ARRAY
+        };
+
+        /* Append to grow the dynamic array then shift the containers after index to keep them sorted by key. */
+        dats_dynamic_array_add(&self->containers, &c);
+        dats_roaring_container_t *containers = _containers(self);
+        memmove(&containers[index + 1], &containers[index], (self->containers.length - 1 - index) * sizeof(dats_roaring_container_t));
+        containers[index] = c;
+    }
+
+    return _container_add(&_containers(self)[index], (uint16_t)value);
+}
+
+bool dats_roaring_bitmap_remove(dats_roaring_bitmap_t *self, uint32_t value)
+{
+    uint64_t index;
+
+    if (!_find_container(self, (uint16_t)(value >> 16), &index))
+    {
+        return false;
+    }
+
+    dats_roaring_container_t *containers = _containers(self);
+    if (!_container_remove(&containers[index], (uint16_t)value))
+    {
+        return false;
+    }
+
+    if (containers[index].cardinality == 0)
+    {
+        free(containers[index].data);
+        memmove(&containers[index], &containers[index + 1], (self->containers.length - 1 - index) * sizeof(dats_roaring_container_t));
+        self->containers.length--;
+    }
+    return true;
+}
+
+bool dats_roaring_bitmap_contains(const dats_roaring_bitmap_t *self, uint32_t value)
+{
+    uint64_t index;
+
+    if (!_find_container(self, (uint16_t)(value >> 16), &index))
+    {
+        return false;
+    }
+    return _container_contains(&_containers(self)[index], (uint16_t)value);
+}
+
+uint64_t dats_roaring_bitmap_cardinality(const dats_roaring_bitmap_t *self)
+{
+    const dats_roaring_container_t *containers = _containers(self);
+    uint64_t cardinality = 0;
+
+    for (uint64_t i = 0; i < self->containers.length; i++)
+    {
+        cardinality += containers[i].cardinality;
+    }
+    return cardinality;
+}
+
+dats_roaring_bitmap_t dats_roaring_bitmap_and(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b)
+{
+    return _combine(a, b, _AND);
+}
+
+dats_roaring_bitmap_t dats_roaring_bitmap_or(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b)
+{
+    return _combine(a, b, _OR);
+}
+
+dats_roaring_bitmap_t dats_roaring_bitmap_xor(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b)
+{
+    return _combine(a, b, _XOR);
+}
+
+dats_roaring_bitmap_t dats_roaring_bitmap_and_not(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b)
+{
+    return _combine(a, b, _AND_NOT);
+}
+
+void dats_roaring_bitmap_run_optimize(dats_roaring_bitmap_t *self)
+{
+    dats_roaring_container_t *containers = _containers(self);
+    uint64_t words[BITMAP_WORDS];
+
+    for (uint64_t i = 0; i < self->containers.length; i++)
+    {
+        dats_roaring_container_t *c = &containers[i];
+
+        if (c->type == DATS_ROARING_RUN)
+        {
+            continue;
+        }
+
+        uint32_t run_count = c->type == DATS_ROARING_ARRAY ? _array_run_count(c) : 0;
+
+        /* Counting the runs of a sorted array is cheap, most sparse arrays are rejected without building the words. */
+        if (c->type == DATS_ROARING_ARRAY && run_count * 2 * sizeof(uint16_t) >= _container_bytes(c))
+        {
+            continue;
+        }
+
+        _container_to_words(c, words);
+        run_count = _words_to_runs(words, NULL);
+
+        if (run_count * 2 * sizeof(uint16_t) >= _container_bytes(c))
+        {
+            continue;
+        }
+
+        uint16_t *runs = DATS_OOM_GUARD(malloc(run_count * 2 * sizeof(uint16_t)));
+        _words_to_runs(words, runs);
+        free(c->data);
+        c->data = runs;
+        c->length = run_count;
+        c->capacity = run_count;
+        c->type = DATS_ROARING_RUN;
+    }
+}
+
+void dats_roaring_bitmap_map(const dats_roaring_bitmap_t *self, void (*func)(uint32_t value))
+{
+    const dats_roaring_container_t *containers = _containers(self);
+
+    for (uint64_t i = 0; i < self->containers.length; i++)
+    {
+        const dats_roaring_container_t *c = &containers[i];
+        uint32_t high = (uint32_t)c->key << 16;
+
+        if (c->type == DATS_ROARING_ARRAY)
+        {
+            const uint16_t *values = c->data;
+            for (uint32_t j = 0; j < c->length; j++)
+            {
+                func(high | values[j]);
+            }
+        }
+        else if (c->type == DATS_ROARING_BITMAP)
+        {
+            const uint64_t *words = c->data;
+            for (uint32_t j = 0; j < BITMAP_WORDS; j++)
+            {
+                for (uint64_t word = words[j]; word != 0; word &= word - 1)
+                {
+                    func(high | (j * 64 + (uint32_t)dats_bits_ctz64(word)));
+                }
+            }
+        }
+        else
+        {
+            const uint16_t *runs = c->data;
+            for (uint32_t j = 0; j < c->length; j++)
+            {
+                uint32_t end = (uint32_t)runs[2 * j] + runs[2 * j + 1];
+                for (uint32_t low = runs[2 * j]; low <= end; low++)
+                {
+                    func(high | low);
+                }
+            }
+        }
+    }
+}
+
+uint64_t dats_roaring_bitmap_memory_usage(const dats_roaring_bitmap_t *self)
+{
+    const dats_roaring_container_t *containers = _containers(self);
+    uint64_t bytes = sizeof(dats_roaring_bitmap_t) + self->containers.capacity * sizeof(dats_roaring_container_t);
+
+    for (uint64_t i = 0; i < self->containers.length; i++)
+    {
+        bytes += _container_bytes(&containers[i]);
+    }
+    return bytes;
+}
+
+void dats_roaring_bitmap_clear(dats_roaring_bitmap_t *self)
+{
+    dats_roaring_container_t *containers = _containers(self);
+
+    for (uint64_t i = 0; i < self->containers.length; i++)
+    {
+        free(containers[i].data);
+    }
+    dats_dynamic_array_clear(&self->containers);
+}
+
+void dats_roaring_bitmap_free(dats_roaring_bitmap_t *self)
+{
+    dats_roaring_bitmap_clear(self);
+    dats_dynamic_array_free(&self->containers);
+}
+
+static dats_roaring_container_t *_containers(const dats_roaring_bitmap_t *self)
+{
+    return self->containers.buffer;
+}
+
+/* index receives the position of the container, or the position where it must be inserted. */
+static bool _find_container(const dats_roaring_bitmap_t *self, uint16_t key, uint64_t *index)
+{
+    const dats_roaring_container_t *containers = _containers(self);
+    uint64_t low = 0;
+    uint64_t high = self->containers.length;
+
+    while (low < high)
+    {
+        uint64_t middle = low + (high - low) / 2;
+        if (containers[middle].key < key)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    *index = low;
+    return low < self->containers.length && containers[low].key == key;
+}
+
+static bool _array_search(const uint16_t *values, uint32_t length, uint16_t value, uint32_t *index)
+{
+    uint32_t low = 0;
+    uint32_t high = length;
+
+    while (low < high)
+    {
+        uint32_t middle = low + (high - low) / 2;
+        if (values[middle] < value)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    *index = low;
+    return low < length && values[low] == value;
+}
+
+static void _array_reserve(dats_roaring_container_t *c, uint32_t capacity)
+{
+    if (capacity <= c->capacity)
+    {
+        return;
+    }
+
+    uint32_t new_capacity = c->capacity * 2;
+    if (new_capacity > DATS_ROARING_ARRAY_MAX_CARDINALITY)
+    {
+        new_capacity = DATS_ROARING_ARRAY_MAX_CARDINALITY;
+    }
+
+    c->data = DATS_OOM_GUARD(realloc(c->data, new_capacity * sizeof(uint16_t)));
+    c->capacity = new_capacity;
+}
+
+static bool _container_contains(const dats_roaring_container_t *c, uint16_t low)
+{
+    if (c->type == DATS_ROARING_ARRAY)
+    {
+        uint32_t index;
+        return _array_search(c->data, c->length, low, &index);
+    }
+
+    if (c->type == DATS_ROARING_BITMAP)
+    {
+        const uint64_t *words = c->data;
+        return (words[low / 64] >> (low % 64)) & 1;
+    }
+
+    /* Look for the last run starting at low or before. */
+    const uint16_t *runs = c->data;
+    uint32_t first = 0;
+    uint32_t last = c->length;
+
+    while (first < last)
+    {
+        uint32_t middle = first + (last - first) / 2;
+        if (runs[2 * middle] <= low)
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    if (first == 0)
+    {
+        return false;
+    }
+    return low - runs[2 * (first - 1)] <= runs[2 * (first - 1) + 1];
+}
+
+static bool _container_add(dats_roaring_container_t *c, uint16_t low)
+{
+    if (c->type == DATS_ROARING_RUN)
+    {
+        if (_container_contains(c, low))
+        {
+            return false;
+        }
+        _container_convert(c);
+    }
+
+    if (c->type == DATS_ROARING_ARRAY)
+    {
+        uint32_t index;
+        if (_array_search(c->data, c->length, low, &index))
+        {
+            return false;
+        }
+
+        if (c->length < DATS_ROARING_ARRAY_MAX_CARDINALITY)
+        {
+            _array_reserve(c, c->length + 1);
+
+            uint16_t *values = c->data;
+            memmove(&values[index + 1], &values[index], (c->length - index) * sizeof(uint16_t));
+            values[index] = low;
+            c->length++;
+            c->cardinality++;
+            return true;
+        }
+
+        /* A full array is as big as a bitmap, the new value goes into the bitmap. */
+        uint64_t *words = DATS_OOM_GUARD(calloc(BITMAP_WORDS, sizeof(uint64_t)));
+        _container_to_words(c, words);
+        free(c->data);
+        c->data = words;
+        c->length = 0;
+        c->capacity = BITMAP_WORDS;
+        c->type = DATS_ROARING_BITMAP;
+    }
+
+    uint64_t *words = c->data;
+    uint64_t mask = (uint64_t)1 << (low % 64);
+
+    if ((words[low / 64] & mask) != 0)
+    {
+        return false;
+    }
+    words[low / 64] |= mask;
+    c->cardinality++;
+    return true;
+}
+
+static bool _container_remove(dats_roaring_container_t *c, uint16_t low)
+{
+    if (!_container_contains(c, low))
+    {
+        return false;
+    }
+
+    if (c->type == DATS_ROARING_RUN)
+    {
+        _container_convert(c);
+    }
+
+    if (c->type == DATS_ROARING_ARRAY)
+    {
+        uint32_t index;
+        _array_search(c->data, c->length, low, &index);
+
+        uint16_t *values = c->data;
+        memmove(&values[index], &values[index + 1], (c->length - index - 1) * sizeof(uint16_t));
+        c->length--;
+        c->cardinality--;
+        return true;
+    }
+
+    uint64_t *words = c->data;
+    words[low / 64] &= ~((uint64_t)1 << (low % 64));
+    c->cardinality--;
+
+    if (c->cardinality <= DATS_ROARING_ARRAY_MAX_CARDINALITY)
+    {
+        _container_convert(c);
+    }
+    return true;
+}
+
+/* Builds an array container when cardinality allows it, a bitmap container otherwise. */
+static dats_roaring_container_t _container_from_words(uint16_t key, const uint64_t *words, uint32_t cardinality)
+{
+    dats_roaring_container_t c = {
+        .cardinality = cardinality,
+        .key = key
+    };
+
+    if (cardinality > DATS_ROARING_ARRAY_MAX_CARDINALITY)
+    {
+        c.data = DATS_OOM_GUARD(malloc(BITMAP_WORDS * sizeof(uint64_t)));
+        memcpy(c.data, words, BITMAP_WORDS * sizeof(uint64_t));
+        c.length = 0;
+        c.capacity = BITMAP_WORDS;
+        c.type = DATS_ROARING_BITMAP;
+        return c;
+    }
+
+    c.capacity = cardinality > INITIAL_ARRAY_CAPACITY ? cardinality : INITIAL_ARRAY_CAPACITY;
+    c.data = DATS_OOM_GUARD(malloc(c.capacity * sizeof(uint16_t)));
+    c.length = cardinality;
+    c.type = DATS_ROARING_ARRAY;
+
+    uint16_t *values = c.data;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < BITMAP_WORDS; i++)
+    {
+        for (uint64_t word = words[i]; word != 0; word &= word - 1)
+        {
+            values[count] = (uint16_t)(i * 64 + dats_bits_ctz64(word));
+            count++;
+        }
+    }
+    return c;
+}
+
+static void _container_to_words(const dats_roaring_container_t *c, uint64_t *words)
+{
+    if (c->type == DATS_ROARING_BITMAP)
+    {
+        memcpy(words, c->data, BITMAP_WORDS * sizeof(uint64_t));
+        return;
+    }
+
+    memset(words, 0, BITMAP_WORDS * sizeof(uint64_t));
+
+    if (c->type == DATS_ROARING_ARRAY)
+    {
+        const uint16_t *values = c->data;
+        for (uint32_t i = 0; i < c->length; i++)
+        {
+            words[values[i] / 64] |= (uint64_t)1 << (values[i] % 64);
+        }
+        return;
+    }
+
+    const uint16_t *runs = c->data;
+    for (uint32_t i = 0; i < c->length; i++)
+    {
+        uint32_t low = runs[2 * i];
+        uint32_t end = low + runs[2 * i + 1];
+
+        /* Whole words at once inside the run, bit by bit on its edges. */
+        while (low <= end)
+        {
+            if (low % 64 == 0 && low + 63 <= end)
+            {
+                words[low / 64] = UINT64_MAX;
+                low += 64;
+            }
+            else
+            {
+                words[low / 64] |= (uint64_t)1 << (low % 64);
+                low++;
+            }
+        }
+    }
+}
+
+/* Turns a run container, or a bitmap container that went down to the array cardinality, into an array or a bitmap. */
+static void _container_convert(dats_roaring_container_t *c)
+{
+    uint64_t words[BITMAP_WORDS];
+
+    _container_to_words(c, words);
+    dats_roaring_container_t converted = _container_from_words(c->key, words, c->cardinality);
+    free(c->data);
+    *c = converted;
+}
+
+static dats_roaring_container_t _container_copy(const dats_roaring_container_t *c)
+{
+    dats_roaring_container_t copy = *c;
+    uint64_t bytes = _container_bytes(c);
+
+    copy.data = DATS_OOM_GUARD(malloc(bytes));
+    memcpy(copy.data, c->data, bytes);
+    return copy;
+}
+
+static dats_roaring_container_t _container_combine(const dats_roaring_container_t *a, const dats_roaring_container_t *b, _operation_t operation)
+{
+    /* The result of an array with anything can only hold values of the array, so they are tested one by one. */
+    if (a->type == DATS_ROARING_ARRAY && (operation == _AND || operation == _AND_NOT))
+    {
+        return _filter_array(a, b, operation == _AND);
+    }
+    if (b->type == DATS_ROARING_ARRAY && operation == _AND)
+    {
+        return _filter_array(b, a, true);
+    }
+    if (a->type == DATS_ROARING_ARRAY && b->type == DATS_ROARING_ARRAY && a->length + b->length <= DATS_ROARING_ARRAY_MAX_CARDINALITY)
+    {
+        return _merge_arrays(a, b, operation);
+    }
+
+    uint64_t words[BITMAP_WORDS];
+    uint64_t other_words[BITMAP_WORDS];
+    uint32_t cardinality = 0;
+
+    _container_to_words(a, words);
+    _container_to_words(b, other_words);
+
+    for (uint32_t i = 0; i < BITMAP_WORDS; i++)
+    {
+        switch (operation)
+        {
+        case _AND:
+            words[i] &= other_words[i];
+            break;
+        case _OR:
+            words[i] |= other_words[i];
+            break;
+        case _XOR:
+            words[i] ^= other_words[i];
+            break;
+        case _AND_NOT:
+            words[i] &= ~other_words[i];
+            break;
+        }
+        cardinality += (uint32_t)dats_bits_popcount64(words[i]);
+    }
+
+    return _container_from_words(a->key, words, cardinality);
+}
+
+static dats_roaring_container_t _filter_array(const dats_roaring_container_t *array, const dats_roaring_container_t *other, bool keep_contained)
+{
+    dats_roaring_container_t c = {
+        .capacity = array->length > INITIAL_ARRAY_CAPACITY ? array->length : INITIAL_ARRAY_CAPACITY,
+        .key = array->key,
+        .type = DATS_ROARING_ARRAY
+    };
+    c.data = DATS_OOM_GUARD(malloc(c.capacity * sizeof(uint16_t)));
+
+    const uint16_t *values = array->data;
+    uint16_t *kept = c.data;
+
+    for (uint32_t i = 0; i < array->length; i++)
+    {
+        if (_container_contains(other, values[i]) == keep_contained)
+        {
+            kept[c.length] = values[i];
+            c.length++;
+        }
+    }
+    c.cardinality = c.length;
+    return c;
+}
+
+/* Merge of two sorted arrays small enough to give an array, for _OR and _XOR. */
+static dats_roaring_container_t _merge_arrays(const dats_roaring_container_t *a, const dats_roaring_container_t *b, _operation_t operation)
+{
+    dats_roaring_container_t c = {
+        .capacity = a->length + b->length > INITIAL_ARRAY_CAPACITY ? a->length + b->length : INITIAL_ARRAY_CAPACITY,
+        .key = a->key,
+        .type = DATS_ROARING_ARRAY
+    };
+    c.data = DATS_OOM_GUARD(malloc(c.capacity * sizeof(uint16_t)));
+
+    const uint16_t *first = a->data;
+    const uint16_t *second = b->data;
+    uint16_t *merged = c.data;
+    uint32_t i = 0;
+    uint32_t j = 0;
+
+    while (i < a->length || j < b->length)
+    {
+        if (j == b->length || (i < a->length && first[i] < second[j]))
+        {
+            merged[c.length++] = first[i++];
+        }
+        else if (i == a->length || second[j] < first[i])
+        {
+            merged[c.length++] = second[j++];
+        }
+        else
+        {
+            if (operation == _OR)
+            {
+                merged[c.length++] = first[i];
+            }
+            i++;
+            j++;
+        }
+    }
+    c.cardinality = c.length;
+    return c;
+}
+
+/* First position at or after from holding state, CHUNK_SIZE if there isn't any. */
+static uint32_t _next_bit(const uint64_t *words, uint32_t from, bool state)
+{
+    while (from < CHUNK_SIZE)
+    {
+        uint64_t word = state ? words[from / 64] : ~words[from / 64];
+        word &= UINT64_MAX << (from % 64);
+
+        if (word != 0)
+        {
+            return (from & ~(uint32_t)63) + (uint32_t)dats_bits_ctz64(word);
+        }
+        from = (from | 63) + 1;
+    }
+    return CHUNK_SIZE;
+}
+
+/* Returns the number of runs, they are written into runs unless it's NULL. */
+static uint32_t _words_to_runs(const uint64_t *words, uint16_t *runs)
+{
+    uint32_t count = 0;
+    uint32_t start = _next_bit(words, 0, true);
+
+    while (start < CHUNK_SIZE)
+    {
+        uint32_t end = _next_bit(words, start, false);
+
+        if (runs != NULL)
+        {
+            runs[2 * count] = (uint16_t)start;
+            runs[2 * count + 1] = (uint16_t)(end - start - 1);
+        }
+        count++;
+
+        start = end < CHUNK_SIZE ? _next_bit(words, end, true) : CHUNK_SIZE;
+    }
+    return count;
+}
+
+static uint32_t _array_run_count(const dats_roaring_container_t *c)
+{
+    const uint16_t *values = c->data;
+    uint32_t count = c->length > 0 ? 1 : 0;
+
+    for (uint32_t i = 1; i < c->length; i++)
+    {
+        if (values[i] != values[i - 1] + 1)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+static uint64_t _container_bytes(const dats_roaring_container_t *c)
+{
+    switch (c->type)
+    {
+    case DATS_ROARING_ARRAY:
+        return c->capacity * sizeof(uint16_t);
+    case DATS_ROARING_BITMAP:
+        return BITMAP_WORDS * sizeof(uint64_t);
+    default:
+        return c->capacity * 2 * sizeof(uint16_t);
+    }
+}
+
+/* Walks both sorted container lists together like a merge, only the chunks present in both are combined. */
+static dats_roaring_bitmap_t _combine(const dats_roaring_bitmap_t *a, const dats_roaring_bitmap_t *b, _operation_t operation)
+{
+    dats_roaring_bitmap_t result = dats_roaring_bitmap_new();
+    const dats_roaring_container_t *first = _containers(a);
+    const dats_roaring_container_t *second = _containers(b);
+    uint64_t i = 0;
+    uint64_t j = 0;
+
+    while (i < a->containers.length || j < b->containers.length)
+    {
+        if (j == b->containers.length || (i < a->containers.length && first[i].key < second[j].key))
+        {
+            if (operation != _AND)
+            {
+                dats_roaring_container_t copy = _container_copy(&first[i]);
+                dats_dynamic_array_add(&result.containers, &copy);
+            }
+            i++;
+        }
+        else if (i == a->containers.length || second[j].key < first[i].key)
+        {
+            if (operation == _OR || operation == _XOR)
+            {
+                dats_roaring_container_t copy = _container_copy(&second[j]);
+                dats_dynamic_array_add(&result.containers, &copy);
+            }
+            j++;
+        }
+        else
+        {
+            dats_roaring_container_t c = _container_combine(&first[i], &second[j], operation);
+            if (c.cardinality > 0)
+            {
+                dats_dynamic_array_add(&result.containers, &c);
+            }
+            else
+            {
+                free(c.data);
+            }
+            i++;
+            j++;
+        }
+    }
+    return result;
+}
@@ -0,0 +1,401 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <assert.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "scheduler.h"
+#include "mpmc_queue.h"
+#include "work_stealing_deque.h"
+
+/* Capacity of the deque of each worker and of the queue receiving the tasks spawned outside the workers. */
+#define DEQUE_CAPACITY 4096
+#define INJECTION_CAPACITY 4096
+
+/* Number of failed searches before an idle worker goes to sleep. */
+#define IDLE_TRIES 64
+
+/* Depth of the binary search tree under which the subtrees aren't spawned anymore. */
+#define TREE_SPAWN_DEPTH 10
+
+typedef struct
+{
+    void (*func)(void *arg);
+    void *arg;
+    dats_task_group_t *group;
+} dats_task_t;
+
+typedef struct
+{
+    dats_work_stealing_deque_t deque;
+    dats_scheduler_state_t *state;
+    uint64_t index;
+    uint64_t random;
+    pthread_t thread;
+} dats_worker_t;
+
+struct _dats_scheduler_state_t
+{
+    dats_worker_t *workers;
+    uint64_t worker_count;
+    dats_mpmc_queue_t injection;
+    _Atomic bool running;
+    _Atomic uint64_t queued;
+    _Atomic uint64_t sleeping;
+    pthread_mutex_t mutex;
+    pthread_cond_t wake;
+};
+
+typedef struct
+{
+    dats_scheduler_t *scheduler;
+    dats_task_group_t *group;
+    const dats_dynamic_array_t *da;
+    void (*func)(const void *data);
+    uint64_t start;
+    uint64_t end;
+    uint64_t grain;
+} dats_map_range_t;
+
+typedef struct
+{
+    dats_scheduler_t *scheduler;
+    dats_task_group_t *group;
+    const dats_node_tree_t *node;
+    void (*func)(const void *data);
+    uint64_t depth;
+} dats_tree_subtree_t;
+
+/* The worker the current thread is, NULL for a thread that isn't a worker. */
+static _Thread_local dats_worker_t *_current_worker = NULL;
+
+static void *_worker_main(void *arg);
+static bool _find_task(dats_scheduler_state_t *state, dats_worker_t *worker, dats_task_t **task);
+static void _run_task(dats_task_t *task);
+static void _map_range(void *arg);
+static void _traverse_subtree(void *arg);
+static void _traverse_sequential(const dats_node_tree_t *node, void (*func)(const void *data));
+
+dats_scheduler_t dats_scheduler_new(uint64_t worker_count)
+{
+    assert(worker_count > 0);
+
+    dats_scheduler_state_t *state = DATS_OOM_GUARD(malloc(sizeof(dats_scheduler_state_t)));
+    uint64_t workers_size = (worker_count * sizeof(dats_worker_t) + DATS_CACHE_LINE_SIZE - 1) & ~(uint64_t)(DATS_CACHE_LINE_SIZE - 1);
+
+    state->workers = DATS_OOM_GUARD(aligned_alloc(DATS_CACHE_LINE_SIZE, workers_size));
+    state->worker_count = worker_count;
+    /* The queues have const members, they are built on the stack then copied in the heap allocated state. */
+    dats_mpmc_queue_t injection = dats_mpmc_queue_new(sizeof(dats_task_t *), INJECTION_CAPACITY);
+    memcpy(&state->injection, &injection, sizeof(injection));
+    atomic_init(&state->running, true);
+    atomic_init(&state->queued, 0);
+    atomic_init(&state->sleeping, 0);
+    pthread_mutex_init(&state->mutex, NULL);
+    pthread_cond_init(&state->wake, NULL);
+
+    for (uint64_t i = 0; i < worker_count; i++)
+    {
+        dats_worker_t *worker = &state->workers[i];
+        dats_work_stealing_deque_t deque = dats_work_stealing_deque_new(DEQUE_CAPACITY);
+        memcpy(&worker->deque, &deque, sizeof(deque));
+        worker->state = state;
+        worker->index = i;
+        worker->random = i * 0x9E3779B97F4A7C15ull + 1;
+    }
+    for (uint64_t i = 0; i < worker_count; i++)
+    {
+        if (pthread_create(&state->workers[i].thread, NULL, _worker_main, &state->workers[i]) != 0)
+        {
+            DATS_RAISE_ERROR("Unable to create a worker thread");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    dats_scheduler_t s = {
+        .state = state,
+        .worker_count = worker_count
+    };
+    return s;
+}
+
+dats_task_group_t dats_task_group_new(void)
+{
+    dats_task_group_t group = {
+        .pending = 0
+    };
+    return group;
+}
+
+void dats_scheduler_spawn(dats_scheduler_t *self, dats_task_group_t *group, void (*func)(void *arg), void *arg)
+{
+    dats_scheduler_state_t *state = self->state;
+    dats_task_t *task = DATS_OOM_GUARD(malloc(sizeof(dats_task_t)));
+    task->func = func;
+    task->arg = arg;
+    task->group = group;
+
+    atomic_fetch_add_explicit(&group->pending, 1, memory_order_relaxed);
+    atomic_fetch_add(&state->queued, 1);
+
+    bool pushed = _current_worker != NULL && _current_worker->state == state
+        ? dats_work_stealing_deque_push(&_current_worker->deque, task)
+        : dats_mpmc_queue_try_enqueue(&state->injection, &task);
+
+    if (!pushed)
+    {
+        atomic_fetch_sub(&state->queued, 1);
+        _run_task(task);
+        return;
+    }
+
+    if (atomic_load(&state->sleeping) > 0)
+    {
+        pthread_mutex_lock(&state->mutex);
+        pthread_cond_signal(&state->wake);
+        pthread_mutex_unlock(&state->mutex);
+    }
+}
+
+void dats_scheduler_sync(dats_scheduler_t *self, dats_task_group_t *group)
+{
+    dats_scheduler_state_t *state = self->state;
+    dats_worker_t *worker = _current_worker != NULL && _current_worker->state == state ? _current_worker : NULL;
+
+    while (atomic_load_explicit(&group->pending, memory_order_acquire) > 0)
+    {
+        dats_task_t *task;
+
+        if (_find_task(state, worker, &task))
+        {
+            _run_task(task);
+        }
+        else
+        {
+            sched_yield();
+        }
+    }
+}
+
+void dats_scheduler_parallel_map_dynamic_array(dats_scheduler_t *self, const dats_dynamic_array_t *da, void (*func)(const void *data), uint64_t grain)
+{
+    assert(grain > 0);
+
+    dats_task_group_t group = dats_task_group_new();
+    dats_map_range_t *range = DATS_OOM_GUARD(malloc(sizeof(dats_map_range_t)));
+    range->scheduler = self;
+    range->group = &group;
+    range->da = da;
+    range->func = func;
+    range->start = 0;
+    range->end = da->length;
+    range->grain = grain;
+
+    dats_scheduler_spawn(self, &group, _map_range, range);
+    dats_scheduler_sync(self, &group);
+}
+
+void dats_scheduler_parallel_traverse_binary_search_tree(dats_scheduler_t *self, const dats_binary_search_tree_t *bst, void (*func)(const void *data))
+{
+    if (bst->head == NULL)
+    {
+        return;
+    }
+
+    dats_task_group_t group = dats_task_group_new();
+    dats_tree_subtree_t *subtree = DATS_OOM_GUARD(malloc(sizeof(dats_tree_subtree_t)));
+    subtree->scheduler = self;
+    subtree->group = &group;
+    subtree->node = bst->head;
+    subtree->func = func;
+    subtree->depth = 0;
+
+    dats_scheduler_spawn(self, &group, _traverse_subtree, subtree);
+    dats_scheduler_sync(self, &group);
+}
+
+void dats_scheduler_free(dats_scheduler_t *self)
+{
+    dats_scheduler_state_t *state = self->state;
+
+    pthread_mutex_lock(&state->mutex);
+    atomic_store(&state->running, false);
+    pthread_cond_broadcast(&state->wake);
+    pthread_mutex_unlock(&state->mutex);
+
+    for (uint64_t i = 0; i < state->worker_count; i++)
+    {
+        pthread_join(state->workers[i].thread, NULL);
+        dats_work_stealing_deque_free(&state->workers[i].deque);
+    }
+
+    dats_mpmc_queue_free(&state->injection);
+    pthread_cond_destroy(&state->wake);
+    pthread_mutex_destroy(&state->mutex);
+    free(state->workers);
+    free(state);
+
+    self->state = NULL;
+    self->worker_count = 0;
+}
+
+static void *_worker_main(void *arg)
+{
+    dats_worker_t *worker = arg;
+    dats_scheduler_state_t *state = worker->state;
+    uint64_t tries = 0;
+
+    _current_worker = worker;
+
+    /* Once running is cleared the workers keep going until no task is queued, so the tasks spawned before dats_scheduler_free still run. */
+    while (atomic_load(&state->running) || atomic_load(&state->queued) > 0)
+    {
+        dats_task_t *task;
+
+        if (_find_task(state, worker, &task))
+        {
+            _run_task(task);
+            tries = 0;
+            continue;
+        }
+
+        if (++tries < IDLE_TRIES)
+        {
+            sched_yield();
+            continue;
+        }
+
+        /* sleeping is raised before queued is checked and spawn raises queued before checking sleeping, so a spawn can't be missed. */
+        pthread_mutex_lock(&state->mutex);
+        atomic_fetch_add(&state->sleeping, 1);
+        while (atomic_load(&state->running) && atomic_load(&state->queued) == 0)
+        {
+            pthread_cond_wait(&state->wake, &state->mutex);
+        }
+        atomic_fetch_sub(&state->sleeping, 1);
+        pthread_mutex_unlock(&state->mutex);
+        tries = 0;
+    }
+
+    _current_worker = NULL;
+    return NULL;
+}
+
+/* Own deque first (the most recent tasks, still in cache), then the tasks spawned from outside, then steal the oldest task of a random worker. */
+static bool _find_task(dats_scheduler_state_t *state, dats_worker_t *worker, dats_task_t **task)
+{
+    void *item;
+    bool found = false;
+
+    if (worker != NULL && dats_work_stealing_deque_pop(&worker->deque, &item))
+    {
+        *task = item;
+        found = true;
+    }
+    else if (dats_mpmc_queue_try_dequeue(&state->injection, task))
+    {
+        found = true;
+    }
+    else
+    {
+        uint64_t start = 0;
+        if (worker != NULL)
+        {
+            worker->random ^= worker->random << 13;
+            worker->random ^= worker->random >> 7;
+            worker->random ^= worker->random << 17;
+            start = worker->random;
+        }
+
+        for (uint64_t i = 0; i < state->worker_count && !found; i++)
+        {
+            dats_worker_t *victim = &state->workers[(start + i) % state->worker_count];
+            if (victim != worker && dats_work_stealing_deque_steal(&victim->deque, &item))
+            {
+                *task = item;
+                found = true;
+            }
+        }
+    }
+
+    if (found)
+    {
+        atomic_fetch_sub(&state->queued, 1);
+    }
+    return found;
+}
+
+static void _run_task(dats_task_t *task)
+{
+    dats_task_group_t *group = task->group;
+
+    task->func(task->arg);
+    free(task);
+    atomic_fetch_sub_explicit(&group->pending, 1, memory_order_release);
+}
+
+/* Give the right half of the range to another task as long as it's bigger than grain, then map the rest. */
+static void _map_range(void *arg)
+{
+    dats_map_range_t *range = arg;
+    const uint8_t *buffer = range->da->buffer;
+
+    while (range->end - range->start > range->grain)
+    {
+        uint64_t middle = range->start + (range->end - range->start) / 2;
+
+        dats_map_range_t *right = DATS_OOM_GUARD(malloc(sizeof(dats_map_range_t)));
+        *right = *range;
+        right->start = middle;
+        range->end = middle;
+
+        dats_scheduler_spawn(range->scheduler, range->group, _map_range, right);
+    }
+
+    for (uint64_t i = range->start; i < range->end; i++)
+    {
+        range->func(&buffer[i * range->da->data_size]);
+    }
+    free(range);
+}
+
+static void _traverse_subtree(void *arg)
+{
+    dats_tree_subtree_t *subtree = arg;
+    const dats_node_tree_t *node = subtree->node;
+
+    while (node != NULL && subtree->depth < TREE_SPAWN_DEPTH)
+    {
+        if (node->right != NULL)
+        {
+            dats_tree_subtree_t *right = DATS_OOM_GUARD(malloc(sizeof(dats_tree_subtree_t)));
+            *right = *subtree;
+            right->node = node->right;
+            right->depth = subtree->depth + 1;
+
+            dats_scheduler_spawn(subtree->scheduler, subtree->group, _traverse_subtree, right);
+        }
+
+        subtree->func(node->data);
+        node = node->left;
+        subtree->depth++;
+    }
+
+    _traverse_sequential(node, subtree->func);
+    free(subtree);
+}
+
+static void _traverse_sequential(const dats_node_tree_t *node, void (*func)(const void *data))
+{
+    while (node != NULL)
+    {
+        func(node->data);
+        _traverse_sequential(node->right, func);
+        node = node->left;
+    }
+}
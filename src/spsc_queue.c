@@ -0,0 +1,129 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "spsc_queue.h"
+
+static void _copy_to_ring(dats_spsc_queue_t *self, uint64_t position, const void *data, uint64_t count);
+static void _copy_from_ring(const dats_spsc_queue_t *self, uint64_t position, void *out, uint64_t count);
+
+dats_spsc_queue_t dats_spsc_queue_new(uint64_t data_size, uint64_t capacity)
+{
+    assert(data_size > 0);
+    assert(capacity > 0);
+
+    capacity = dats_bits_next_power_of_two(capacity);
+
+    dats_spsc_queue_t q = {
+        .buffer = DATS_OOM_GUARD(malloc(capacity * data_size)),
+        .data_size = data_size,
+        .capacity = capacity,
+        .head = 0,
+        .cached_tail = 0,
+        .tail = 0,
+        .cached_head = 0
+    };
+    return q;
+}
+
+bool dats_spsc_queue_try_enqueue(dats_spsc_queue_t *self, const void *data)
+{
+    return dats_spsc_queue_try_enqueue_n(self, data, 1) == 1;
+}
+
+uint64_t dats_spsc_queue_try_enqueue_n(dats_spsc_queue_t *self, const void *data, uint64_t count)
+{
+    uint64_t tail = atomic_load_explicit(&self->tail, memory_order_relaxed);
+    uint64_t room = self->capacity - (tail - self->cached_head);
+
+    if (room < count)
+    {
+        self->cached_head = atomic_load_explicit(&self->head, memory_order_acquire);
+        room = self->capacity - (tail - self->cached_head);
+    }
+
+    if (count > room)
+    {
+        count = room;
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    _copy_to_ring(self, tail, data, count);
+    atomic_store_explicit(&self->tail, tail + count, memory_order_release);
+    return count;
+}
+
+bool dats_spsc_queue_try_dequeue(dats_spsc_queue_t *self, void *out)
+{
+    return dats_spsc_queue_try_dequeue_n(self, out, 1) == 1;
+}
+
+uint64_t dats_spsc_queue_try_dequeue_n(dats_spsc_queue_t *self, void *out, uint64_t count)
+{
+    uint64_t head = atomic_load_explicit(&self->head, memory_order_relaxed);
+    uint64_t available = self->cached_tail - head;
+
+    if (available < count)
+    {
+        self->cached_tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+        available = self->cached_tail - head;
+    }
+
+    if (count > available)
+    {
+        count = available;
+    }
+    if (count == 0)
+    {
+        return 0;
+    }
+
+    _copy_from_ring(self, head, out, count);
+    atomic_store_explicit(&self->head, head + count, memory_order_release);
+    return count;
+}
+
+uint64_t dats_spsc_queue_length(dats_spsc_queue_t *self)
+{
+    uint64_t head = atomic_load_explicit(&self->head, memory_order_acquire);
+    uint64_t tail = atomic_load_explicit(&self->tail, memory_order_acquire);
+
+    return tail - head;
+}
+
+void dats_spsc_queue_free(dats_spsc_queue_t *self)
+{
+    free(self->buffer);
+    self->buffer = NULL;
+    atomic_store_explicit(&self->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&self->tail, 0, memory_order_relaxed);
+    self->cached_head = 0;
+    self->cached_tail = 0;
+}
+
+/* A run of count data starting at position may wrap around the end of the ring, then it's copied in two parts. */
+static void _copy_to_ring(dats_spsc_queue_t *self, uint64_t position, const void *data, uint64_t count)
+{
+    uint8_t *buffer = self->buffer;
+    uint64_t slot = position & (self->capacity - 1);
+    uint64_t first = self->capacity - slot < count ? self->capacity - slot : count;
+
+    memcpy(&buffer[slot * self->data_size], data, first * self->data_size);
+    memcpy(buffer, (const uint8_t *)data + first * self->data_size, (count - first) * self->data_size);
+}
+
+static void _copy_from_ring(const dats_spsc_queue_t *self, uint64_t position, void *out, uint64_t count)
+{
+    const uint8_t *buffer = self->buffer;
+    uint64_t slot = position & (self->capacity - 1);
+    uint64_t first = self->capacity - slot < count ? self->capacity - slot : count;
+
+    memcpy(out, &buffer[slot * self->data_size], first * self->data_size);
+    memcpy((uint8_t *)out + first * self->data_size, buffer, (count - first) * self->data_size);
+}
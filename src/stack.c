@@ -19,6 +19,26 @@ void *dats_stack_pop(dats_stack_t *self)
     return dats_linked_list_remove_head(&self->ll);
 }
 
+void dats_stack_pop_into(dats_stack_t *self, void *out)
+{
+    dats_linked_list_remove_head_into(&self->ll, out);
+}
+
+void dats_stack_pop_discard(dats_stack_t *self)
+{
+    dats_linked_list_remove_head_discard(&self->ll);
+}
+
+void dats_stack_push_n(dats_stack_t *self, const void *data, uint64_t count)
+{
+    dats_linked_list_insert_head_n(&self->ll, data, count);
+}
+
+void dats_stack_pop_n(dats_stack_t *self, void *out, uint64_t count)
+{
+    dats_linked_list_remove_head_n_into(&self->ll, out, count);
+}
+
 const void *dats_stack_peek(const dats_stack_t *self)
 {
     return dats_linked_list_get_head(&self->ll);
@@ -0,0 +1,311 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "utils.h"
+#include "unrolled_linked_list.h"
+
+/* The data block starts right after the node header, rounded so any type stays aligned. */
+#define NODE_HEADER_SIZE ((sizeof(dats_unrolled_node_t) + 15) & ~(uint64_t)15)
+
+static dats_unrolled_node_t *_alloc_node(const dats_unrolled_linked_list_t *self);
+static dats_unrolled_node_t *_find_node(const dats_unrolled_linked_list_t *self, uint64_t index, dats_unrolled_node_t **previous, uint64_t *offset);
+static uint8_t *_node_data(const dats_unrolled_linked_list_t *self, const dats_unrolled_node_t *node, uint64_t offset);
+static void _split_node(dats_unrolled_linked_list_t *self, dats_unrolled_node_t *node);
+static void _rebalance_node(dats_unrolled_linked_list_t *self, dats_unrolled_node_t *node);
+
+dats_unrolled_linked_list_t dats_unrolled_linked_list_new(uint64_t data_size)
+{
+    assert(data_size > 0);
+
+    uint64_t node_capacity = (DATS_UNROLLED_LINKED_LIST_NODE_BYTES - NODE_HEADER_SIZE) / data_size;
+    if (node_capacity < 4)
+    {
+        node_capacity = 4;
+    }
+
+    return dats_unrolled_linked_list_new_with_node_capacity(data_size, node_capacity);
+}
+
+dats_unrolled_linked_list_t dats_unrolled_linked_list_new_with_node_capacity(uint64_t data_size, uint64_t node_capacity)
+{
+    assert(data_size > 0);
+    assert(node_capacity >= 2);
+
+    dats_unrolled_linked_list_t ull = {
+        .head = NULL,
+        .tail = NULL,
+        .data_size = data_size,
+        .node_capacity = node_capacity,
+        .length = 0
+    };
+    return ull;
+}
+
+const void *dats_unrolled_linked_list_get(const dats_unrolled_linked_list_t *self, uint64_t index)
+{
+    assert(index < self->length);
+
+    uint64_t offset;
+    dats_unrolled_node_t *node = _find_node(self, index, NULL, &offset);
+
+    return _node_data(self, node, offset);
+}
+
+void dats_unrolled_linked_list_insert_head(dats_unrolled_linked_list_t *self, const void *data)
+{
+    dats_unrolled_linked_list_insert_index(self, 0, data);
+}
+
+void dats_unrolled_linked_list_insert_tail(dats_unrolled_linked_list_t *self, const void *data)
+{
+    if (self->tail == NULL || self->tail->count == self->node_capacity)
+    {
+        dats_unrolled_node_t *node = _alloc_node(self);
+
+        if (self->tail == NULL)
+        {
+            self->head = node;
+        }
+        else
+        {
+            self->tail->next_node = node;
+        }
+        self->tail = node;
+    }
+
+    memcpy(_node_data(self, self->tail, self->tail->count), data, self->data_size);
+    self->tail->count++;
+    self->length++;
+}
+
+void dats_unrolled_linked_list_insert_index(dats_unrolled_linked_list_t *self, uint64_t index, const void *data)
+{
+    assert(index <= self->length);
+
+    if (index == self->length)
+    {
+        dats_unrolled_linked_list_insert_tail(self, data);
+        return;
+    }
+
+    uint64_t offset;
+    dats_unrolled_node_t *node = _find_node(self, index, NULL, &offset);
+
+    if (node->count == self->node_capacity)
+    {
+        _split_node(self, node);
+
+        if (offset > node->count)
+        {
+            offset -= node->count;
+            node = node->next_node;
+        }
+    }
+
+    memmove(_node_data(self, node, offset + 1), _node_data(self, node, offset), (node->count - offset) * self->data_size);
+    memcpy(_node_data(self, node, offset), data, self->data_size);
+    node->count++;
+    self->length++;
+}
+
+void dats_unrolled_linked_list_remove_index(dats_unrolled_linked_list_t *self, uint64_t index, void *out)
+{
+    assert(index < self->length);
+
+    uint64_t offset;
+    dats_unrolled_node_t *previous;
+    dats_unrolled_node_t *node = _find_node(self, index, &previous, &offset);
+
+    if (out != NULL)
+    {
+        memcpy(out, _node_data(self, node, offset), self->data_size);
+    }
+
+    memmove(_node_data(self, node, offset), _node_data(self, node, offset + 1), (node->count - offset - 1) * self->data_size);
+    node->count--;
+    self->length--;
+
+    if (node->count > 0)
+    {
+        _rebalance_node(self, node);
+        return;
+    }
+
+    if (previous == NULL)
+    {
+        self->head = node->next_node;
+    }
+    else
+    {
+        previous->next_node = node->next_node;
+    }
+    if (self->tail == node)
+    {
+        self->tail = previous;
+    }
+    free(node);
+}
+
+void dats_unrolled_linked_list_map(const dats_unrolled_linked_list_t *self, void (*func)(const void *data))
+{
+    for (dats_unrolled_node_t *node = self->head; node != NULL; node = node->next_node)
+    {
+        uint8_t *data = node->data;
+
+        for (uint64_t i = 0; i < node->count; i++)
+        {
+            func(&data[i * self->data_size]);
+        }
+    }
+}
+
+uint64_t dats_unrolled_linked_list_find(const dats_unrolled_linked_list_t *self, const void *data)
+{
+    assert(self->length > 0);
+
+    uint64_t index = 0;
+
+    for (dats_unrolled_node_t *node = self->head; node != NULL; node = node->next_node)
+    {
+        uint8_t *node_data = node->data;
+
+        for (uint64_t i = 0; i < node->count; i++)
+        {
+            if (memcmp(&node_data[i * self->data_size], data, self->data_size) == 0)
+            {
+                return index + i;
+            }
+        }
+        index += node->count;
+    }
+
+    DATS_RAISE_ERROR("Unable to find data");
+    exit(EXIT_FAILURE);
+}
+
+bool dats_unrolled_linked_list_contains(const dats_unrolled_linked_list_t *self, const void *data)
+{
+    for (dats_unrolled_node_t *node = self->head; node != NULL; node = node->next_node)
+    {
+        uint8_t *node_data = node->data;
+
+        for (uint64_t i = 0; i < node->count; i++)
+        {
+            if (memcmp(&node_data[i * self->data_size], data, self->data_size) == 0)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint64_t dats_unrolled_linked_list_length(const dats_unrolled_linked_list_t *self)
+{
+    return self->length;
+}
+
+void dats_unrolled_linked_list_clear(dats_unrolled_linked_list_t *self)
+{
+    dats_unrolled_linked_list_free(self);
+}
+
+void dats_unrolled_linked_list_free(dats_unrolled_linked_list_t *self)
+{
+    dats_unrolled_node_t *node = self->head;
+
+    while (node != NULL)
+    {
+        dats_unrolled_node_t *next_node = node->next_node;
+        free(node);
+        node = next_node;
+    }
+
+    self->head = NULL;
+    self->tail = NULL;
+    self->length = 0;
+}
+
+static dats_unrolled_node_t *_alloc_node(const dats_unrolled_linked_list_t *self)
+{
+    uint8_t *block = DATS_OOM_GUARD(malloc(NODE_HEADER_SIZE + self->node_capacity * self->data_size));
+
+    dats_unrolled_node_t *node = (dats_unrolled_node_t *)block;
+    node->next_node = NULL;
+    node->count = 0;
+    node->data = block + NODE_HEADER_SIZE;
+    return node;
+}
+
+static dats_unrolled_node_t *_find_node(const dats_unrolled_linked_list_t *self, uint64_t index, dats_unrolled_node_t **previous, uint64_t *offset)
+{
+    dats_unrolled_node_t *previous_node = NULL;
+    dats_unrolled_node_t *node = self->head;
+
+    while (index >= node->count)
+    {
+        index -= node->count;
+        previous_node = node;
+        node = node->next_node;
+    }
+
+    if (previous != NULL)
+    {
+        *previous = previous_node;
+    }
+    *offset = index;
+    return node;
+}
+
+static uint8_t *_node_data(const dats_unrolled_linked_list_t *self, const dats_unrolled_node_t *node, uint64_t offset)
+{
+    uint8_t *data = node->data;
+    return &data[offset * self->data_size];
+}
+
+static void _split_node(dats_unrolled_linked_list_t *self, dats_unrolled_node_t *node)
+{
+    dats_unrolled_node_t *new_node = _alloc_node(self);
+    uint64_t keep = node->count / 2;
+
+    new_node->count = node->count - keep;
+    memcpy(new_node->data, _node_data(self, node, keep), new_node->count * self->data_size);
+    node->count = keep;
+
+    new_node->next_node = node->next_node;
+    node->next_node = new_node;
+    if (self->tail == node)
+    {
+        self->tail = new_node;
+    }
+}
+
+static void _rebalance_node(dats_unrolled_linked_list_t *self, dats_unrolled_node_t *node)
+{
+    dats_unrolled_node_t *next_node = node->next_node;
+
+    if (node->count >= self->node_capacity / 2 || next_node == NULL)
+    {
+        return;
+    }
+
+    if (node->count + next_node->count <= self->node_capacity)
+    {
+        memcpy(_node_data(self, node, node->count), next_node->data, next_node->count * self->data_size);
+        node->count += next_node->count;
+        node->next_node = next_node->next_node;
+        if (self->tail == next_node)
+        {
+            self->tail = node;
+        }
+        free(next_node);
+        return;
+    }
+
+    memcpy(_node_data(self, node, node->count), next_node->data, self->data_size);
+    node->count++;
+    next_node->count--;
+    memmove(next_node->data, _node_data(self, next_node, 1), next_node->count * self->data_size);
+}
@@ -0,0 +1,106 @@
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#include "bits.h"
+#include "utils.h"
+#include "work_stealing_deque.h"
+
+
+dats_work_stealing_deque_t dats_work_stealing_deque_new(uint64_t capacity)
+{
+    assert(capacity > 0);
+
+    capacity = dats_bits_next_power_of_two(capacity);
+
+    dats_work_stealing_deque_t d = {
+        .items = DATS_OOM_GUARD(malloc(capacity * sizeof(_Atomic(void *)))),
+        .capacity = capacity,
+        .top = 0,
+        .bottom = 0
+    };
+
+    for (uint64_t i = 0; i < capacity; i++)
+    {
+        atomic_init(&d.items[i], NULL);
+    }
+    return d;
+}
+
+bool dats_work_stealing_deque_push(dats_work_stealing_deque_t *self, void *item)
+{
+    int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_relaxed);
+    int64_t top = atomic_load_explicit(&self->top, memory_order_acquire);
+
+    if ((uint64_t)(bottom - top) >= self->capacity)
+    {
+        return false;
+    }
+
+    atomic_store_explicit(&self->items[(uint64_t)bottom & (self->capacity - 1)], item, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    atomic_store_explicit(&self->bottom, bottom + 1, memory_order_relaxed);
+    return true;
+}
+
+bool dats_work_stealing_deque_pop(dats_work_stealing_deque_t *self, void **item)
+{
+    int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_relaxed) - 1;
+    atomic_store_explicit(&self->bottom, bottom, memory_order_relaxed);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t top = atomic_load_explicit(&self->top, memory_order_relaxed);
+
+    if (top > bottom)
+    {
+        atomic_store_explicit(&self->bottom, bottom + 1, memory_order_relaxed);
+        return false;
+    }
+
+    *item = atomic_load_explicit(&self->items[(uint64_t)bottom & (self->capacity - 1)], memory_order_relaxed);
+    if (top < bottom)
+    {
+        return true;
+    }
+
+    /* Last item: race the thieves for it by moving top, the deque ends empty either way. */
+    bool won = atomic_compare_exchange_strong_explicit(&self->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed);
+    atomic_store_explicit(&self->bottom, bottom + 1, memory_order_relaxed);
+    return won;
+}
+
+bool dats_work_stealing_deque_steal(dats_work_stealing_deque_t *self, void **item)
+{
+    int64_t top = atomic_load_explicit(&self->top, memory_order_acquire);
+    atomic_thread_fence(memory_order_seq_cst);
+    int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_acquire);
+
+    if (top >= bottom)
+    {
+        return false;
+    }
+
+    void *stolen = atomic_load_explicit(&self->items[(uint64_t)top & (self->capacity - 1)], memory_order_relaxed);
+    if (!atomic_compare_exchange_strong_explicit(&self->top, &top, top + 1, memory_order_seq_cst, memory_order_relaxed))
+    {
+        return false;
+    }
+
+    *item = stolen;
+    return true;
+}
+
+uint64_t dats_work_stealing_deque_length(dats_work_stealing_deque_t *self)
+{
+    int64_t bottom = atomic_load_explicit(&self->bottom, memory_order_acquire);
+    int64_t top = atomic_load_explicit(&self->top, memory_order_acquire);
+
+    return bottom > top ? (uint64_t)(bottom - top) : 0;
+}
+
+void dats_work_stealing_deque_free(dats_work_stealing_deque_t *self)
+{
+    free(self->items);
+    self->items = NULL;
+    atomic_store_explicit(&self->top, 0, memory_order_relaxed);
+    atomic_store_explicit(&self->bottom, 0, memory_order_relaxed);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_atomic_bitset_test_and_set, SameLayoutAsThePlainBitset)
+{
+    dats_bitset_t bt = dats_bitset_new(70);
+
+    EXPECT_FALSE(dats_atomic_bitset_test_and_set(&bt, 1));
+    EXPECT_TRUE(dats_atomic_bitset_test_and_set(&bt, 1));
+    dats_atomic_bitset_set(&bt, 10);
+    dats_atomic_bitset_set(&bt, 70);
+
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 1));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 10));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 70));
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 9));
+    EXPECT_EQ(dats_bitset_get_word(&bt, 0), 0x8040000000000000ull);
+
+    dats_atomic_bitset_clear(&bt, 10);
+    EXPECT_FALSE(dats_atomic_bitset_is_set(&bt, 10));
+    EXPECT_TRUE(dats_atomic_bitset_is_set(&bt, 70));
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_atomic_bitset_fetch_or_word, ReturnThePreviousWord)
+{
+    dats_bitset_t bt = dats_bitset_new(100);
+    dats_bitset_set(&bt, 65, true);
+
+    EXPECT_EQ(dats_atomic_bitset_fetch_or_word(&bt, 1, 0x00000000f0000000ull | 1), 0x8000000000000000ull);
+    EXPECT_EQ(dats_bitset_get_word(&bt, 1), 0x80000000f0000000ull);
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 97));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 100));
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_atomic_bitset_claim_first_free, ClaimInOrderUntilFull)
+{
+    dats_bitset_t bt = dats_bitset_new(130);
+    dats_bitset_set(&bt, 2, true);
+
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 1), 1);
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 1), 3);
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 100), 100);
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 130), 130);
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 130), 0);
+
+    for (uint64_t i = 0; i < 125; i++)
+    {
+        EXPECT_NE(dats_atomic_bitset_claim_first_free(&bt, 1), 0);
+    }
+    EXPECT_EQ(dats_atomic_bitset_claim_first_free(&bt, 1), 0);
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_atomic_bitset_set, ThreadsOnNeighbouringBitsLoseNothing)
+{
+    const uint64_t threads = 4;
+    const uint64_t size = 100000;
+    dats_bitset_t bt = dats_bitset_new(size);
+
+    std::vector<std::thread> workers;
+    for (uint64_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&bt, t, threads, size]() {
+            for (uint64_t position = t + 1; position <= size; position += threads)
+            {
+                dats_atomic_bitset_set(&bt, position);
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    for (uint64_t index = 0; index < size / 64; index++)
+    {
+        ASSERT_EQ(dats_bitset_get_word(&bt, index), UINT64_MAX);
+    }
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_atomic_bitset_claim_first_free, ThreadsClaimEachBitOnce)
+{
+    const uint64_t threads = 4;
+    const uint64_t size = 20000;
+    dats_bitset_t bt = dats_bitset_new(size);
+    std::vector<std::vector<uint64_t>> claimed(threads);
+
+    std::vector<std::thread> workers;
+    for (uint64_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&bt, &claimed, t]() {
+            uint64_t position;
+            while ((position = dats_atomic_bitset_claim_first_free(&bt, 1)) != 0)
+            {
+                claimed[t].push_back(position);
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<uint64_t> all;
+    for (const std::vector<uint64_t> &positions : claimed)
+    {
+        all.insert(all.end(), positions.begin(), positions.end());
+    }
+    std::sort(all.begin(), all.end());
+    ASSERT_EQ(all.size(), size);
+    for (uint64_t i = 0; i < size; i++)
+    {
+        ASSERT_EQ(all[i], i + 1);
+    }
+
+    dats_bitset_free(&bt);
+}
@@ -210,6 +210,130 @@ TEST(dats_bitset_reset, ResetAllSetBit)
     dats_bitset_free(&bt);
 }
 
+TEST(dats_bitset_get_word, FirstPositionIsTheMostSignificantBit)
+{
+    dats_bitset_t bt = dats_bitset_new(100);
+
+    dats_bitset_set(&bt, 1, true);
+    dats_bitset_set(&bt, 64, true);
+    dats_bitset_set(&bt, 65, true);
+    dats_bitset_set(&bt, 100, true);
+
+    EXPECT_EQ(dats_bitset_get_word(&bt, 0), 0x8000000000000001ull);
+    EXPECT_EQ(dats_bitset_get_word(&bt, 1), 0x8000000010000000ull);
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_bitset_set_word, DropBitsPastTheSize)
+{
+    dats_bitset_t bt = dats_bitset_new(70);
+
+    dats_bitset_set_word(&bt, 0, 0x4000000000000002ull);
+    dats_bitset_set_word(&bt, 1, UINT64_MAX);
+
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 2));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 63));
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 64));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 70));
+    EXPECT_EQ(dats_bitset_get_word(&bt, 1), 0xfc00000000000000ull);
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_bitset_resize, KeepBitsAndClearNewOnes)
+{
+    dats_bitset_t bt = dats_bitset_new(10);
+    dats_bitset_set(&bt, 1, true);
+    dats_bitset_set(&bt, 10, true);
+    dats_bitset_flip(&bt);
+    dats_bitset_flip(&bt);
+    dats_bitset_flip(&bt);
+
+    dats_bitset_resize(&bt, 200);
+    EXPECT_EQ(bt.size, 200);
+    EXPECT_EQ(bt.bytes_needed, 25);
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 1));
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 2));
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 10));
+    for (uint64_t position = 11; position <= 200; position++)
+    {
+        ASSERT_FALSE(dats_bitset_is_set(&bt, position)) << position;
+    }
+
+    dats_bitset_set(&bt, 150, true);
+    dats_bitset_resize(&bt, 5);
+    dats_bitset_resize(&bt, 160);
+    EXPECT_TRUE(dats_bitset_is_set(&bt, 5));
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 6));
+    EXPECT_FALSE(dats_bitset_is_set(&bt, 150));
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_bitset_set_range, MatchSingleBitCalls)
+{
+    const uint64_t size = 300;
+
+    for (uint64_t first : { 1, 3, 8, 9, 64, 77 })
+    {
+        for (uint64_t last : { first, first + 1, first + 6, first + 60, size })
+        {
+            dats_bitset_t bt = dats_bitset_new(size);
+
+            dats_bitset_set_range(&bt, first, last);
+            for (uint64_t position = 1; position <= size; position++)
+            {
+                ASSERT_EQ(dats_bitset_is_set(&bt, position), position >= first && position <= last) << first << " " << last << " " << position;
+            }
+
+            dats_bitset_flip_range(&bt, 1, size);
+            for (uint64_t position = 1; position <= size; position++)
+            {
+                ASSERT_EQ(dats_bitset_is_set(&bt, position), position < first || position > last);
+            }
+
+            dats_bitset_clear_range(&bt, first, last);
+            dats_bitset_clear_range(&bt, 1, first);
+            dats_bitset_flip_range(&bt, last, last);
+            for (uint64_t position = 1; position <= size; position++)
+            {
+                ASSERT_EQ(dats_bitset_is_set(&bt, position), position >= last);
+            }
+
+            dats_bitset_free(&bt);
+        }
+    }
+}
+
+TEST(dats_bitset_all, AllAnyNone)
+{
+    dats_bitset_t bt = dats_bitset_new(130);
+
+    EXPECT_FALSE(dats_bitset_all(&bt));
+    EXPECT_FALSE(dats_bitset_any(&bt));
+    EXPECT_TRUE(dats_bitset_none(&bt));
+
+    dats_bitset_set(&bt, 130, true);
+    EXPECT_FALSE(dats_bitset_all(&bt));
+    EXPECT_TRUE(dats_bitset_any(&bt));
+    EXPECT_FALSE(dats_bitset_none(&bt));
+
+    dats_bitset_set_range(&bt, 1, 130);
+    EXPECT_TRUE(dats_bitset_all(&bt));
+
+    dats_bitset_set(&bt, 70, false);
+    EXPECT_FALSE(dats_bitset_all(&bt));
+
+    dats_bitset_reset(&bt);
+    dats_bitset_flip(&bt);
+    EXPECT_TRUE(dats_bitset_all(&bt));
+    dats_bitset_flip(&bt);
+    EXPECT_TRUE(dats_bitset_none(&bt));
+
+    dats_bitset_free(&bt);
+}
+
 TEST(dats_bitset_free, FreeingSimpleBitset)
 {
     dats_bitset_t bt = dats_bitset_new(17);
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+TEST(dats_blocking_queue_new, CreateAnEmptyBlockingQueue)
+{
+    dats_blocking_queue_t bq = dats_blocking_queue_new(sizeof(_Fake_Position));
+
+    EXPECT_EQ(bq.queue.ll.data_size, sizeof(_Fake_Position));
+    EXPECT_EQ(dats_blocking_queue_length(&bq), 0);
+    EXPECT_FALSE(bq.closed);
+
+    dats_blocking_queue_free(&bq);
+}
+
+TEST(dats_blocking_queue_dequeue_wait, TimeoutOnEmptyQueue)
+{
+    dats_blocking_queue_t bq = dats_blocking_queue_new(sizeof(_Fake_Position));
+    _Fake_Position out = { 0, 0 };
+
+    EXPECT_FALSE(dats_blocking_queue_try_dequeue(&bq, &out));
+
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(dats_blocking_queue_dequeue_wait(&bq, &out, 20000000), DATS_BLOCKING_QUEUE_TIMEOUT);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(15));
+
+    _Fake_Position data = { 1, 2 };
+    EXPECT_TRUE(dats_blocking_queue_enqueue(&bq, &data));
+    EXPECT_EQ(dats_blocking_queue_dequeue_wait(&bq, &out, 20000000), DATS_BLOCKING_QUEUE_OK);
+    EXPECT_EQ(out.x, data.x);
+    EXPECT_EQ(out.y, data.y);
+
+    dats_blocking_queue_free(&bq);
+}
+
+TEST(dats_blocking_queue_close, DrainThenReportClosed)
+{
+    dats_blocking_queue_t bq = dats_blocking_queue_new(sizeof(int));
+    int data[3] = { 1, 2, 3 };
+    int out = 0;
+
+    EXPECT_TRUE(dats_blocking_queue_enqueue_n(&bq, data, 3));
+    dats_blocking_queue_close(&bq);
+    EXPECT_FALSE(dats_blocking_queue_enqueue(&bq, &out));
+    EXPECT_FALSE(dats_blocking_queue_enqueue_n(&bq, data, 3));
+
+    for (int i = 0; i < 3; i++)
+    {
+        EXPECT_EQ(dats_blocking_queue_dequeue(&bq, &out), DATS_BLOCKING_QUEUE_OK);
+        EXPECT_EQ(out, data[i]);
+    }
+    EXPECT_EQ(dats_blocking_queue_dequeue(&bq, &out), DATS_BLOCKING_QUEUE_CLOSED);
+    EXPECT_EQ(dats_blocking_queue_dequeue_wait(&bq, &out, 1000), DATS_BLOCKING_QUEUE_CLOSED);
+
+    dats_blocking_queue_free(&bq);
+}
+
+TEST(dats_blocking_queue_dequeue, WorkersSleepUntilDataOrClose)
+{
+    const int workers_count = 4;
+    dats_blocking_queue_t bq = dats_blocking_queue_new(sizeof(int));
+    std::vector<std::thread> workers;
+    std::vector<int> sums(workers_count, 0);
+
+    for (int w = 0; w < workers_count; w++)
+    {
+        workers.emplace_back([&bq, &sums, w]() {
+            int data;
+            while (dats_blocking_queue_dequeue(&bq, &data) == DATS_BLOCKING_QUEUE_OK)
+            {
+                sums[w] += data;
+            }
+        });
+    }
+
+    int batch[100];
+    for (int i = 0; i < 100; i++)
+    {
+        batch[i] = i + 1;
+    }
+    dats_blocking_queue_enqueue_n(&bq, batch, 100);
+    for (int i = 101; i <= 200; i++)
+    {
+        dats_blocking_queue_enqueue(&bq, &i);
+    }
+    dats_blocking_queue_close(&bq);
+
+    int total = 0;
+    for (int w = 0; w < workers_count; w++)
+    {
+        workers[w].join();
+        total += sums[w];
+    }
+    EXPECT_EQ(total, 200 * 201 / 2);
+    EXPECT_EQ(dats_blocking_queue_length(&bq), 0);
+
+    dats_blocking_queue_free(&bq);
+}
@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_bloom_filter_optimal_bits, SizingFromCountAndRate)
+{
+    /* About 9.6 bits by data for 1% and 7 hashes. */
+    uint64_t bits = dats_bloom_filter_optimal_bits(100000, 0.01);
+    EXPECT_EQ(bits % DATS_BLOOM_FILTER_BLOCK_BITS, 0);
+    EXPECT_GE(bits, 958505);
+    EXPECT_LT(bits, 958505 + DATS_BLOOM_FILTER_BLOCK_BITS);
+    EXPECT_EQ(dats_bloom_filter_optimal_hash_count(bits, 100000), 7);
+    EXPECT_EQ(dats_bloom_filter_optimal_hash_count(100, 100000), 1);
+}
+
+TEST(dats_bloom_filter_add, NoFalseNegativeAndFalsePositiveRateKept)
+{
+    const uint64_t count = 50000;
+
+    for (bool blocked : { false, true })
+    {
+        dats_bloom_filter_t bf = dats_bloom_filter_new(sizeof(uint64_t), count, 0.01, blocked);
+        EXPECT_EQ(bf.hash_count, 7);
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2;
+            dats_bloom_filter_add(&bf, &key);
+        }
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2;
+            ASSERT_TRUE(dats_bloom_filter_contains(&bf, &key));
+        }
+
+        uint64_t false_positives = 0;
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2 + 1;
+            false_positives += dats_bloom_filter_contains(&bf, &key);
+        }
+        EXPECT_LT((double)false_positives / count, blocked ? 0.02 : 0.015) << "blocked " << blocked;
+
+        dats_bloom_filter_clear(&bf);
+        uint64_t key = 0;
+        EXPECT_FALSE(dats_bloom_filter_contains(&bf, &key));
+
+        dats_bloom_filter_free(&bf);
+    }
+}
+
+TEST(dats_bloom_filter_union, UnionAndIntersect)
+{
+    dats_bloom_filter_t first = dats_bloom_filter_new_with_size(sizeof(uint32_t), 1 << 16, 4, 1, true);
+    dats_bloom_filter_t second = dats_bloom_filter_new_with_size(sizeof(uint32_t), 1 << 16, 4, 1, true);
+
+    for (uint32_t key = 0; key < 1000; key++)
+    {
+        dats_bloom_filter_add(&first, &key);
+    }
+    for (uint32_t key = 500; key < 1500; key++)
+    {
+        dats_bloom_filter_add(&second, &key);
+    }
+
+    dats_bloom_filter_t both = dats_bloom_filter_new_with_size(sizeof(uint32_t), 1 << 16, 4, 1, true);
+    dats_bloom_filter_union(&both, &first);
+    dats_bloom_filter_intersect(&both, &second);
+    dats_bloom_filter_union(&first, &second);
+
+    uint64_t outside = 0;
+    for (uint32_t key = 0; key < 1500; key++)
+    {
+        ASSERT_TRUE(dats_bloom_filter_contains(&first, &key));
+        if (key >= 500 && key < 1000)
+        {
+            ASSERT_TRUE(dats_bloom_filter_contains(&both, &key));
+        }
+        else
+        {
+            outside += dats_bloom_filter_contains(&both, &key);
+        }
+    }
+    EXPECT_LT(outside, 50);
+
+    dats_bloom_filter_free(&first);
+    dats_bloom_filter_free(&second);
+    dats_bloom_filter_free(&both);
+}
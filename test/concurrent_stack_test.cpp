@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+TEST(dats_concurrent_stack_new, CreateAnEmptyConcurrentStack)
+{
+    dats_concurrent_stack_t s = dats_concurrent_stack_new(sizeof(_Fake_Position), 4);
+
+    EXPECT_EQ(s.data_size, sizeof(_Fake_Position));
+    EXPECT_EQ(s.capacity, 4);
+    EXPECT_TRUE(dats_concurrent_stack_is_empty(&s));
+
+    dats_concurrent_stack_free(&s);
+}
+
+TEST(dats_concurrent_stack_try_push, LifoUntilFullThenEmpty)
+{
+    dats_concurrent_stack_t s = dats_concurrent_stack_new(sizeof(_Fake_Position), 3);
+    _Fake_Position out = { 0, 0 };
+
+    EXPECT_FALSE(dats_concurrent_stack_try_pop(&s, &out));
+
+    for (uint64_t round = 0; round < 2; round++)
+    {
+        for (uint64_t i = 0; i < 3; i++)
+        {
+            _Fake_Position data = { round, i };
+            EXPECT_TRUE(dats_concurrent_stack_try_push(&s, &data));
+        }
+        _Fake_Position extra = { 99, 99 };
+        EXPECT_FALSE(dats_concurrent_stack_try_push(&s, &extra));
+
+        for (uint64_t i = 3; i > 0; i--)
+        {
+            EXPECT_TRUE(dats_concurrent_stack_try_pop(&s, &out));
+            EXPECT_EQ(out.x, round);
+            EXPECT_EQ(out.y, i - 1);
+        }
+        EXPECT_FALSE(dats_concurrent_stack_try_pop(&s, &out));
+        EXPECT_TRUE(dats_concurrent_stack_is_empty(&s));
+    }
+
+    dats_concurrent_stack_free(&s);
+}
+
+TEST(dats_concurrent_stack_try_pop, ThreadsShareAPoolOfBuffers)
+{
+    const uint64_t threads = 4;
+    const uint64_t rounds = 20000;
+    const uint64_t buffers = 8;
+    dats_concurrent_stack_t s = dats_concurrent_stack_new(sizeof(uint64_t), buffers);
+
+    for (uint64_t i = 0; i < buffers; i++)
+    {
+        EXPECT_TRUE(dats_concurrent_stack_try_push(&s, &i));
+    }
+
+    std::vector<std::thread> workers;
+    for (uint64_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&s, rounds]() {
+            for (uint64_t i = 0; i < rounds; i++)
+            {
+                uint64_t buffer;
+                while (!dats_concurrent_stack_try_pop(&s, &buffer))
+                {
+                    std::this_thread::yield();
+                }
+                while (!dats_concurrent_stack_try_push(&s, &buffer))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<bool> seen(buffers, false);
+    uint64_t buffer;
+    uint64_t count = 0;
+    while (dats_concurrent_stack_try_pop(&s, &buffer))
+    {
+        ASSERT_LT(buffer, buffers);
+        EXPECT_FALSE(seen[buffer]) << "A buffer must never be handed out twice.";
+        seen[buffer] = true;
+        count++;
+    }
+    EXPECT_EQ(count, buffers);
+
+    dats_concurrent_stack_free(&s);
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_count_min_sketch_new, SizedFromErrorBounds)
+{
+    dats_count_min_sketch_t cms = dats_count_min_sketch_new(sizeof(uint32_t), 0.001, 0.01);
+
+    EXPECT_EQ(cms.width, 4096);
+    EXPECT_EQ(cms.depth, 5);
+
+    dats_count_min_sketch_free(&cms);
+}
+
+TEST(dats_count_min_sketch_new_with_size, WidthRoundedUpToAPowerOfTwo)
+{
+    const uint64_t widths[] = {1, 2, 3, 64, 65, 1000};
+    const uint64_t expected[] = {1, 2, 4, 64, 128, 1024};
+
+    for (uint64_t i = 0; i < 6; i++)
+    {
+        dats_count_min_sketch_t cms = dats_count_min_sketch_new_with_size(sizeof(uint32_t), widths[i], 1);
+        EXPECT_EQ(cms.width, expected[i]);
+        dats_count_min_sketch_free(&cms);
+    }
+}
+
+TEST(dats_count_min_sketch_estimate, NeverBelowAndWithinBound)
+{
+    const uint32_t keys = 10000;
+    dats_count_min_sketch_t cms = dats_count_min_sketch_new(sizeof(uint32_t), 0.001, 0.01);
+
+    /* Key k is added k % 100 + 1 times, a heavy key is added a lot more. */
+    for (uint32_t key = 0; key < keys; key++)
+    {
+        dats_count_min_sketch_add(&cms, &key, key % 100 + 1);
+    }
+    uint32_t heavy = keys;
+    dats_count_min_sketch_add(&cms, &heavy, 100000);
+
+    uint64_t total = dats_count_min_sketch_total(&cms);
+    EXPECT_EQ(total, (uint64_t)keys / 100 * 5050 + 100000);
+
+    uint64_t above_bound = 0;
+    for (uint32_t key = 0; key < keys; key++)
+    {
+        uint64_t estimate = dats_count_min_sketch_estimate(&cms, &key);
+        ASSERT_GE(estimate, key % 100 + 1);
+        above_bound += estimate > key % 100 + 1 + total / 1000;
+    }
+    EXPECT_LT(above_bound, keys / 100);
+    EXPECT_GE(dats_count_min_sketch_estimate(&cms, &heavy), 100000);
+    EXPECT_LE(dats_count_min_sketch_estimate(&cms, &heavy), 100000 + total / 1000);
+
+    dats_count_min_sketch_clear(&cms);
+    EXPECT_EQ(dats_count_min_sketch_total(&cms), 0);
+    EXPECT_EQ(dats_count_min_sketch_estimate(&cms, &heavy), 0);
+
+    dats_count_min_sketch_free(&cms);
+}
+
+TEST(dats_count_min_sketch_merge, CountsAreSummed)
+{
+    dats_count_min_sketch_t first = dats_count_min_sketch_new_with_size(sizeof(uint64_t), 1000, 4);
+    dats_count_min_sketch_t second = dats_count_min_sketch_new_with_size(sizeof(uint64_t), 1000, 4);
+    EXPECT_EQ(first.width, 1024);
+
+    uint64_t key = 7;
+    dats_count_min_sketch_add(&first, &key, 3);
+    dats_count_min_sketch_add(&second, &key, 4);
+    dats_count_min_sketch_merge(&first, &second);
+
+    EXPECT_EQ(dats_count_min_sketch_estimate(&first, &key), 7);
+    EXPECT_EQ(dats_count_min_sketch_total(&first), 7);
+
+    dats_count_min_sketch_free(&first);
+    dats_count_min_sketch_free(&second);
+}
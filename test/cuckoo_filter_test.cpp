@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_cuckoo_filter_new, SizedForCapacity)
+{
+    dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint64_t), 1000, 12);
+
+    EXPECT_EQ(cf.bucket_count, 512);
+    EXPECT_EQ(dats_cuckoo_filter_capacity(&cf), 2048);
+    EXPECT_EQ(dats_cuckoo_filter_length(&cf), 0);
+
+    dats_cuckoo_filter_free(&cf);
+}
+
+TEST(dats_cuckoo_filter_insert, NoFalseNegativeAndFalsePositiveRate)
+{
+    const uint64_t count = 100000;
+
+    for (uint64_t bits : { 8, 12, 16 })
+    {
+        dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint64_t), count, bits);
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2;
+            ASSERT_TRUE(dats_cuckoo_filter_insert(&cf, &key));
+        }
+        EXPECT_EQ(dats_cuckoo_filter_length(&cf), count);
+
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2;
+            ASSERT_TRUE(dats_cuckoo_filter_contains(&cf, &key)) << "bits " << bits;
+        }
+
+        uint64_t false_positives = 0;
+        for (uint64_t i = 0; i < count; i++)
+        {
+            uint64_t key = i * 2 + 1;
+            false_positives += dats_cuckoo_filter_contains(&cf, &key);
+        }
+        /* About 2 * 4 * load / 2^bits. */
+        EXPECT_LT((double)false_positives / count, 10.0 / (1 << bits)) << "bits " << bits;
+
+        dats_cuckoo_filter_free(&cf);
+    }
+}
+
+TEST(dats_cuckoo_filter_remove, RemoveKeepsOthers)
+{
+    const uint64_t count = 20000;
+    dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint64_t), count, 16);
+
+    for (uint64_t key = 0; key < count; key++)
+    {
+        dats_cuckoo_filter_insert(&cf, &key);
+    }
+    for (uint64_t key = 0; key < count; key += 2)
+    {
+        ASSERT_TRUE(dats_cuckoo_filter_remove(&cf, &key));
+    }
+    EXPECT_EQ(dats_cuckoo_filter_length(&cf), count / 2);
+
+    uint64_t still_present = 0;
+    for (uint64_t key = 0; key < count; key++)
+    {
+        if (key % 2 == 1)
+        {
+            ASSERT_TRUE(dats_cuckoo_filter_contains(&cf, &key));
+        }
+        else
+        {
+            still_present += dats_cuckoo_filter_contains(&cf, &key);
+        }
+    }
+    EXPECT_LT(still_present, 10);
+
+    uint64_t absent = count * 10;
+    EXPECT_FALSE(dats_cuckoo_filter_remove(&cf, &absent));
+
+    dats_cuckoo_filter_free(&cf);
+}
+
+TEST(dats_cuckoo_filter_remove, DuplicatesAreCounted)
+{
+    dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint32_t), 100, 8);
+    uint32_t key = 42;
+
+    dats_cuckoo_filter_insert(&cf, &key);
+    dats_cuckoo_filter_insert(&cf, &key);
+    EXPECT_EQ(dats_cuckoo_filter_length(&cf), 2);
+
+    EXPECT_TRUE(dats_cuckoo_filter_remove(&cf, &key));
+    EXPECT_TRUE(dats_cuckoo_filter_contains(&cf, &key));
+    EXPECT_TRUE(dats_cuckoo_filter_remove(&cf, &key));
+    EXPECT_FALSE(dats_cuckoo_filter_contains(&cf, &key));
+    EXPECT_FALSE(dats_cuckoo_filter_remove(&cf, &key));
+
+    dats_cuckoo_filter_free(&cf);
+}
+
+TEST(dats_cuckoo_filter_insert, FullFilterKeepsEveryData)
+{
+    dats_cuckoo_filter_t cf = dats_cuckoo_filter_new(sizeof(uint64_t), 1000, 16);
+    uint64_t inserted = 0;
+
+    while (dats_cuckoo_filter_insert(&cf, &inserted))
+    {
+        inserted++;
+    }
+    EXPECT_GT(inserted, dats_cuckoo_filter_capacity(&cf) * 9 / 10);
+    EXPECT_LE(inserted, dats_cuckoo_filter_capacity(&cf) + 1);
+    EXPECT_EQ(dats_cuckoo_filter_length(&cf), inserted);
+
+    for (uint64_t key = 0; key < inserted; key++)
+    {
+        ASSERT_TRUE(dats_cuckoo_filter_contains(&cf, &key));
+    }
+
+    uint64_t key = 0;
+    ASSERT_TRUE(dats_cuckoo_filter_remove(&cf, &key));
+    EXPECT_TRUE(dats_cuckoo_filter_insert(&cf, &inserted));
+    for (key = 1; key <= inserted; key++)
+    {
+        ASSERT_TRUE(dats_cuckoo_filter_contains(&cf, &key));
+    }
+
+    dats_cuckoo_filter_clear(&cf);
+    EXPECT_EQ(dats_cuckoo_filter_length(&cf), 0);
+    EXPECT_FALSE(dats_cuckoo_filter_contains(&cf, &inserted));
+    EXPECT_TRUE(dats_cuckoo_filter_insert(&cf, &inserted));
+
+    dats_cuckoo_filter_free(&cf);
+}
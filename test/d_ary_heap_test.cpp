@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+static int64_t _compare_int(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static std::vector<int> _random_ints(int count, uint32_t seed)
+{
+    std::vector<int> data;
+    for (int i = 0; i < count; i++)
+    {
+        seed = (seed * 1103515245u + 12345u) & 0x7fffffffu;
+        data.push_back((int)(seed % 1000));
+    }
+    return data;
+}
+
+TEST(dats_d_ary_heap_new, CreateAnEmptyHeap)
+{
+    dats_d_ary_heap_t heap = dats_d_ary_heap_new(sizeof(int), 4, _compare_int);
+
+    EXPECT_EQ(heap.arity, 4);
+    EXPECT_EQ(dats_d_ary_heap_length(&heap), 0);
+
+    dats_d_ary_heap_free(&heap);
+    EXPECT_EQ(heap.scratch, nullptr);
+}
+
+TEST(dats_d_ary_heap_new, SiblingsStartOnACacheLine)
+{
+    dats_d_ary_heap_t heap = dats_d_ary_heap_new(sizeof(uint64_t), 8, _compare_int);
+
+    for (uint64_t i = 0; i < 100; i++)
+    {
+        dats_d_ary_heap_push(&heap, &i);
+    }
+    /* The children of the data i are the 8 data from 8 * i + 1, they fill exactly one line. */
+    for (uint64_t i = 0; i < 10; i++)
+    {
+        uintptr_t first_child = (uintptr_t)dats_d_ary_heap_peek(&heap) + (8 * i + 1) * sizeof(uint64_t);
+        EXPECT_EQ(first_child % DATS_D_ARY_HEAP_ALIGNMENT, 0);
+    }
+
+    dats_d_ary_heap_free(&heap);
+}
+
+TEST(dats_d_ary_heap_push, PopSortedForSeveralArities)
+{
+    std::vector<int> data = _random_ints(2000, 3);
+    std::vector<int> sorted = data;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (uint64_t arity : { 2, 3, 4, 8 })
+    {
+        dats_d_ary_heap_t heap = dats_d_ary_heap_new(sizeof(int), arity, _compare_int);
+        for (int value : data)
+        {
+            dats_d_ary_heap_push(&heap, &value);
+        }
+        EXPECT_EQ(*((const int *)dats_d_ary_heap_peek(&heap)), sorted[0]);
+
+        for (int expected : sorted)
+        {
+            int out;
+            dats_d_ary_heap_pop_into(&heap, &out);
+            ASSERT_EQ(out, expected) << "arity " << arity;
+        }
+        EXPECT_EQ(dats_d_ary_heap_length(&heap), 0);
+
+        dats_d_ary_heap_free(&heap);
+    }
+}
+
+TEST(dats_d_ary_heap_from_array, HeapifyThenPopSorted)
+{
+    for (int count : { 0, 1, 2, 9, 1000 })
+    {
+        std::vector<int> data = _random_ints(count, count + 1);
+        dats_d_ary_heap_t heap = dats_d_ary_heap_from_array(sizeof(int), 8, _compare_int, data.data(), data.size());
+        std::sort(data.begin(), data.end());
+
+        for (int expected : data)
+        {
+            int out;
+            dats_d_ary_heap_pop_into(&heap, &out);
+            ASSERT_EQ(out, expected) << "count " << count;
+        }
+        EXPECT_EQ(dats_d_ary_heap_length(&heap), 0);
+
+        dats_d_ary_heap_free(&heap);
+    }
+}
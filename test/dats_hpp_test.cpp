@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <dats/dats.hpp>
+
+TEST(dats_DynamicArray, AddEmplaceAndGrow)
+{
+    dats::DynamicArray<std::string> da(1);
+
+    da.add("first");
+    da.emplace(3, 'x');
+    da.add(std::string("third"));
+
+    EXPECT_EQ(da.length(), 3);
+    EXPECT_GE(da.capacity(), 3);
+    EXPECT_EQ(da.get(0), "first");
+    EXPECT_EQ(da[1], "xxx");
+    EXPECT_EQ(da.find_index("third"), 2);
+
+    EXPECT_EQ(da.remove("xxx"), true);
+    EXPECT_EQ(da.remove("xxx"), false);
+    EXPECT_EQ(da.length(), 2);
+    EXPECT_EQ(da[1], "third");
+}
+
+TEST(dats_DynamicArray, AddOwnDataWhileGrowing)
+{
+    dats::DynamicArray<std::string> da(1);
+
+    da.add(std::string(40, 'x'));
+    da.add(da[0]);
+    EXPECT_EQ(da[1], std::string(40, 'x'));
+
+    da.emplace(da[1], 0, 10);
+    EXPECT_EQ(da.length(), 3);
+    EXPECT_EQ(da[2], std::string(10, 'x'));
+    EXPECT_EQ(da[0], std::string(40, 'x'));
+}
+
+TEST(dats_DynamicArray, MoveOnlyType)
+{
+    dats::DynamicArray<std::unique_ptr<int>> da(1);
+
+    for (int i = 0; i < 10; i++)
+    {
+        da.add(std::unique_ptr<int>(new int(i)));
+    }
+
+    std::unique_ptr<int> removed = da.remove_index(3);
+    EXPECT_EQ(*removed, 3);
+    EXPECT_EQ(da.length(), 9);
+    EXPECT_EQ(*da[3], 4);
+
+    dats::DynamicArray<std::unique_ptr<int>> moved(std::move(da));
+    EXPECT_EQ(moved.length(), 9);
+    EXPECT_EQ(da.length(), 0);
+
+    int sum = 0;
+    for (const std::unique_ptr<int> &data : moved)
+    {
+        sum += *data;
+    }
+    EXPECT_EQ(sum, 45 - 3);
+}
+
+TEST(dats_DynamicArray, WorksWithAlgorithm)
+{
+    dats::DynamicArray<int> da;
+    int values[] = { 5, 3, 9, 1 };
+    for (int value : values)
+    {
+        da.add(value);
+    }
+
+    std::sort(da.begin(), da.end());
+
+    EXPECT_EQ(da[0], 1);
+    EXPECT_EQ(da[3], 9);
+    EXPECT_EQ(*std::max_element(da.begin(), da.end()), 9);
+}
+
+TEST(dats_LinkedList, InsertRemoveAndIterate)
+{
+    dats::LinkedList<int> ll;
+
+    ll.insert_tail(2);
+    ll.insert_head(1);
+    ll.insert_tail(4);
+    ll.insert_index(2, 3);
+    ll.emplace_index(4, 5);
+
+    EXPECT_EQ(ll.length(), 5);
+    EXPECT_EQ(ll.get_head(), 1);
+    EXPECT_EQ(ll.get_tail(), 5);
+    EXPECT_EQ(ll.find(3), 2);
+
+    std::vector<int> seen;
+    std::for_each(ll.begin(), ll.end(), [&seen](int data) { seen.push_back(data); });
+    EXPECT_EQ(seen, std::vector<int>({ 1, 2, 3, 4, 5 }));
+
+    EXPECT_EQ(ll.remove_index(2), 3);
+    EXPECT_EQ(ll.remove_tail(), 5);
+    EXPECT_EQ(ll.remove_head(), 1);
+    EXPECT_EQ(ll.length(), 2);
+    EXPECT_EQ(ll.get_tail(), 4);
+    EXPECT_EQ(ll.contains(3), false);
+
+    for (int &data : ll)
+    {
+        data *= 10;
+    }
+    EXPECT_EQ(ll.get(0), 20);
+    EXPECT_EQ(ll.get(1), 40);
+}
+
+TEST(dats_Stack, PushPopMoveOnly)
+{
+    dats::Stack<std::unique_ptr<int>> s;
+
+    s.push(std::unique_ptr<int>(new int(1)));
+    s.emplace(new int(2));
+
+    EXPECT_EQ(*s.peek(), 2);
+    EXPECT_EQ(*s.pop(), 2);
+    EXPECT_EQ(*s.pop(), 1);
+    EXPECT_EQ(s.length(), 0);
+}
+
+TEST(dats_Queue, EnqueueDequeueOrder)
+{
+    dats::Queue<std::string> q;
+
+    q.enqueue("a");
+    q.emplace("b");
+    q.enqueue("c");
+
+    EXPECT_EQ(q.peek(), "a");
+    EXPECT_EQ(q.get(0), "a");
+    EXPECT_EQ(q.dequeue(), "a");
+    EXPECT_EQ(q.dequeue(), "b");
+    EXPECT_EQ(q.length(), 1);
+    EXPECT_EQ(*q.begin(), "c");
+}
+
+TEST(dats_BinarySearchTree, InOrderIteration)
+{
+    dats::BinarySearchTree<int> bst;
+    int values[] = { 50, 30, 70, 20, 40, 60, 80 };
+    for (int value : values)
+    {
+        EXPECT_EQ(bst.insert(value), true);
+    }
+    EXPECT_EQ(bst.insert(40), false) << "The BST doesn't accept duplicate data.";
+    EXPECT_EQ(bst.length(), 7);
+
+    EXPECT_EQ(bst.remove(50), true);
+    EXPECT_EQ(bst.remove(50), false);
+    EXPECT_EQ(bst.remove(20), true);
+    EXPECT_EQ(bst.contains(30), true);
+    EXPECT_EQ(bst.contains(20), false);
+
+    std::vector<int> seen(bst.begin(), bst.end());
+    EXPECT_EQ(seen, std::vector<int>({ 30, 40, 60, 70, 80 }));
+
+    std::vector<int> level;
+    bst.traverse(dats::Traversal::LevelOrder, [&level](int data) { level.push_back(data); });
+    EXPECT_EQ(level, std::vector<int>({ 60, 30, 70, 40, 80 }));
+}
+
+TEST(dats_BinarySearchTree, CustomComparatorAndMoveOnly)
+{
+    struct CompareUniquePtr
+    {
+        bool operator()(const std::unique_ptr<int> &a, const std::unique_ptr<int> &b) const
+        {
+            return *a > *b;
+        }
+    };
+
+    dats::BinarySearchTree<std::unique_ptr<int>, CompareUniquePtr> bst;
+    for (int i = 0; i < 5; i++)
+    {
+        bst.emplace(new int(i));
+    }
+
+    std::vector<int> seen;
+    for (const std::unique_ptr<int> &data : bst)
+    {
+        seen.push_back(*data);
+    }
+    EXPECT_EQ(seen, std::vector<int>({ 4, 3, 2, 1, 0 }));
+}
+
+TEST(dats_DenseArray, InsertRemoveKeepDense)
+{
+    dats::DenseArray<std::string> da;
+
+    da.insert(10, "ten");
+    da.insert(3, "three");
+    da.emplace(7, "seven");
+    da.insert(3, "THREE");
+
+    EXPECT_EQ(da.length(), 3);
+    EXPECT_EQ(da.get(3), "THREE");
+    EXPECT_EQ(da.has(4), false);
+
+    da.remove(10);
+
+    EXPECT_EQ(da.length(), 2);
+    EXPECT_EQ(da.has(10), false);
+    EXPECT_EQ(da.get(7), "seven");
+    EXPECT_EQ(da.contains("THREE"), true);
+    EXPECT_EQ(std::count(da.begin(), da.end(), "seven"), 1);
+}
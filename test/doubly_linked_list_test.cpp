@@ -0,0 +1,296 @@
+#include <gtest/gtest-death-test.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+TEST(dats_doubly_linked_list_new, CreateAnEmptyDoublyLinkedList)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+
+    EXPECT_EQ(dll.head, nullptr);
+    EXPECT_EQ(dll.tail, nullptr);
+    EXPECT_EQ(dll.data_size, sizeof(int));
+    EXPECT_EQ(dll.length, 0);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_insert_head, InsertNodesLinkBothWays)
+{
+    int data1 = 1;
+    int data2 = 2;
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+
+    dats_doubly_linked_list_insert_head(&dll, &data1);
+    EXPECT_EQ(dll.head, dll.tail);
+
+    dats_doubly_linked_list_insert_head(&dll, &data2);
+
+    EXPECT_EQ(*((int*)dll.head->data), data2);
+    EXPECT_EQ(*((int*)dll.tail->data), data1);
+    EXPECT_EQ(dll.head->next_node, dll.tail);
+    EXPECT_EQ(dll.tail->previous_node, dll.head);
+    EXPECT_EQ(dll.head->previous_node, nullptr);
+    EXPECT_EQ(dll.tail->next_node, nullptr);
+    EXPECT_EQ(dll.length, 2);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_insert_tail, InsertStructData)
+{
+    _Fake_Position data1 = { 1, 11 };
+    _Fake_Position data2 = { 2, 22 };
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(_Fake_Position));
+
+    dats_doubly_linked_list_insert_tail(&dll, &data1);
+    dats_doubly_linked_list_insert_tail(&dll, &data2);
+
+    const _Fake_Position *head = (const _Fake_Position*)dats_doubly_linked_list_get_head(&dll);
+    const _Fake_Position *tail = (const _Fake_Position*)dats_doubly_linked_list_get_tail(&dll);
+    EXPECT_EQ(head->y, data1.y);
+    EXPECT_EQ(tail->y, data2.y);
+    EXPECT_NE(dll.tail->data, &data2) << "The data must be copied in the node.";
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_insert_index, InsertInTheMiddle)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 6; i += 2)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+
+    int data1 = 1;
+    int data3 = 3;
+    dats_doubly_linked_list_insert_index(&dll, 1, &data1);
+    dats_doubly_linked_list_insert_index(&dll, 3, &data3);
+
+    EXPECT_EQ(dll.length, 5);
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(*((const int*)dats_doubly_linked_list_get(&dll, i)), i);
+    }
+
+    dats_doubly_node_t *node = dll.tail;
+    for (int i = 4; i >= 0; i--)
+    {
+        EXPECT_EQ(*((int*)node->data), i);
+        node = node->previous_node;
+    }
+    EXPECT_EQ(node, nullptr);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_remove_tail, RemoveUntilEmpty)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 3; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+
+    for (int i = 2; i >= 0; i--)
+    {
+        int *data = (int*)dats_doubly_linked_list_remove_tail(&dll);
+        EXPECT_EQ(*data, i);
+        free(data);
+    }
+
+    EXPECT_EQ(dll.head, nullptr);
+    EXPECT_EQ(dll.tail, nullptr);
+    EXPECT_EQ(dll.length, 0);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_remove_head, RemoveHeadKeepTail)
+{
+    int data1 = 1;
+    int data2 = 2;
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    dats_doubly_linked_list_insert_tail(&dll, &data1);
+    dats_doubly_linked_list_insert_tail(&dll, &data2);
+
+    int *data = (int*)dats_doubly_linked_list_remove_head(&dll);
+    EXPECT_EQ(*data, data1);
+    free(data);
+
+    EXPECT_EQ(dll.head, dll.tail);
+    EXPECT_EQ(dll.head->previous_node, nullptr);
+    EXPECT_EQ(dll.length, 1);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_remove_index_into, CopyRemovedDataIntoBuffer)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 5; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+    int out = -1;
+
+    dats_doubly_linked_list_remove_index_into(&dll, 3, &out);
+    EXPECT_EQ(out, 3);
+    dats_doubly_linked_list_remove_head_into(&dll, &out);
+    EXPECT_EQ(out, 0);
+    dats_doubly_linked_list_remove_tail_into(&dll, &out);
+    EXPECT_EQ(out, 4);
+    dats_doubly_linked_list_remove_index_discard(&dll, 0);
+    dats_doubly_linked_list_remove_tail_discard(&dll);
+    EXPECT_EQ(dll.length, 0);
+
+    dats_doubly_linked_list_insert_tail(&dll, &out);
+    dats_doubly_linked_list_remove_head_discard(&dll);
+    EXPECT_EQ(dll.head, nullptr);
+    EXPECT_EQ(dll.tail, nullptr);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_insert_head_n, SpliceBatchInFrontOfTheHead)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    int first[3] = {0, 1, 2};
+    int second[2] = {3, 4};
+
+    dats_doubly_linked_list_insert_head_n(&dll, first, 3);
+    dats_doubly_linked_list_insert_head_n(&dll, second, 2);
+    dats_doubly_linked_list_insert_head_n(&dll, second, 0);
+
+    ASSERT_EQ(dll.length, 5);
+    EXPECT_EQ(dll.head->previous_node, nullptr);
+    dats_doubly_node_t *node = dll.tail;
+    for (int i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(*((int*)node->data), i);
+        node = node->previous_node;
+    }
+    EXPECT_EQ(node, nullptr);
+    EXPECT_EQ(dll.tail->next_node, nullptr);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_remove_tail_n_into, DetachBatchFromTheTail)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 5; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+    int out[5] = {-1, -1, -1, -1, -1};
+
+    dats_doubly_linked_list_remove_tail_n_into(&dll, out, 2);
+    EXPECT_EQ(out[0], 4);
+    EXPECT_EQ(out[1], 3);
+    ASSERT_EQ(dll.length, 3);
+    EXPECT_EQ(*((int*)dll.tail->data), 2);
+    EXPECT_EQ(dll.tail->next_node, nullptr);
+
+    dats_doubly_linked_list_remove_tail_n_into(&dll, out, 3);
+    EXPECT_EQ(out[0], 2);
+    EXPECT_EQ(out[2], 0);
+    EXPECT_EQ(dll.head, nullptr);
+    EXPECT_EQ(dll.tail, nullptr);
+    EXPECT_EQ(dll.length, 0);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_remove_node, RemoveKnownMiddleNode)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 5; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+
+    dats_doubly_node_t *node = dats_doubly_linked_list_get_node(&dll, 3);
+    int *data = (int*)dats_doubly_linked_list_remove_node(&dll, node);
+    EXPECT_EQ(*data, 3);
+    free(data);
+
+    data = (int*)dats_doubly_linked_list_remove_index(&dll, 1);
+    EXPECT_EQ(*data, 1);
+    free(data);
+
+    EXPECT_EQ(dll.length, 3);
+    EXPECT_EQ(*((const int*)dats_doubly_linked_list_get(&dll, 1)), 2);
+    EXPECT_EQ(*((const int*)dats_doubly_linked_list_get(&dll, 2)), 4);
+    EXPECT_EQ(*((int*)dll.tail->previous_node->data), 2);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+static int _map_reverse_expected = 2;
+
+static void _test_MapReverse(const void *d)
+{
+    EXPECT_EQ(*((const int*)d), _map_reverse_expected);
+    _map_reverse_expected--;
+}
+
+TEST(dats_doubly_linked_list_map_reverse, MapFromTail)
+{
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(int));
+    for (int i = 0; i < 3; i++)
+    {
+        dats_doubly_linked_list_insert_tail(&dll, &i);
+    }
+
+    dats_doubly_linked_list_map_reverse(&dll, _test_MapReverse);
+    EXPECT_EQ(_map_reverse_expected, -1);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_find, FindAndContains)
+{
+    short data1 = 1111;
+    short data2 = 2222;
+    short data3 = 3333;
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(short));
+    dats_doubly_linked_list_insert_tail(&dll, &data1);
+    dats_doubly_linked_list_insert_tail(&dll, &data2);
+
+    EXPECT_EQ(dats_doubly_linked_list_find(&dll, &data2), 1);
+    EXPECT_EQ(dats_doubly_linked_list_contains(&dll, &data1), true);
+    EXPECT_EQ(dats_doubly_linked_list_contains(&dll, &data3), false);
+
+    dats_doubly_linked_list_free(&dll);
+}
+
+TEST(dats_doubly_linked_list_clear, ClearAndReuse)
+{
+    long data = 5555;
+    dats_doubly_linked_list_t dll = dats_doubly_linked_list_new(sizeof(long));
+    dats_doubly_linked_list_insert_head(&dll, &data);
+    dats_doubly_linked_list_insert_head(&dll, &data);
+
+    dats_doubly_linked_list_clear(&dll);
+
+    EXPECT_EQ(dll.head, nullptr);
+    EXPECT_EQ(dll.tail, nullptr);
+    EXPECT_EQ(dats_doubly_linked_list_length(&dll), 0);
+
+    dats_doubly_linked_list_insert_tail(&dll, &data);
+    EXPECT_EQ(dats_doubly_linked_list_length(&dll), 1);
+
+    dats_doubly_linked_list_free(&dll);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <set>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_hash_bytes, SameDataSameHash)
+{
+    const char data[] = "dats hash";
+
+    EXPECT_EQ(dats_hash_bytes(data, sizeof(data), 0), dats_hash_bytes(data, sizeof(data), 0));
+    EXPECT_NE(dats_hash_bytes(data, sizeof(data), 0), dats_hash_bytes(data, sizeof(data), 1));
+    EXPECT_EQ(dats_hash_bytes(NULL, 0, 3), dats_hash_bytes(data, 0, 3));
+}
+
+TEST(dats_hash_bytes, EveryLengthAndByteMatters)
+{
+    uint8_t data[120] = { 0 };
+    std::set<uint64_t> hashes;
+
+    for (uint64_t size = 0; size <= sizeof(data); size++)
+    {
+        hashes.insert(dats_hash_bytes(data, size, 0));
+    }
+    for (uint64_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = 1;
+        hashes.insert(dats_hash_bytes(data, sizeof(data), 0));
+        data[i] = 0;
+    }
+    EXPECT_EQ(hashes.size(), 2 * sizeof(data) + 1);
+}
+
+TEST(dats_hash_bytes, ReferenceVectors)
+{
+    /* Test vectors of wyhash final 4, the seed is the index of the message. */
+    const char *messages[] = {
+        "",
+        "a",
+        "abc",
+        "message digest",
+        "abcdefghijklmnopqrstuvwxyz",
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789",
+        "12345678901234567890123456789012345678901234567890123456789012345678901234567890"
+    };
+    const uint64_t expected[] = {
+        0x93228a4de0eec5a2ull,
+        0xc5bac3db178713c4ull,
+        0xa97f2f7b1d9b3314ull,
+        0x786d1f1df3801df4ull,
+        0xdca5a8138ad37c87ull,
+        0xb9e734f117cfaf70ull,
+        0x6cc5eab49a92d617ull
+    };
+
+    for (uint64_t i = 0; i < sizeof(expected) / sizeof(expected[0]); i++)
+    {
+        EXPECT_EQ(dats_hash_bytes(messages[i], strlen(messages[i]), i), expected[i]) << messages[i];
+    }
+}
+
+TEST(dats_hash_4, FixedSizesMatchHashBytes)
+{
+    uint8_t data[16];
+
+    for (uint64_t seed = 0; seed < 100; seed++)
+    {
+        for (uint64_t i = 0; i < sizeof(data); i++)
+        {
+            data[i] = (uint8_t)(seed * 31 + i * 7);
+        }
+        EXPECT_EQ(dats_hash_4(data, seed), dats_hash_bytes(data, 4, seed));
+        EXPECT_EQ(dats_hash_8(data, seed), dats_hash_bytes(data, 8, seed));
+        EXPECT_EQ(dats_hash_16(data, seed), dats_hash_bytes(data, 16, seed));
+    }
+}
+
+TEST(dats_hash_n, BulkMatchesHashBytes)
+{
+    uint8_t data[100 * 24];
+    uint64_t out[100];
+
+    for (uint64_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(i * 13 + 5);
+    }
+
+    for (uint64_t size : { 1, 4, 8, 16, 24 })
+    {
+        dats_hash_n(data, 100, size, 42, out);
+        for (uint64_t i = 0; i < 100; i++)
+        {
+            ASSERT_EQ(out[i], dats_hash_bytes(&data[i * size], size, 42)) << "size " << size;
+        }
+    }
+}
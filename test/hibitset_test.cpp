@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <set>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+static std::vector<uint64_t> _mapped;
+
+static void _collect(uint64_t position)
+{
+    _mapped.push_back(position);
+}
+
+static std::set<uint64_t> _random_positions(uint64_t size, uint64_t count, uint64_t seed)
+{
+    std::set<uint64_t> positions;
+    while (positions.size() < count)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        positions.insert((seed >> 11) % size + 1);
+    }
+    return positions;
+}
+
+TEST(dats_hibitset_new, LevelsUpToASingleWord)
+{
+    dats_hibitset_t hbs = dats_hibitset_new(64);
+    EXPECT_EQ(hbs.level_count, 1);
+    dats_hibitset_free(&hbs);
+
+    hbs = dats_hibitset_new(65);
+    EXPECT_EQ(hbs.level_count, 2);
+    EXPECT_EQ(hbs.levels[1].size, 2);
+    dats_hibitset_free(&hbs);
+
+    hbs = dats_hibitset_new(1000000);
+    EXPECT_EQ(hbs.level_count, 4);
+    EXPECT_TRUE(dats_hibitset_is_empty(&hbs));
+    EXPECT_EQ(dats_hibitset_next_set(&hbs, 1), 0);
+    dats_hibitset_free(&hbs);
+    EXPECT_EQ(hbs.level_count, 0);
+}
+
+TEST(dats_hibitset_set, SetAndClearUpdateTheSummaries)
+{
+    dats_hibitset_t hbs = dats_hibitset_new(300000);
+
+    dats_hibitset_set(&hbs, 200000, true);
+    dats_hibitset_set(&hbs, 200001, true);
+    EXPECT_FALSE(dats_hibitset_is_empty(&hbs));
+    EXPECT_TRUE(dats_hibitset_is_set(&hbs, 200000));
+    EXPECT_FALSE(dats_hibitset_is_set(&hbs, 199999));
+
+    dats_hibitset_set(&hbs, 200000, false);
+    EXPECT_FALSE(dats_hibitset_is_empty(&hbs));
+    EXPECT_EQ(dats_hibitset_next_set(&hbs, 1), 200001);
+
+    dats_hibitset_set(&hbs, 200001, false);
+    EXPECT_TRUE(dats_hibitset_is_empty(&hbs));
+
+    dats_hibitset_free(&hbs);
+}
+
+TEST(dats_hibitset_next_set, MatchAStdSet)
+{
+    const uint64_t size = 5000000;
+    std::set<uint64_t> positions = _random_positions(size, 3000, 7);
+    positions.insert(1);
+    positions.insert(size);
+    dats_hibitset_t hbs = dats_hibitset_new(size);
+
+    for (uint64_t position : positions)
+    {
+        dats_hibitset_set(&hbs, position, true);
+    }
+    EXPECT_EQ(dats_hibitset_count(&hbs), positions.size());
+
+    std::vector<uint64_t> found;
+    for (uint64_t position = dats_hibitset_next_set(&hbs, 1); position != 0; position = dats_hibitset_next_set(&hbs, position + 1))
+    {
+        found.push_back(position);
+    }
+    EXPECT_EQ(found, std::vector<uint64_t>(positions.begin(), positions.end()));
+
+    for (uint64_t start : { (uint64_t)2, size / 3, size / 2 + 17, size - 1 })
+    {
+        EXPECT_EQ(dats_hibitset_next_set(&hbs, start), *positions.lower_bound(start));
+    }
+
+    _mapped.clear();
+    dats_hibitset_map(&hbs, _collect);
+    EXPECT_EQ(_mapped, std::vector<uint64_t>(positions.begin(), positions.end()));
+
+    dats_hibitset_reset(&hbs);
+    EXPECT_TRUE(dats_hibitset_is_empty(&hbs));
+    EXPECT_EQ(dats_hibitset_count(&hbs), 0);
+
+    dats_hibitset_free(&hbs);
+}
+
+TEST(dats_hibitset_and, KeepOnlyCommonBits)
+{
+    const uint64_t size = 1000000;
+    std::set<uint64_t> a = _random_positions(size, 2000, 1);
+    std::set<uint64_t> b = _random_positions(size, 2000, 2);
+    for (uint64_t i = 0; i < 500; i++)
+    {
+        b.insert(*std::next(a.begin(), i * 3));
+    }
+    dats_hibitset_t first = dats_hibitset_new(size);
+    dats_hibitset_t second = dats_hibitset_new(size);
+    for (uint64_t position : a)
+    {
+        dats_hibitset_set(&first, position, true);
+    }
+    for (uint64_t position : b)
+    {
+        dats_hibitset_set(&second, position, true);
+    }
+
+    dats_hibitset_and(&first, &second);
+
+    std::vector<uint64_t> expected;
+    for (uint64_t position : a)
+    {
+        if (b.count(position) == 1)
+        {
+            expected.push_back(position);
+        }
+    }
+    _mapped.clear();
+    dats_hibitset_map(&first, _collect);
+    EXPECT_EQ(_mapped, expected);
+    EXPECT_EQ(dats_hibitset_count(&first), expected.size());
+
+    dats_hibitset_reset(&second);
+    dats_hibitset_and(&first, &second);
+    EXPECT_TRUE(dats_hibitset_is_empty(&first));
+    EXPECT_EQ(dats_hibitset_next_set(&first, 1), 0);
+
+    dats_hibitset_free(&first);
+    dats_hibitset_free(&second);
+}
+
+TEST(dats_hibitset_or, AddAllBitsOfOther)
+{
+    const uint64_t size = 1000000;
+    std::set<uint64_t> a = _random_positions(size, 1500, 3);
+    std::set<uint64_t> b = _random_positions(size, 1500, 4);
+    dats_hibitset_t first = dats_hibitset_new(size);
+    dats_hibitset_t second = dats_hibitset_new(size);
+    for (uint64_t position : a)
+    {
+        dats_hibitset_set(&first, position, true);
+    }
+    for (uint64_t position : b)
+    {
+        dats_hibitset_set(&second, position, true);
+    }
+
+    dats_hibitset_or(&first, &second);
+
+    a.insert(b.begin(), b.end());
+    _mapped.clear();
+    dats_hibitset_map(&first, _collect);
+    EXPECT_EQ(_mapped, std::vector<uint64_t>(a.begin(), a.end()));
+
+    dats_hibitset_free(&first);
+    dats_hibitset_free(&second);
+}
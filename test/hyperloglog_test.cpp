@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_hyperloglog_count, EmptyAndSmall)
+{
+    dats_hyperloglog_t hll = dats_hyperloglog_new(sizeof(uint64_t), 14);
+    EXPECT_EQ(dats_hyperloglog_count(&hll), 0);
+
+    for (uint64_t key = 0; key < 100; key++)
+    {
+        dats_hyperloglog_add(&hll, &key);
+        dats_hyperloglog_add(&hll, &key);
+    }
+    EXPECT_TRUE(dats_hyperloglog_is_sparse(&hll));
+    EXPECT_NEAR((double)dats_hyperloglog_count(&hll), 100.0, 2.0);
+
+    dats_hyperloglog_free(&hll);
+}
+
+TEST(dats_hyperloglog_count, ErrorWithinBoundsFromSparseToDense)
+{
+    dats_hyperloglog_t hll = dats_hyperloglog_new(sizeof(uint64_t), 12);
+    uint64_t key = 0;
+
+    for (uint64_t target : { 1000, 10000, 100000, 1000000 })
+    {
+        for (; key < target; key++)
+        {
+            dats_hyperloglog_add(&hll, &key);
+        }
+        /* 4 standard errors of 1.04 / sqrt(4096). */
+        double error = fabs((double)dats_hyperloglog_count(&hll) - (double)target) / (double)target;
+        EXPECT_LT(error, 4 * 1.04 / 64) << "count " << target;
+    }
+    EXPECT_FALSE(dats_hyperloglog_is_sparse(&hll));
+    EXPECT_EQ(dats_hyperloglog_memory_usage(&hll), 4096);
+
+    dats_hyperloglog_free(&hll);
+}
+
+static dats_hyperloglog_t _sketch_of_range(uint32_t first, uint32_t last)
+{
+    dats_hyperloglog_t hll = dats_hyperloglog_new(sizeof(uint32_t), 16);
+
+    for (uint32_t key = first; key < last; key++)
+    {
+        dats_hyperloglog_add(&hll, &key);
+    }
+    return hll;
+}
+
+TEST(dats_hyperloglog_merge, MergeEqualsSketchOfTheUnion)
+{
+    /* Both sparse, it stays sparse. */
+    dats_hyperloglog_t first = _sketch_of_range(0, 2000);
+    dats_hyperloglog_t second = _sketch_of_range(1000, 3000);
+    dats_hyperloglog_t expected = _sketch_of_range(0, 3000);
+
+    dats_hyperloglog_merge(&first, &second);
+    EXPECT_TRUE(dats_hyperloglog_is_sparse(&first));
+    EXPECT_EQ(dats_hyperloglog_count(&first), dats_hyperloglog_count(&expected));
+
+    /* Sparse into dense and dense into sparse give the same registers. */
+    dats_hyperloglog_t sparse = _sketch_of_range(0, 2000);
+    dats_hyperloglog_t dense = _sketch_of_range(1000, 100000);
+    dats_hyperloglog_t union_expected = _sketch_of_range(0, 100000);
+    ASSERT_TRUE(dats_hyperloglog_is_sparse(&sparse));
+    ASSERT_FALSE(dats_hyperloglog_is_sparse(&dense));
+
+    dats_hyperloglog_t sparse_copy = _sketch_of_range(0, 2000);
+    dats_hyperloglog_merge(&sparse_copy, &dense);
+    dats_hyperloglog_merge(&dense, &sparse);
+    EXPECT_FALSE(dats_hyperloglog_is_sparse(&sparse_copy));
+    EXPECT_EQ(dats_hyperloglog_count(&dense), dats_hyperloglog_count(&union_expected));
+    EXPECT_EQ(dats_hyperloglog_count(&sparse_copy), dats_hyperloglog_count(&union_expected));
+
+    dats_hyperloglog_clear(&dense);
+    EXPECT_TRUE(dats_hyperloglog_is_sparse(&dense));
+    EXPECT_EQ(dats_hyperloglog_count(&dense), 0);
+
+    dats_hyperloglog_free(&first);
+    dats_hyperloglog_free(&second);
+    dats_hyperloglog_free(&expected);
+    dats_hyperloglog_free(&sparse);
+    dats_hyperloglog_free(&dense);
+    dats_hyperloglog_free(&union_expected);
+    dats_hyperloglog_free(&sparse_copy);
+}
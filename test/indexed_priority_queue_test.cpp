@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <map>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+static int64_t _compare_uint64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+TEST(dats_indexed_priority_queue_new, CreateAnEmptyQueue)
+{
+    dats_indexed_priority_queue_t ipq = dats_indexed_priority_queue_new(sizeof(uint64_t), 4, _compare_uint64);
+
+    EXPECT_EQ(dats_indexed_priority_queue_length(&ipq), 0);
+    EXPECT_FALSE(dats_indexed_priority_queue_contains(&ipq, 0));
+    EXPECT_FALSE(dats_indexed_priority_queue_contains(&ipq, 1000));
+
+    dats_indexed_priority_queue_free(&ipq);
+}
+
+TEST(dats_indexed_priority_queue_decrease_key, MoveDataToTheTop)
+{
+    dats_indexed_priority_queue_t ipq = dats_indexed_priority_queue_new(sizeof(uint64_t), 4, _compare_uint64);
+
+    for (uint64_t id = 0; id < 20; id++)
+    {
+        uint64_t priority = 100 + id;
+        dats_indexed_priority_queue_push(&ipq, id, &priority);
+    }
+
+    uint64_t id = 99;
+    EXPECT_EQ(*((const uint64_t *)dats_indexed_priority_queue_peek(&ipq, &id)), 100);
+    EXPECT_EQ(id, 0);
+
+    uint64_t priority = 5;
+    dats_indexed_priority_queue_decrease_key(&ipq, 17, &priority);
+    EXPECT_EQ(*((const uint64_t *)dats_indexed_priority_queue_get(&ipq, 17)), 5);
+    EXPECT_EQ(*((const uint64_t *)dats_indexed_priority_queue_peek(&ipq, &id)), 5);
+    EXPECT_EQ(id, 17);
+
+    uint64_t out = 0;
+    dats_indexed_priority_queue_pop_into(&ipq, &id, &out);
+    EXPECT_EQ(id, 17);
+    EXPECT_EQ(out, 5);
+    EXPECT_FALSE(dats_indexed_priority_queue_contains(&ipq, 17));
+    EXPECT_EQ(dats_indexed_priority_queue_length(&ipq), 19);
+
+    dats_indexed_priority_queue_free(&ipq);
+}
+
+TEST(dats_indexed_priority_queue_remove, RemoveAnywhereKeepsOrder)
+{
+    dats_indexed_priority_queue_t ipq = dats_indexed_priority_queue_new(sizeof(uint64_t), 2, _compare_uint64);
+    std::map<uint64_t, uint64_t> expected;
+    uint64_t seed = 11;
+
+    for (uint64_t id = 0; id < 500; id++)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t priority = (seed >> 40) % 300;
+        dats_indexed_priority_queue_push(&ipq, id, &priority);
+        expected[priority * 1000 + id] = id;
+    }
+    for (uint64_t id = 0; id < 500; id += 3)
+    {
+        uint64_t priority = *((const uint64_t *)dats_indexed_priority_queue_get(&ipq, id));
+        dats_indexed_priority_queue_remove(&ipq, id);
+        expected.erase(priority * 1000 + id);
+    }
+    EXPECT_EQ(dats_indexed_priority_queue_length(&ipq), expected.size());
+
+    uint64_t previous = 0;
+    for (uint64_t i = 0; i < expected.size(); i++)
+    {
+        uint64_t id;
+        uint64_t priority;
+        dats_indexed_priority_queue_pop_into(&ipq, &id, &priority);
+        ASSERT_GE(priority, previous);
+        ASSERT_NE(id % 3, 0) << "Removed ids must not come out.";
+        EXPECT_EQ(expected.count(priority * 1000 + id), 1);
+        previous = priority;
+    }
+    EXPECT_EQ(dats_indexed_priority_queue_length(&ipq), 0);
+
+    dats_indexed_priority_queue_push(&ipq, 0, &previous);
+    EXPECT_TRUE(dats_indexed_priority_queue_contains(&ipq, 0));
+    dats_indexed_priority_queue_clear(&ipq);
+    EXPECT_FALSE(dats_indexed_priority_queue_contains(&ipq, 0));
+
+    dats_indexed_priority_queue_free(&ipq);
+}
+
+TEST(dats_indexed_priority_queue_decrease_key, DijkstraShortestPaths)
+{
+    const uint64_t nodes = 6;
+    const uint64_t infinity = UINT64_MAX;
+    uint64_t weights[6][6] = {
+        { 0, 7, 9, 0, 0, 14 },
+        { 7, 0, 10, 15, 0, 0 },
+        { 9, 10, 0, 11, 0, 2 },
+        { 0, 15, 11, 0, 6, 0 },
+        { 0, 0, 0, 6, 0, 9 },
+        { 14, 0, 2, 0, 9, 0 },
+    };
+    uint64_t distances[6];
+    dats_indexed_priority_queue_t ipq = dats_indexed_priority_queue_new(sizeof(uint64_t), 4, _compare_uint64);
+
+    for (uint64_t node = 0; node < nodes; node++)
+    {
+        distances[node] = node == 0 ? 0 : infinity;
+        dats_indexed_priority_queue_push(&ipq, node, &distances[node]);
+    }
+
+    while (dats_indexed_priority_queue_length(&ipq) > 0)
+    {
+        uint64_t node;
+        uint64_t distance;
+        dats_indexed_priority_queue_pop_into(&ipq, &node, &distance);
+
+        for (uint64_t next = 0; next < nodes; next++)
+        {
+            if (weights[node][next] == 0 || !dats_indexed_priority_queue_contains(&ipq, next))
+            {
+                continue;
+            }
+            uint64_t candidate = distance + weights[node][next];
+            if (candidate < distances[next])
+            {
+                distances[next] = candidate;
+                dats_indexed_priority_queue_decrease_key(&ipq, next, &candidate);
+            }
+        }
+    }
+
+    uint64_t expected[6] = { 0, 7, 9, 20, 20, 11 };
+    for (uint64_t node = 0; node < nodes; node++)
+    {
+        EXPECT_EQ(distances[node], expected[node]);
+    }
+
+    dats_indexed_priority_queue_free(&ipq);
+}
@@ -593,6 +593,457 @@ TEST(dats_linked_list_contains, FindOneItemThatExist)
     dats_linked_list_free(&ll);
 }
 
+TEST(dats_linked_list_insert_index, InsertedDataIsCopied)
+{
+    int data1 = 1;
+    int data2 = 2;
+    int data3 = 3;
+
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    dats_linked_list_insert_tail(&ll, &data1);
+    dats_linked_list_insert_tail(&ll, &data3);
+
+    dats_linked_list_insert_index(&ll, 1, &data2);
+
+    EXPECT_EQ(*((const int*)dats_linked_list_get(&ll, 1)), data2);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_cursor_new, IterateThroughLinkedList)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+
+    dats_linked_list_cursor_t empty = dats_linked_list_cursor_new(&ll);
+    EXPECT_EQ(dats_linked_list_cursor_is_valid(&empty), false);
+
+    for (int i = 0; i < 5; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+    }
+
+    int expected = 0;
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(&ll);
+    for (; dats_linked_list_cursor_is_valid(&cursor); dats_linked_list_cursor_next(&cursor))
+    {
+        EXPECT_EQ(*((const int*)dats_linked_list_cursor_get(&cursor)), expected);
+        EXPECT_EQ(cursor.index, (uint64_t)expected);
+        expected++;
+    }
+    EXPECT_EQ(expected, 5);
+
+    dats_linked_list_cursor_t at = dats_linked_list_cursor_at(&ll, 3);
+    EXPECT_EQ(*((const int*)dats_linked_list_cursor_get(&at)), 3);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_cursor_insert_after, InsertAfterTailAndMiddle)
+{
+    int data1 = 1;
+    int data2 = 2;
+    int data3 = 3;
+
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    dats_linked_list_insert_tail(&ll, &data1);
+
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(&ll);
+    dats_linked_list_cursor_insert_after(&ll, &cursor, &data3);
+
+    EXPECT_EQ(*((int*)ll.tail->data), data3) << "Inserting after the tail must move the tail.";
+
+    dats_linked_list_cursor_insert_after(&ll, &cursor, &data2);
+
+    EXPECT_EQ(ll.length, 3);
+    EXPECT_EQ(*((int*)ll.tail->data), data3);
+    dats_linked_list_cursor_next(&cursor);
+    EXPECT_EQ(*((const int*)dats_linked_list_cursor_get(&cursor)), data2);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_cursor_remove_after, RemoveTailAndMiddle)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    for (int i = 0; i < 4; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+    }
+
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(&ll);
+    int *removed = (int*)dats_linked_list_cursor_remove_after(&ll, &cursor);
+    EXPECT_EQ(*removed, 1);
+    free(removed);
+
+    dats_linked_list_cursor_next(&cursor);
+    removed = (int*)dats_linked_list_cursor_remove_after(&ll, &cursor);
+    EXPECT_EQ(*removed, 3);
+    free(removed);
+
+    EXPECT_EQ(ll.length, 2);
+    EXPECT_EQ(ll.tail, cursor.node) << "Removing the tail must move the tail to the cursor node.";
+    EXPECT_EQ(*((const int*)dats_linked_list_get_tail(&ll)), 2);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_cursor_replace, ReplaceEveryData)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    for (int i = 0; i < 3; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+    }
+
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(&ll);
+    for (; dats_linked_list_cursor_is_valid(&cursor); dats_linked_list_cursor_next(&cursor))
+    {
+        int doubled = *((const int*)dats_linked_list_cursor_get(&cursor)) * 2;
+        dats_linked_list_cursor_replace(&ll, &cursor, &doubled);
+    }
+
+    EXPECT_EQ(*((const int*)dats_linked_list_get(&ll, 2)), 4);
+    EXPECT_EQ(ll.length, 3);
+
+    dats_linked_list_free(&ll);
+}
+
+static dats_linked_list_t _range_linked_list(int from, int to)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    for (int i = from; i < to; i++)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+    }
+    return ll;
+}
+
+static void _expect_range(const dats_linked_list_t *ll, int from, int to)
+{
+    ASSERT_EQ(ll->length, (uint64_t)(to - from));
+    int expected = from;
+    for (dats_node_t *node = ll->head; node != NULL; node = node->next_node)
+    {
+        EXPECT_EQ(*((int*)node->data), expected);
+        expected++;
+    }
+    EXPECT_EQ(expected, to);
+    if (ll->length > 0)
+    {
+        EXPECT_EQ(*((int*)ll->tail->data), to - 1);
+        EXPECT_EQ(ll->tail->next_node, nullptr);
+    }
+}
+
+TEST(dats_linked_list_append_list, StealNodesOfOther)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 3);
+    dats_linked_list_t other = _range_linked_list(3, 6);
+    dats_node_t *other_head = other.head;
+
+    dats_linked_list_append_list(&ll, &other);
+
+    _expect_range(&ll, 0, 6);
+    EXPECT_EQ(ll.head->next_node->next_node->next_node, other_head) << "The nodes must be moved, not copied.";
+    EXPECT_EQ(other.head, nullptr);
+    EXPECT_EQ(other.tail, nullptr);
+    EXPECT_EQ(other.length, 0);
+
+    dats_linked_list_t empty = dats_linked_list_new(sizeof(int));
+    dats_linked_list_append_list(&empty, &ll);
+    _expect_range(&empty, 0, 6);
+
+    dats_linked_list_free(&ll);
+    dats_linked_list_free(&other);
+    dats_linked_list_free(&empty);
+}
+
+TEST(dats_linked_list_splice, SpliceHeadMiddleAndTail)
+{
+    dats_linked_list_t ll = _range_linked_list(2, 4);
+    dats_linked_list_t first = _range_linked_list(0, 2);
+    dats_linked_list_t middle = _range_linked_list(4, 6);
+    dats_linked_list_t last = _range_linked_list(6, 8);
+
+    dats_linked_list_splice(&ll, 0, &first);
+    _expect_range(&ll, 0, 4);
+
+    dats_linked_list_splice(&ll, 4, &last);
+    dats_linked_list_t tail = dats_linked_list_split_at(&ll, 4);
+    dats_linked_list_splice(&ll, 4, &middle);
+    dats_linked_list_append_list(&ll, &tail);
+    _expect_range(&ll, 0, 8);
+
+    dats_linked_list_free(&ll);
+    dats_linked_list_free(&first);
+    dats_linked_list_free(&middle);
+    dats_linked_list_free(&last);
+    dats_linked_list_free(&tail);
+}
+
+TEST(dats_linked_list_split_at, SplitInTwo)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 5);
+
+    dats_linked_list_t second = dats_linked_list_split_at(&ll, 2);
+    _expect_range(&ll, 0, 2);
+    _expect_range(&second, 2, 5);
+
+    dats_linked_list_t everything = dats_linked_list_split_at(&second, 0);
+    _expect_range(&second, 0, 0);
+    EXPECT_EQ(second.head, nullptr);
+    _expect_range(&everything, 2, 5);
+
+    dats_linked_list_t nothing = dats_linked_list_split_at(&ll, 2);
+    EXPECT_EQ(nothing.length, 0);
+    _expect_range(&ll, 0, 2);
+
+    dats_linked_list_free(&ll);
+    dats_linked_list_free(&second);
+    dats_linked_list_free(&everything);
+    dats_linked_list_free(&nothing);
+}
+
+TEST(dats_linked_list_cursor_splice_after, SpliceAfterCursor)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 2);
+    dats_linked_list_t other = _range_linked_list(10, 12);
+
+    dats_linked_list_cursor_t cursor = dats_linked_list_cursor_new(&ll);
+    dats_linked_list_cursor_splice_after(&ll, &cursor, &other);
+
+    int expected[] = { 0, 10, 11, 1 };
+    ASSERT_EQ(ll.length, 4);
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(*((const int*)dats_linked_list_get(&ll, i)), expected[i]);
+    }
+    EXPECT_EQ(*((int*)ll.tail->data), 1);
+
+    dats_linked_list_free(&ll);
+    dats_linked_list_free(&other);
+}
+
+static int64_t _compare_int(const void *a, const void *b)
+{
+    int x = *((const int*)a);
+    int y = *((const int*)b);
+    return (x > y) - (x < y);
+}
+
+static int64_t _compare_position_x(const void *a, const void *b)
+{
+    uint64_t x = ((const _Fake_Position*)a)->x;
+    uint64_t y = ((const _Fake_Position*)b)->x;
+    return (x > y) - (x < y);
+}
+
+TEST(dats_linked_list_sort, SortRelinksNodes)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    uint64_t state = 42;
+    for (int i = 0; i < 1000; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        int data = (int)(state >> 40) % 500;
+        dats_linked_list_insert_tail(&ll, &data);
+    }
+    dats_node_t *some_node = ll.head->next_node;
+
+    dats_linked_list_sort(&ll, _compare_int);
+
+    EXPECT_EQ(ll.length, 1000);
+    bool found_node = false;
+    uint64_t count = 0;
+    for (dats_node_t *node = ll.head; node != NULL; node = node->next_node)
+    {
+        if (node->next_node != NULL)
+        {
+            EXPECT_LE(*((int*)node->data), *((int*)node->next_node->data));
+        }
+        found_node |= node == some_node;
+        count++;
+    }
+    EXPECT_EQ(count, 1000);
+    EXPECT_TRUE(found_node) << "The nodes must be relinked, not reallocated.";
+    EXPECT_EQ(ll.tail->next_node, nullptr);
+    EXPECT_EQ(*((int*)ll.tail->data), *((const int*)dats_linked_list_get(&ll, 999)));
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_sort, SortIsStable)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(_Fake_Position));
+    for (uint64_t i = 0; i < 30; i++)
+    {
+        _Fake_Position pos = { (i * 7) % 3, i };
+        dats_linked_list_insert_tail(&ll, &pos);
+    }
+
+    dats_linked_list_sort(&ll, _compare_position_x);
+
+    for (dats_node_t *node = ll.head; node->next_node != NULL; node = node->next_node)
+    {
+        const _Fake_Position *a = (const _Fake_Position*)node->data;
+        const _Fake_Position *b = (const _Fake_Position*)node->next_node->data;
+        EXPECT_LE(a->x, b->x);
+        if (a->x == b->x)
+        {
+            EXPECT_LT(a->y, b->y) << "Equal data must keep their original order.";
+        }
+    }
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_sort, PowerOfTwoLengthUpdatesTail)
+{
+    for (int length : { 2, 4, 64 })
+    {
+        dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+        for (int i = length; i > 0; i--)
+        {
+            dats_linked_list_insert_tail(&ll, &i);
+        }
+
+        dats_linked_list_sort(&ll, _compare_int);
+
+        EXPECT_EQ(ll.tail->next_node, nullptr) << "length " << length;
+        EXPECT_EQ(*((int*)ll.tail->data), length);
+
+        int data = length + 1;
+        dats_linked_list_insert_tail(&ll, &data);
+        uint64_t count = 0;
+        for (dats_node_t *node = ll.head; node != NULL; node = node->next_node)
+        {
+            count++;
+            EXPECT_EQ(*((int*)node->data), (int)count);
+        }
+        EXPECT_EQ(count, (uint64_t)length + 1);
+        EXPECT_EQ(ll.length, (uint64_t)length + 1);
+
+        dats_linked_list_free(&ll);
+    }
+}
+
+TEST(dats_linked_list_merge_sorted, MergeTwoSortedLinkedList)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    dats_linked_list_t other = dats_linked_list_new(sizeof(int));
+    for (int i = 0; i < 10; i += 2)
+    {
+        dats_linked_list_insert_tail(&ll, &i);
+    }
+    for (int i = 1; i < 14; i += 2)
+    {
+        dats_linked_list_insert_tail(&other, &i);
+    }
+
+    dats_linked_list_merge_sorted(&ll, &other, _compare_int);
+
+    int expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 11, 13 };
+    ASSERT_EQ(ll.length, 12);
+    for (uint64_t i = 0; i < 12; i++)
+    {
+        EXPECT_EQ(*((const int*)dats_linked_list_get(&ll, i)), expected[i]);
+    }
+    EXPECT_EQ(*((int*)ll.tail->data), 13);
+    EXPECT_EQ(other.length, 0);
+    EXPECT_EQ(other.head, nullptr);
+
+    dats_linked_list_free(&ll);
+    dats_linked_list_free(&other);
+}
+
+TEST(dats_linked_list_remove_head_into, CopyRemovedDataIntoBuffer)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 5);
+    int out = -1;
+
+    dats_linked_list_remove_head_into(&ll, &out);
+    EXPECT_EQ(out, 0);
+    dats_linked_list_remove_tail_into(&ll, &out);
+    EXPECT_EQ(out, 4);
+    dats_linked_list_remove_index_into(&ll, 1, &out);
+    EXPECT_EQ(out, 2);
+
+    ASSERT_EQ(ll.length, 2);
+    EXPECT_EQ(*((int*)ll.head->data), 1);
+    EXPECT_EQ(*((int*)ll.tail->data), 3);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_remove_head_discard, DiscardUntilEmpty)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 5);
+
+    dats_linked_list_remove_index_discard(&ll, 2);
+    ASSERT_EQ(ll.length, 4);
+    EXPECT_EQ(*((int*)ll.head->next_node->next_node->data), 3);
+    dats_linked_list_remove_tail_discard(&ll);
+    dats_linked_list_remove_head_discard(&ll);
+    dats_linked_list_remove_head_discard(&ll);
+    dats_linked_list_remove_tail_discard(&ll);
+
+    EXPECT_EQ(ll.head, nullptr);
+    EXPECT_EQ(ll.tail, nullptr);
+    EXPECT_EQ(ll.length, 0);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_insert_head_n, SpliceBatchInFrontOfTheHead)
+{
+    dats_linked_list_t ll = dats_linked_list_new(sizeof(int));
+    int first[3] = {0, 1, 2};
+    int second[2] = {3, 4};
+
+    dats_linked_list_insert_head_n(&ll, first, 3);
+    EXPECT_EQ(*((int*)ll.tail->data), 0);
+    dats_linked_list_insert_head_n(&ll, second, 2);
+    dats_linked_list_insert_head_n(&ll, second, 0);
+
+    ASSERT_EQ(ll.length, 5);
+    dats_node_t *node = ll.head;
+    for (int i = 4; i >= 0; i--)
+    {
+        EXPECT_EQ(*((int*)node->data), i);
+        node = node->next_node;
+    }
+    EXPECT_EQ(node, nullptr);
+    EXPECT_EQ(*((int*)ll.tail->data), 0);
+
+    dats_linked_list_free(&ll);
+}
+
+TEST(dats_linked_list_remove_head_n_into, DetachBatchFromTheHead)
+{
+    dats_linked_list_t ll = _range_linked_list(0, 5);
+    int out[5] = {-1, -1, -1, -1, -1};
+
+    dats_linked_list_remove_head_n_into(&ll, out, 3);
+    EXPECT_EQ(out[0], 0);
+    EXPECT_EQ(out[1], 1);
+    EXPECT_EQ(out[2], 2);
+    ASSERT_EQ(ll.length, 2);
+    EXPECT_EQ(*((int*)ll.head->data), 3);
+
+    dats_linked_list_remove_head_n_into(&ll, out, 2);
+    EXPECT_EQ(out[0], 3);
+    EXPECT_EQ(out[1], 4);
+    EXPECT_EQ(ll.head, nullptr);
+    EXPECT_EQ(ll.tail, nullptr);
+    EXPECT_EQ(ll.length, 0);
+
+    int data = 7;
+    dats_linked_list_insert_tail(&ll, &data);
+    EXPECT_EQ(ll.head, ll.tail);
+
+    dats_linked_list_free(&ll);
+}
+
 TEST(dats_linked_list_length, VariousLengthTest)
 {
     short data1 = 1111;
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+TEST(dats_mpmc_queue_new, CapacityIsRoundedToPowerOfTwo)
+{
+    dats_mpmc_queue_t q = dats_mpmc_queue_new(sizeof(_Fake_Position), 3);
+
+    EXPECT_EQ(q.data_size, sizeof(_Fake_Position));
+    EXPECT_EQ(q.capacity, 4);
+    EXPECT_EQ(q.cell_size % 16, 0);
+    EXPECT_EQ(dats_mpmc_queue_length(&q), 0);
+
+    dats_mpmc_queue_free(&q);
+}
+
+TEST(dats_mpmc_queue_try_enqueue, FifoUntilFullThenEmpty)
+{
+    dats_mpmc_queue_t q = dats_mpmc_queue_new(sizeof(_Fake_Position), 4);
+    _Fake_Position out = { 0, 0 };
+
+    EXPECT_FALSE(dats_mpmc_queue_try_dequeue(&q, &out));
+
+    for (uint64_t round = 0; round < 3; round++)
+    {
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            _Fake_Position data = { round, i };
+            EXPECT_TRUE(dats_mpmc_queue_try_enqueue(&q, &data));
+        }
+        _Fake_Position extra = { 99, 99 };
+        EXPECT_FALSE(dats_mpmc_queue_try_enqueue(&q, &extra));
+        EXPECT_EQ(dats_mpmc_queue_length(&q), 4);
+
+        for (uint64_t i = 0; i < 4; i++)
+        {
+            EXPECT_TRUE(dats_mpmc_queue_try_dequeue(&q, &out));
+            EXPECT_EQ(out.x, round);
+            EXPECT_EQ(out.y, i);
+        }
+        EXPECT_FALSE(dats_mpmc_queue_try_dequeue(&q, &out));
+    }
+
+    dats_mpmc_queue_free(&q);
+}
+
+TEST(dats_mpmc_queue_dequeue, ManyProducersAndConsumers)
+{
+    const uint64_t threads = 4;
+    const uint64_t per_producer = 20000;
+    dats_mpmc_queue_t q = dats_mpmc_queue_new(sizeof(uint64_t), 64);
+    std::vector<std::thread> workers;
+    std::vector<uint64_t> sums(threads, 0);
+
+    for (uint64_t t = 0; t < threads; t++)
+    {
+        workers.emplace_back([&q, t, per_producer]() {
+            for (uint64_t i = 1; i <= per_producer; i++)
+            {
+                uint64_t data = t * per_producer + i;
+                dats_mpmc_queue_enqueue(&q, &data);
+            }
+        });
+        workers.emplace_back([&q, &sums, t, per_producer]() {
+            for (uint64_t i = 0; i < per_producer; i++)
+            {
+                uint64_t data;
+                dats_mpmc_queue_dequeue(&q, &data);
+                sums[t] += data;
+            }
+        });
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    uint64_t total = 0;
+    for (uint64_t sum : sums)
+    {
+        total += sum;
+    }
+    uint64_t n = threads * per_producer;
+    EXPECT_EQ(total, n * (n + 1) / 2) << "Every data must be dequeued exactly once.";
+    EXPECT_EQ(dats_mpmc_queue_length(&q), 0);
+
+    dats_mpmc_queue_free(&q);
+}
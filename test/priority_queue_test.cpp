@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+static int64_t _compare_int(const void *a, const void *b)
+{
+    int x = *(const int *)a;
+    int y = *(const int *)b;
+    return (x > y) - (x < y);
+}
+
+static int64_t _compare_position_x(const void *a, const void *b)
+{
+    uint64_t x = ((const _Fake_Position *)a)->x;
+    uint64_t y = ((const _Fake_Position *)b)->x;
+    return (x > y) - (x < y);
+}
+
+TEST(dats_priority_queue_new, CreateAnEmptyPriorityQueue)
+{
+    dats_priority_queue_t pq = dats_priority_queue_new(sizeof(_Fake_Position), _compare_position_x);
+
+    EXPECT_EQ(pq.heap.data_size, sizeof(_Fake_Position));
+    EXPECT_EQ(dats_priority_queue_length(&pq), 0);
+
+    dats_priority_queue_free(&pq);
+    EXPECT_EQ(pq.heap.scratch, nullptr);
+}
+
+TEST(dats_priority_queue_push, PeekAlwaysTheSmallest)
+{
+    dats_priority_queue_t pq = dats_priority_queue_new(sizeof(_Fake_Position), _compare_position_x);
+    _Fake_Position data[5] = { { 5, 0 }, { 3, 1 }, { 8, 2 }, { 1, 3 }, { 3, 4 } };
+    uint64_t expected_peek[5] = { 5, 3, 3, 1, 1 };
+
+    for (int i = 0; i < 5; i++)
+    {
+        dats_priority_queue_push(&pq, &data[i]);
+        EXPECT_EQ(((const _Fake_Position *)dats_priority_queue_peek(&pq))->x, expected_peek[i]);
+    }
+    EXPECT_EQ(dats_priority_queue_length(&pq), 5) << "Equal priorities must be kept.";
+
+    _Fake_Position out;
+    uint64_t expected_pop[5] = { 1, 3, 3, 5, 8 };
+    for (int i = 0; i < 5; i++)
+    {
+        dats_priority_queue_pop_into(&pq, &out);
+        EXPECT_EQ(out.x, expected_pop[i]);
+    }
+    EXPECT_EQ(dats_priority_queue_length(&pq), 0);
+
+    dats_priority_queue_free(&pq);
+}
+
+TEST(dats_priority_queue_from_array, HeapifyThenPopSorted)
+{
+    std::vector<int> data;
+    uint32_t value = 17;
+    for (int i = 0; i < 1000; i++)
+    {
+        value = (value * 1103515245u + 12345u) & 0x7fffffffu;
+        data.push_back((int)(value % 500));
+    }
+
+    dats_priority_queue_t pq = dats_priority_queue_from_array(sizeof(int), _compare_int, data.data(), data.size());
+    EXPECT_EQ(dats_priority_queue_length(&pq), 1000);
+
+    std::sort(data.begin(), data.end());
+    for (int i = 0; i < 500; i++)
+    {
+        int out;
+        dats_priority_queue_pop_into(&pq, &out);
+        ASSERT_EQ(out, data[i]);
+    }
+
+    int extra = -1;
+    dats_priority_queue_push(&pq, &extra);
+    EXPECT_EQ(*((const int *)dats_priority_queue_peek(&pq)), -1);
+
+    dats_priority_queue_clear(&pq);
+    EXPECT_EQ(dats_priority_queue_length(&pq), 0);
+
+    dats_priority_queue_free(&pq);
+}
+
+TEST(dats_priority_queue_from_array, EmptyArray)
+{
+    dats_priority_queue_t pq = dats_priority_queue_from_array(sizeof(int), _compare_int, NULL, 0);
+    int data = 4;
+
+    EXPECT_EQ(dats_priority_queue_length(&pq), 0);
+    dats_priority_queue_push(&pq, &data);
+    EXPECT_EQ(*((const int *)dats_priority_queue_peek(&pq)), 4);
+
+    dats_priority_queue_free(&pq);
+}
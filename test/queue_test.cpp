@@ -98,6 +98,57 @@ TEST(dats_queue_dequeue, DequeueTwoItemQueue)
     dats_queue_free(&q);
 }
 
+TEST(dats_queue_dequeue_into, DequeueIntoBufferAndDiscard)
+{
+    _Fake_Position data1 = { 1, 2 };
+    _Fake_Position data2 = { 3, 4 };
+    _Fake_Position data3 = { 5, 6 };
+    dats_queue_t q = dats_queue_new(sizeof(_Fake_Position));
+
+    dats_queue_enqueue(&q, &data1);
+    dats_queue_enqueue(&q, &data2);
+    dats_queue_enqueue(&q, &data3);
+
+    _Fake_Position out;
+    dats_queue_dequeue_into(&q, &out);
+    EXPECT_EQ(out.x, data1.x);
+    EXPECT_EQ(out.y, data1.y);
+
+    dats_queue_dequeue_discard(&q);
+    dats_queue_dequeue_into(&q, &out);
+    EXPECT_EQ(out.x, data3.x);
+    EXPECT_EQ(out.y, data3.y);
+    EXPECT_EQ(dats_queue_length(&q), 0);
+
+    dats_queue_free(&q);
+}
+
+TEST(dats_queue_enqueue_n, EnqueueAndDequeueBatches)
+{
+    int data[5] = { 1, 2, 3, 4, 5 };
+    dats_queue_t q = dats_queue_new(sizeof(int));
+
+    dats_queue_enqueue_n(&q, data, 5);
+    EXPECT_EQ(dats_queue_length(&q), 5);
+    EXPECT_EQ(*((const int*)dats_queue_peek(&q)), 1);
+
+    int out[5] = { 0 };
+    dats_queue_dequeue_n(&q, out, 3);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[1], 2);
+    EXPECT_EQ(out[2], 3);
+
+    dats_queue_enqueue_n(&q, data, 2);
+    dats_queue_dequeue_n(&q, out, 4);
+    EXPECT_EQ(out[0], 4);
+    EXPECT_EQ(out[1], 5);
+    EXPECT_EQ(out[2], 1);
+    EXPECT_EQ(out[3], 2);
+    EXPECT_EQ(dats_queue_length(&q), 0);
+
+    dats_queue_free(&q);
+}
+
 TEST(dats_queue_peek, PeekOneItemQueue)
 {
     _Fake_Position data1 = { 111, 222 };
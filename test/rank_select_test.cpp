@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+/* Fills the bitset with roughly one bit set every spacing positions and gives back the sorted positions set. */
+static std::vector<uint64_t> _fill(dats_bitset_t *bt, uint64_t spacing, uint64_t seed)
+{
+    std::vector<uint64_t> positions;
+    for (uint64_t position = 1; position <= bt->size; position++)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        if ((seed >> 33) % spacing == 0)
+        {
+            dats_bitset_set(bt, position, true);
+            positions.push_back(position);
+        }
+    }
+    return positions;
+}
+
+static void _expect_matches(const dats_bitset_t *bt, const std::vector<uint64_t> &positions)
+{
+    dats_rank_select_t rs = dats_rank_select_new(bt);
+    EXPECT_EQ(dats_rank_select_count(&rs), positions.size());
+
+    uint64_t rank = 0;
+    for (uint64_t position = 1; position <= bt->size + 1; position++)
+    {
+        ASSERT_EQ(dats_rank_select_rank(&rs, position), rank) << "position " << position;
+        if (position <= bt->size && dats_bitset_is_set(bt, position))
+        {
+            rank++;
+        }
+    }
+
+    for (uint64_t i = 0; i < positions.size(); i++)
+    {
+        ASSERT_EQ(dats_rank_select_select(&rs, i + 1), positions[i]) << "rank " << i + 1;
+    }
+    EXPECT_EQ(dats_rank_select_select(&rs, positions.size() + 1), 0);
+
+    dats_rank_select_free(&rs);
+    EXPECT_EQ(rs.lower, nullptr);
+}
+
+TEST(dats_rank_select_new, EmptyBitset)
+{
+    dats_bitset_t bt = dats_bitset_new(100);
+    dats_rank_select_t rs = dats_rank_select_new(&bt);
+
+    EXPECT_EQ(dats_rank_select_count(&rs), 0);
+    EXPECT_EQ(dats_rank_select_rank(&rs, 1), 0);
+    EXPECT_EQ(dats_rank_select_rank(&rs, 101), 0);
+    EXPECT_EQ(dats_rank_select_select(&rs, 1), 0);
+
+    dats_rank_select_free(&rs);
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_rank_select_rank, SmallBitsetNotMultipleOfAWord)
+{
+    dats_bitset_t bt = dats_bitset_new(77);
+    dats_bitset_set(&bt, 1, true);
+    dats_bitset_set(&bt, 64, true);
+    dats_bitset_set(&bt, 65, true);
+    dats_bitset_set(&bt, 77, true);
+
+    _expect_matches(&bt, { 1, 64, 65, 77 });
+
+    dats_bitset_free(&bt);
+}
+
+TEST(dats_rank_select_rank, DenseAndSparseBitsets)
+{
+    for (uint64_t spacing : { 1, 2, 7, 300 })
+    {
+        dats_bitset_t bt = dats_bitset_new(100000 + spacing);
+        std::vector<uint64_t> positions = _fill(&bt, spacing, spacing);
+
+        _expect_matches(&bt, positions);
+
+        dats_bitset_free(&bt);
+    }
+}
+
+TEST(dats_rank_select_select, FarApartBitsBetweenSamples)
+{
+    dats_bitset_t bt = dats_bitset_new(3000000);
+    std::vector<uint64_t> positions;
+
+    for (uint64_t position = 1; position <= 20000; position++)
+    {
+        positions.push_back(position);
+    }
+    positions.push_back(1500000);
+    positions.push_back(2999999);
+    positions.push_back(3000000);
+    for (uint64_t position : positions)
+    {
+        dats_bitset_set(&bt, position, true);
+    }
+
+    dats_rank_select_t rs = dats_rank_select_new(&bt);
+    for (uint64_t i = 0; i < positions.size(); i++)
+    {
+        ASSERT_EQ(dats_rank_select_select(&rs, i + 1), positions[i]);
+        ASSERT_EQ(dats_rank_select_rank(&rs, positions[i]), i);
+    }
+    EXPECT_EQ(dats_rank_select_rank(&rs, 1499999), 20000);
+    EXPECT_EQ(dats_rank_select_rank(&rs, 3000001), positions.size());
+
+    dats_rank_select_free(&rs);
+    dats_bitset_free(&bt);
+}
@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+static std::vector<uint32_t> _mapped;
+
+static void _collect(uint32_t value)
+{
+    _mapped.push_back(value);
+}
+
+static std::vector<uint32_t> _values(const dats_roaring_bitmap_t *rb)
+{
+    _mapped.clear();
+    dats_roaring_bitmap_map(rb, _collect);
+    return _mapped;
+}
+
+static const dats_roaring_container_t *_container(const dats_roaring_bitmap_t *rb, uint64_t index)
+{
+    return (const dats_roaring_container_t *)dats_dynamic_array_get(&rb->containers, index);
+}
+
+/* Sparse values everywhere plus one dense chunk and one chunk of long runs, to get every kind of container. */
+static std::set<uint32_t> _mixed_values(uint64_t seed)
+{
+    std::set<uint32_t> values;
+    for (uint32_t i = 0; i < 3000; i++)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        values.insert((uint32_t)(seed >> 32));
+    }
+    for (uint32_t i = 0; i < 20000; i++)
+    {
+        seed = seed * 6364136223846793005ull + 1442695040888963407ull;
+        values.insert((7u << 16) | (uint32_t)((seed >> 40) & 0xffff));
+    }
+    for (uint32_t i = 0; i < 60000; i++)
+    {
+        if ((i / 1000 + seed) % 3 != 0)
+        {
+            values.insert((9u << 16) | i);
+        }
+    }
+    return values;
+}
+
+static dats_roaring_bitmap_t _from_set(const std::set<uint32_t> &values)
+{
+    dats_roaring_bitmap_t rb = dats_roaring_bitmap_new();
+    for (uint32_t value : values)
+    {
+        dats_roaring_bitmap_add(&rb, value);
+    }
+    return rb;
+}
+
+TEST(dats_roaring_bitmap_add, AddContainsAndRemove)
+{
+    dats_roaring_bitmap_t rb = dats_roaring_bitmap_new();
+
+    EXPECT_TRUE(dats_roaring_bitmap_add(&rb, 0));
+    EXPECT_TRUE(dats_roaring_bitmap_add(&rb, UINT32_MAX));
+    EXPECT_TRUE(dats_roaring_bitmap_add(&rb, 70000));
+    EXPECT_FALSE(dats_roaring_bitmap_add(&rb, 70000));
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), 3);
+    EXPECT_EQ(dats_dynamic_array_length(&rb.containers), 3);
+
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 0));
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 70000));
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 70001));
+    EXPECT_EQ(_values(&rb), std::vector<uint32_t>({ 0, 70000, UINT32_MAX }));
+
+    EXPECT_TRUE(dats_roaring_bitmap_remove(&rb, 70000));
+    EXPECT_FALSE(dats_roaring_bitmap_remove(&rb, 70000));
+    EXPECT_FALSE(dats_roaring_bitmap_remove(&rb, 12));
+    EXPECT_EQ(dats_dynamic_array_length(&rb.containers), 2);
+
+    dats_roaring_bitmap_clear(&rb);
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), 0);
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 0));
+
+    dats_roaring_bitmap_free(&rb);
+}
+
+TEST(dats_roaring_bitmap_add, ArrayBecomesBitmapAndBack)
+{
+    dats_roaring_bitmap_t rb = dats_roaring_bitmap_new();
+
+    for (uint32_t i = 0; i < DATS_ROARING_ARRAY_MAX_CARDINALITY; i++)
+    {
+        dats_roaring_bitmap_add(&rb, i * 3);
+    }
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_ARRAY);
+
+    dats_roaring_bitmap_add(&rb, 1);
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_BITMAP);
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), DATS_ROARING_ARRAY_MAX_CARDINALITY + 1);
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 3 * 100));
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 3 * 100 + 1));
+
+    dats_roaring_bitmap_remove(&rb, 3);
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_ARRAY);
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 1));
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 3));
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), DATS_ROARING_ARRAY_MAX_CARDINALITY);
+
+    dats_roaring_bitmap_free(&rb);
+}
+
+TEST(dats_roaring_bitmap_run_optimize, RangesBecomeRuns)
+{
+    dats_roaring_bitmap_t rb = dats_roaring_bitmap_new();
+
+    for (uint32_t i = 100; i < 60000; i++)
+    {
+        dats_roaring_bitmap_add(&rb, i);
+    }
+    dats_roaring_bitmap_add(&rb, 65535);
+    uint64_t bytes = dats_roaring_bitmap_memory_usage(&rb);
+
+    dats_roaring_bitmap_run_optimize(&rb);
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_RUN);
+    EXPECT_EQ(_container(&rb, 0)->length, 2);
+    EXPECT_LT(dats_roaring_bitmap_memory_usage(&rb), bytes);
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 100));
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 59999));
+    EXPECT_TRUE(dats_roaring_bitmap_contains(&rb, 65535));
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 99));
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 60000));
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), 59901);
+
+    std::vector<uint32_t> values = _values(&rb);
+    EXPECT_EQ(values.size(), 59901);
+    EXPECT_EQ(values.front(), 100);
+    EXPECT_EQ(values.back(), 65535);
+
+    EXPECT_FALSE(dats_roaring_bitmap_add(&rb, 500));
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_RUN);
+    EXPECT_TRUE(dats_roaring_bitmap_remove(&rb, 500));
+    EXPECT_EQ(_container(&rb, 0)->type, DATS_ROARING_BITMAP);
+    EXPECT_FALSE(dats_roaring_bitmap_contains(&rb, 500));
+    EXPECT_EQ(dats_roaring_bitmap_cardinality(&rb), 59900);
+
+    dats_roaring_bitmap_free(&rb);
+}
+
+TEST(dats_roaring_bitmap_and, SetOperationsMatchStdSet)
+{
+    std::set<uint32_t> a = _mixed_values(1);
+    std::set<uint32_t> b = _mixed_values(2);
+    dats_roaring_bitmap_t first = _from_set(a);
+    dats_roaring_bitmap_t second = _from_set(b);
+
+    for (bool optimize : { false, true })
+    {
+        if (optimize)
+        {
+            dats_roaring_bitmap_run_optimize(&first);
+            dats_roaring_bitmap_run_optimize(&second);
+        }
+
+        std::vector<uint32_t> expected;
+        dats_roaring_bitmap_t result = dats_roaring_bitmap_and(&first, &second);
+        std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        EXPECT_EQ(_values(&result), expected);
+        EXPECT_EQ(dats_roaring_bitmap_cardinality(&result), expected.size());
+        dats_roaring_bitmap_free(&result);
+
+        expected.clear();
+        result = dats_roaring_bitmap_or(&first, &second);
+        std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        EXPECT_EQ(_values(&result), expected);
+        EXPECT_EQ(dats_roaring_bitmap_cardinality(&result), expected.size());
+        dats_roaring_bitmap_free(&result);
+
+        expected.clear();
+        result = dats_roaring_bitmap_xor(&first, &second);
+        std::set_symmetric_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        EXPECT_EQ(_values(&result), expected);
+        EXPECT_EQ(dats_roaring_bitmap_cardinality(&result), expected.size());
+        dats_roaring_bitmap_free(&result);
+
+        expected.clear();
+        result = dats_roaring_bitmap_and_not(&first, &second);
+        std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+        EXPECT_EQ(_values(&result), expected);
+        EXPECT_EQ(dats_roaring_bitmap_cardinality(&result), expected.size());
+        dats_roaring_bitmap_free(&result);
+    }
+
+    dats_roaring_bitmap_free(&first);
+    dats_roaring_bitmap_free(&second);
+}
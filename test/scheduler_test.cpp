@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+static std::atomic<uint64_t> _sum(0);
+
+static void _add_arg(void *arg)
+{
+    _sum += (uint64_t)(uintptr_t)arg;
+}
+
+static void _add_data(const void *data)
+{
+    _sum += *((const uint64_t *)data);
+}
+
+static int64_t _compare_uint64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+typedef struct
+{
+    dats_scheduler_t *scheduler;
+    uint64_t n;
+    uint64_t result;
+} _Fibonacci;
+
+static void _fibonacci(void *arg)
+{
+    _Fibonacci *fib = (_Fibonacci *)arg;
+
+    if (fib->n < 2)
+    {
+        fib->result = fib->n;
+        return;
+    }
+
+    _Fibonacci a = { fib->scheduler, fib->n - 1, 0 };
+    _Fibonacci b = { fib->scheduler, fib->n - 2, 0 };
+    dats_task_group_t group = dats_task_group_new();
+
+    dats_scheduler_spawn(fib->scheduler, &group, _fibonacci, &a);
+    _fibonacci(&b);
+    dats_scheduler_sync(fib->scheduler, &group);
+
+    fib->result = a.result + b.result;
+}
+
+TEST(dats_scheduler_spawn, RunEveryTaskBeforeSync)
+{
+    dats_scheduler_t s = dats_scheduler_new(3);
+    dats_task_group_t group = dats_task_group_new();
+    _sum = 0;
+
+    for (uint64_t i = 1; i <= 1000; i++)
+    {
+        dats_scheduler_spawn(&s, &group, _add_arg, (void *)(uintptr_t)i);
+    }
+    dats_scheduler_sync(&s, &group);
+
+    EXPECT_EQ(_sum.load(), 1000 * 1001 / 2);
+
+    dats_scheduler_free(&s);
+    EXPECT_EQ(s.state, nullptr);
+}
+
+TEST(dats_scheduler_free, RunQueuedTasksBeforeStopping)
+{
+    dats_scheduler_t s = dats_scheduler_new(2);
+    dats_task_group_t group = dats_task_group_new();
+    _sum = 0;
+
+    for (uint64_t i = 1; i <= 1000; i++)
+    {
+        dats_scheduler_spawn(&s, &group, _add_arg, (void *)(uintptr_t)i);
+    }
+    dats_scheduler_free(&s);
+
+    EXPECT_EQ(_sum.load(), 1000 * 1001 / 2);
+    EXPECT_EQ(group.pending, 0);
+}
+
+TEST(dats_scheduler_sync, NestedSpawnFromTasks)
+{
+    dats_scheduler_t s = dats_scheduler_new(4);
+    _Fibonacci fib = { &s, 20, 0 };
+    dats_task_group_t group = dats_task_group_new();
+
+    dats_scheduler_spawn(&s, &group, _fibonacci, &fib);
+    dats_scheduler_sync(&s, &group);
+
+    EXPECT_EQ(fib.result, 6765);
+
+    dats_scheduler_free(&s);
+}
+
+TEST(dats_scheduler_parallel_map_dynamic_array, VisitEveryData)
+{
+    dats_scheduler_t s = dats_scheduler_new(2);
+    dats_dynamic_array_t da = dats_dynamic_array_new(16, sizeof(uint64_t));
+    for (uint64_t i = 1; i <= 10000; i++)
+    {
+        dats_dynamic_array_add(&da, &i);
+    }
+    _sum = 0;
+
+    dats_scheduler_parallel_map_dynamic_array(&s, &da, _add_data, 64);
+    EXPECT_EQ(_sum.load(), 10000 * 10001 / 2);
+
+    _sum = 0;
+    dats_scheduler_parallel_map_dynamic_array(&s, &da, _add_data, 100000);
+    EXPECT_EQ(_sum.load(), 10000 * 10001 / 2);
+
+    dats_dynamic_array_free(&da);
+    dats_scheduler_free(&s);
+}
+
+TEST(dats_scheduler_parallel_traverse_binary_search_tree, VisitEveryNode)
+{
+    dats_scheduler_t s = dats_scheduler_new(2);
+    dats_binary_search_tree_t bst = dats_binary_search_tree_new(sizeof(uint64_t), _compare_uint64);
+    uint64_t value = 7;
+    uint64_t expected = 0;
+    for (uint64_t i = 0; i < 5000; i++)
+    {
+        value = (value * 48271) % 2147483647;
+        if (!dats_binary_search_tree_contains(&bst, &value))
+        {
+            dats_binary_search_tree_insert(&bst, &value);
+            expected += value;
+        }
+    }
+    _sum = 0;
+
+    dats_scheduler_parallel_traverse_binary_search_tree(&s, &bst, _add_data);
+    EXPECT_EQ(_sum.load(), expected);
+
+    dats_binary_search_tree_free(&bst);
+    dats_scheduler_free(&s);
+}
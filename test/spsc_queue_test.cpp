@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+TEST(dats_spsc_queue_new, CapacityIsRoundedToPowerOfTwo)
+{
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(_Fake_Position), 5);
+
+    EXPECT_EQ(q.data_size, sizeof(_Fake_Position));
+    EXPECT_EQ(q.capacity, 8);
+    EXPECT_EQ(dats_spsc_queue_length(&q), 0);
+
+    dats_spsc_queue_free(&q);
+}
+
+TEST(dats_spsc_queue_try_enqueue, FailWhenFullAndEmpty)
+{
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(_Fake_Position), 2);
+    _Fake_Position data1 = { 1, 11 };
+    _Fake_Position data2 = { 2, 22 };
+    _Fake_Position out = { 0, 0 };
+
+    EXPECT_FALSE(dats_spsc_queue_try_dequeue(&q, &out));
+    EXPECT_TRUE(dats_spsc_queue_try_enqueue(&q, &data1));
+    EXPECT_TRUE(dats_spsc_queue_try_enqueue(&q, &data2));
+    EXPECT_FALSE(dats_spsc_queue_try_enqueue(&q, &data1));
+    EXPECT_EQ(dats_spsc_queue_length(&q), 2);
+
+    EXPECT_TRUE(dats_spsc_queue_try_dequeue(&q, &out));
+    EXPECT_EQ(out.x, data1.x);
+    EXPECT_EQ(out.y, data1.y);
+    EXPECT_TRUE(dats_spsc_queue_try_dequeue(&q, &out));
+    EXPECT_EQ(out.x, data2.x);
+    EXPECT_EQ(out.y, data2.y);
+    EXPECT_FALSE(dats_spsc_queue_try_dequeue(&q, &out));
+
+    dats_spsc_queue_free(&q);
+}
+
+TEST(dats_spsc_queue_try_enqueue_n, BatchesWrapAroundTheRing)
+{
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(int), 8);
+    int data[10] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    int out[10] = { 0 };
+
+    EXPECT_EQ(dats_spsc_queue_try_enqueue_n(&q, data, 6), 6);
+    EXPECT_EQ(dats_spsc_queue_try_dequeue_n(&q, out, 5), 5);
+
+    EXPECT_EQ(dats_spsc_queue_try_enqueue_n(&q, &data[6], 4), 4);
+    EXPECT_EQ(dats_spsc_queue_try_enqueue_n(&q, data, 10), 3) << "Only the free slots must be filled.";
+    EXPECT_EQ(dats_spsc_queue_length(&q), 8);
+
+    EXPECT_EQ(dats_spsc_queue_try_dequeue_n(&q, out, 10), 8);
+    int expected[8] = { 5, 6, 7, 8, 9, 0, 1, 2 };
+    for (int i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(out[i], expected[i]);
+    }
+    EXPECT_EQ(dats_spsc_queue_try_dequeue_n(&q, out, 1), 0);
+
+    dats_spsc_queue_free(&q);
+}
+
+TEST(dats_spsc_queue_try_dequeue, TwoThreadsKeepOrder)
+{
+    const uint64_t count = 100000;
+    dats_spsc_queue_t q = dats_spsc_queue_new(sizeof(uint64_t), 64);
+
+    std::thread producer([&q, count]() {
+        for (uint64_t i = 0; i < count; i++)
+        {
+            while (!dats_spsc_queue_try_enqueue(&q, &i))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint64_t expected = 0;
+    bool in_order = true;
+    while (expected < count)
+    {
+        uint64_t out[16];
+        uint64_t received = dats_spsc_queue_try_dequeue_n(&q, out, 16);
+        for (uint64_t i = 0; i < received; i++)
+        {
+            in_order = in_order && out[i] == expected;
+            expected++;
+        }
+        if (received == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    producer.join();
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(dats_spsc_queue_length(&q), 0);
+
+    dats_spsc_queue_free(&q);
+}
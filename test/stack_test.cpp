@@ -91,6 +91,56 @@ TEST(dats_stack_pop, MultiplePopInThreeItemsStack)
     dats_stack_free(&s);
 }
 
+TEST(dats_stack_pop_into, PopIntoBufferAndDiscard)
+{
+    _Fake_Position data1 = { 1, 2 };
+    _Fake_Position data2 = { 3, 4 };
+    _Fake_Position data3 = { 5, 6 };
+    dats_stack_t s = dats_stack_new(sizeof(_Fake_Position));
+
+    dats_stack_push(&s, &data1);
+    dats_stack_push(&s, &data2);
+    dats_stack_push(&s, &data3);
+
+    _Fake_Position out;
+    dats_stack_pop_into(&s, &out);
+    EXPECT_EQ(out.x, data3.x);
+    EXPECT_EQ(out.y, data3.y);
+
+    dats_stack_pop_discard(&s);
+    dats_stack_pop_into(&s, &out);
+    EXPECT_EQ(out.x, data1.x);
+    EXPECT_EQ(out.y, data1.y);
+    EXPECT_EQ(dats_stack_length(&s), 0);
+
+    dats_stack_free(&s);
+}
+
+TEST(dats_stack_push_n, PushAndPopBatches)
+{
+    int data[5] = { 1, 2, 3, 4, 5 };
+    dats_stack_t s = dats_stack_new(sizeof(int));
+
+    dats_stack_push_n(&s, data, 5);
+    EXPECT_EQ(dats_stack_length(&s), 5);
+    EXPECT_EQ(*((const int*)dats_stack_peek(&s)), 5);
+
+    int out[5] = { 0 };
+    dats_stack_pop_n(&s, out, 3);
+    EXPECT_EQ(out[0], 5);
+    EXPECT_EQ(out[1], 4);
+    EXPECT_EQ(out[2], 3);
+    EXPECT_EQ(dats_stack_length(&s), 2);
+
+    dats_stack_pop_n(&s, out, 0);
+    dats_stack_pop_n(&s, out, 2);
+    EXPECT_EQ(out[0], 2);
+    EXPECT_EQ(out[1], 1);
+    EXPECT_EQ(dats_stack_length(&s), 0);
+
+    dats_stack_free(&s);
+}
+
 TEST(dats_stack_peek, PeekOneItemStack)
 {
     _Fake_Position data1 = { 111, 222 };
@@ -0,0 +1,146 @@
+#include <gtest/gtest-death-test.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+static inline int64_t _compare_int(const int *a, const int *b)
+{
+    return (*a > *b) - (*a < *b);
+}
+
+DATS_DEFINE_DYNAMIC_ARRAY(_position_array, _Fake_Position)
+DATS_DEFINE_QUEUE(_int_queue, int)
+DATS_DEFINE_BST(_int_bst, int, _compare_int)
+
+TEST(DATS_DEFINE_DYNAMIC_ARRAY, AddGetAndGrow)
+{
+    _position_array_t da = _position_array_new(2);
+
+    for (uint64_t i = 0; i < 10; i++)
+    {
+        _Fake_Position pos = { i, i * 10 };
+        _position_array_add(&da, pos);
+    }
+
+    EXPECT_EQ(_position_array_length(&da), 10);
+    EXPECT_GE(da.capacity, 10);
+    EXPECT_EQ(_position_array_get(&da, 7)->x, 7);
+    EXPECT_EQ(_position_array_get(&da, 7)->y, 70);
+
+    _Fake_Position replacement = { 99, 999 };
+    _position_array_insert(&da, 3, replacement);
+    EXPECT_EQ(_position_array_ref(&da, 3)->y, 999);
+
+    _position_array_free(&da);
+    EXPECT_EQ(da.buffer, nullptr);
+}
+
+TEST(DATS_DEFINE_DYNAMIC_ARRAY, RemoveAndContains)
+{
+    _position_array_t da = _position_array_new(4);
+    _Fake_Position data1 = { 1, 11 };
+    _Fake_Position data2 = { 2, 22 };
+    _Fake_Position data3 = { 3, 33 };
+
+    _position_array_add(&da, data1);
+    _position_array_add(&da, data2);
+    _position_array_add(&da, data3);
+
+    EXPECT_EQ(_position_array_find_index(&da, &data3), 2);
+
+    _position_array_remove(&da, &data2);
+
+    EXPECT_EQ(_position_array_length(&da), 2);
+    EXPECT_EQ(_position_array_contains(&da, &data2), false);
+    EXPECT_EQ(_position_array_contains(&da, &data3), true);
+    EXPECT_EQ(_position_array_get(&da, 1)->x, data3.x);
+
+    _position_array_clear(&da);
+    EXPECT_EQ(_position_array_length(&da), 0);
+
+    _position_array_free(&da);
+}
+
+TEST(DATS_DEFINE_QUEUE, EnqueueDequeueWrapAround)
+{
+    _int_queue_t q = _int_queue_new();
+
+    for (int i = 0; i < 6; i++)
+    {
+        _int_queue_enqueue(&q, i);
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_EQ(_int_queue_dequeue(&q), i);
+    }
+    for (int i = 6; i < 20; i++)
+    {
+        _int_queue_enqueue(&q, i);
+    }
+
+    EXPECT_EQ(_int_queue_length(&q), 16);
+    EXPECT_EQ(*_int_queue_peek(&q), 4);
+    EXPECT_EQ(*_int_queue_get(&q, 0), 19) << "Like dats_queue_get the index 0 is the last data enqueued.";
+
+    int missing = 2;
+    int present = 12;
+    EXPECT_EQ(_int_queue_contains(&q, &missing), false);
+    EXPECT_EQ(_int_queue_contains(&q, &present), true);
+
+    for (int i = 4; i < 20; i++)
+    {
+        EXPECT_EQ(_int_queue_dequeue(&q), i);
+    }
+    EXPECT_EQ(_int_queue_length(&q), 0);
+
+    _int_queue_free(&q);
+}
+
+static int _inorder_result[8];
+static uint64_t _inorder_length = 0;
+
+static void _collect_inorder(const int *data)
+{
+    _inorder_result[_inorder_length++] = *data;
+}
+
+TEST(DATS_DEFINE_BST, InsertRemoveTraverse)
+{
+    _int_bst_t bst = _int_bst_new();
+    int values[] = { 50, 30, 70, 20, 40, 60, 80 };
+
+    for (int value : values)
+    {
+        _int_bst_insert(&bst, value);
+    }
+    EXPECT_EQ(_int_bst_length(&bst), 7);
+
+    int root = 50;
+    _int_bst_remove(&bst, &root);
+    EXPECT_EQ(_int_bst_length(&bst), 6);
+    EXPECT_EQ(_int_bst_contains(&bst, &root), false);
+    EXPECT_EQ(bst.head->data, 60);
+
+    _inorder_length = 0;
+    _int_bst_traverse(&bst, DATS_BINARY_SEARCH_TREE_IN_ORDER, _collect_inorder);
+
+    int expected[] = { 20, 30, 40, 60, 70, 80 };
+    ASSERT_EQ(_inorder_length, 6);
+    for (uint64_t i = 0; i < 6; i++)
+    {
+        EXPECT_EQ(_inorder_result[i], expected[i]);
+    }
+
+    _int_bst_free(&bst);
+    EXPECT_EQ(bst.head, nullptr);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest-death-test.h>
+#include <gtest/gtest.h>
+#include <stdint.h>
+
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+
+    typedef struct
+    {
+        uint64_t x;
+        uint64_t y;
+    } _Fake_Position;
+}
+
+static void _expect_sequence(const dats_unrolled_linked_list_t *ull, const int *expected, uint64_t length)
+{
+    ASSERT_EQ(ull->length, length);
+    for (uint64_t i = 0; i < length; i++)
+    {
+        EXPECT_EQ(*((const int*)dats_unrolled_linked_list_get(ull, i)), expected[i]) << "At index " << i;
+    }
+}
+
+TEST(dats_unrolled_linked_list_new, NodeCapacityFromDataSize)
+{
+    dats_unrolled_linked_list_t small = dats_unrolled_linked_list_new(sizeof(int));
+    dats_unrolled_linked_list_t big = dats_unrolled_linked_list_new(200);
+
+    EXPECT_GT(small.node_capacity, 32);
+    EXPECT_LE(small.node_capacity * sizeof(int), DATS_UNROLLED_LINKED_LIST_NODE_BYTES);
+    EXPECT_EQ(big.node_capacity, 4);
+    EXPECT_EQ(small.head, nullptr);
+    EXPECT_EQ(small.length, 0);
+
+    dats_unrolled_linked_list_free(&small);
+    dats_unrolled_linked_list_free(&big);
+}
+
+TEST(dats_unrolled_linked_list_insert_tail, FillNodesCompletely)
+{
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new_with_node_capacity(sizeof(int), 4);
+
+    for (int i = 0; i < 10; i++)
+    {
+        dats_unrolled_linked_list_insert_tail(&ull, &i);
+    }
+
+    int expected[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+    _expect_sequence(&ull, expected, 10);
+    EXPECT_EQ(ull.head->count, 4);
+    EXPECT_EQ(ull.head->next_node->count, 4);
+    EXPECT_EQ(ull.tail->count, 2);
+
+    dats_unrolled_linked_list_free(&ull);
+}
+
+TEST(dats_unrolled_linked_list_insert_index, SplitFullNode)
+{
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new_with_node_capacity(sizeof(int), 4);
+    for (int i = 0; i < 4; i++)
+    {
+        dats_unrolled_linked_list_insert_tail(&ull, &i);
+    }
+
+    int data = 99;
+    dats_unrolled_linked_list_insert_index(&ull, 3, &data);
+
+    int expected[] = { 0, 1, 2, 99, 3 };
+    _expect_sequence(&ull, expected, 5);
+    EXPECT_NE(ull.head, ull.tail);
+    EXPECT_EQ(ull.head->count + ull.tail->count, 5);
+
+    int head = -1;
+    dats_unrolled_linked_list_insert_head(&ull, &head);
+    int expected2[] = { -1, 0, 1, 2, 99, 3 };
+    _expect_sequence(&ull, expected2, 6);
+
+    dats_unrolled_linked_list_free(&ull);
+}
+
+TEST(dats_unrolled_linked_list_remove_index, MergeAndBorrow)
+{
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new_with_node_capacity(sizeof(int), 4);
+    for (int i = 0; i < 8; i++)
+    {
+        dats_unrolled_linked_list_insert_tail(&ull, &i);
+    }
+
+    int out = 0;
+    dats_unrolled_linked_list_remove_index(&ull, 0, &out);
+    EXPECT_EQ(out, 0);
+    dats_unrolled_linked_list_remove_index(&ull, 0, &out);
+    EXPECT_EQ(out, 1);
+    dats_unrolled_linked_list_remove_index(&ull, 0, &out);
+    EXPECT_EQ(out, 2);
+    EXPECT_EQ(ull.head->count, 2) << "Going under half full borrows from the following node.";
+    EXPECT_EQ(ull.tail->count, 3);
+
+    dats_unrolled_linked_list_remove_index(&ull, 4, &out);
+    EXPECT_EQ(out, 7);
+    dats_unrolled_linked_list_remove_index(&ull, 0, NULL);
+
+    int expected[] = { 4, 5, 6 };
+    _expect_sequence(&ull, expected, 3);
+    EXPECT_EQ(ull.head, ull.tail) << "Nodes are merged when they fit in one.";
+
+    dats_unrolled_linked_list_remove_index(&ull, 0, NULL);
+    dats_unrolled_linked_list_remove_index(&ull, 0, NULL);
+    dats_unrolled_linked_list_remove_index(&ull, 0, NULL);
+
+    EXPECT_EQ(ull.head, nullptr);
+    EXPECT_EQ(ull.tail, nullptr);
+    EXPECT_EQ(ull.length, 0);
+
+    dats_unrolled_linked_list_free(&ull);
+}
+
+TEST(dats_unrolled_linked_list_remove_index, RandomEditsMatchReference)
+{
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new_with_node_capacity(sizeof(int), 5);
+    std::vector<int> reference;
+    uint64_t state = 12345;
+
+    for (int i = 0; i < 2000; i++)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        uint64_t r = state >> 33;
+
+        if (reference.empty() || r % 3 != 0)
+        {
+            uint64_t index = r % (reference.size() + 1);
+            dats_unrolled_linked_list_insert_index(&ull, index, &i);
+            reference.insert(reference.begin() + index, i);
+        }
+        else
+        {
+            uint64_t index = r % reference.size();
+            int out;
+            dats_unrolled_linked_list_remove_index(&ull, index, &out);
+            EXPECT_EQ(out, reference[index]);
+            reference.erase(reference.begin() + index);
+        }
+    }
+
+    _expect_sequence(&ull, reference.data(), reference.size());
+
+    dats_unrolled_linked_list_free(&ull);
+}
+
+TEST(dats_unrolled_linked_list_find, FindAndContains)
+{
+    _Fake_Position data1 = { 1, 11 };
+    _Fake_Position data2 = { 2, 22 };
+    _Fake_Position data3 = { 3, 33 };
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new_with_node_capacity(sizeof(_Fake_Position), 2);
+
+    dats_unrolled_linked_list_insert_tail(&ull, &data1);
+    dats_unrolled_linked_list_insert_tail(&ull, &data1);
+    dats_unrolled_linked_list_insert_tail(&ull, &data2);
+
+    EXPECT_EQ(dats_unrolled_linked_list_find(&ull, &data2), 2);
+    EXPECT_EQ(dats_unrolled_linked_list_contains(&ull, &data2), true);
+    EXPECT_EQ(dats_unrolled_linked_list_contains(&ull, &data3), false);
+
+    dats_unrolled_linked_list_free(&ull);
+}
+
+static uint64_t _map_sum = 0;
+
+static void _test_MapSum(const void *d)
+{
+    _map_sum += *((const int*)d);
+}
+
+TEST(dats_unrolled_linked_list_map, MapEveryData)
+{
+    dats_unrolled_linked_list_t ull = dats_unrolled_linked_list_new(sizeof(int));
+    for (int i = 1; i <= 100; i++)
+    {
+        dats_unrolled_linked_list_insert_tail(&ull, &i);
+    }
+
+    dats_unrolled_linked_list_map(&ull, _test_MapSum);
+    EXPECT_EQ(_map_sum, 5050);
+
+    dats_unrolled_linked_list_clear(&ull);
+    EXPECT_EQ(dats_unrolled_linked_list_length(&ull), 0);
+
+    dats_unrolled_linked_list_free(&ull);
+}
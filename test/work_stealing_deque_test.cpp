@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+    #include <dats/dats.h>
+}
+
+TEST(dats_work_stealing_deque_new, CreateAnEmptyDeque)
+{
+    dats_work_stealing_deque_t d = dats_work_stealing_deque_new(5);
+    void *item = nullptr;
+
+    EXPECT_EQ(d.capacity, 8);
+    EXPECT_EQ(dats_work_stealing_deque_length(&d), 0);
+    EXPECT_FALSE(dats_work_stealing_deque_pop(&d, &item));
+    EXPECT_FALSE(dats_work_stealing_deque_steal(&d, &item));
+
+    dats_work_stealing_deque_free(&d);
+}
+
+TEST(dats_work_stealing_deque_pop, OwnerIsLifoThievesAreFifo)
+{
+    dats_work_stealing_deque_t d = dats_work_stealing_deque_new(4);
+    int items[5] = { 0, 1, 2, 3, 4 };
+    void *item = nullptr;
+
+    for (int i = 0; i < 4; i++)
+    {
+        EXPECT_TRUE(dats_work_stealing_deque_push(&d, &items[i]));
+    }
+    EXPECT_FALSE(dats_work_stealing_deque_push(&d, &items[4]));
+    EXPECT_EQ(dats_work_stealing_deque_length(&d), 4);
+
+    EXPECT_TRUE(dats_work_stealing_deque_pop(&d, &item));
+    EXPECT_EQ(item, &items[3]);
+    EXPECT_TRUE(dats_work_stealing_deque_steal(&d, &item));
+    EXPECT_EQ(item, &items[0]);
+    EXPECT_TRUE(dats_work_stealing_deque_push(&d, &items[4]));
+    EXPECT_TRUE(dats_work_stealing_deque_pop(&d, &item));
+    EXPECT_EQ(item, &items[4]);
+    EXPECT_TRUE(dats_work_stealing_deque_steal(&d, &item));
+    EXPECT_EQ(item, &items[1]);
+    EXPECT_TRUE(dats_work_stealing_deque_pop(&d, &item));
+    EXPECT_EQ(item, &items[2]);
+    EXPECT_FALSE(dats_work_stealing_deque_pop(&d, &item));
+
+    dats_work_stealing_deque_free(&d);
+}
+
+TEST(dats_work_stealing_deque_steal, EveryItemIsTakenOnce)
+{
+    const int count = 50000;
+    const int thieves = 3;
+    dats_work_stealing_deque_t d = dats_work_stealing_deque_new(256);
+    std::vector<std::atomic<int>> taken(count);
+    std::atomic<bool> done(false);
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < count; i++)
+    {
+        taken[i] = 0;
+    }
+
+    for (int t = 0; t < thieves; t++)
+    {
+        threads.emplace_back([&d, &taken, &done]() {
+            void *item;
+            while (!done.load() || dats_work_stealing_deque_length(&d) > 0)
+            {
+                if (dats_work_stealing_deque_steal(&d, &item))
+                {
+                    taken[(intptr_t)item]++;
+                }
+                else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    void *item;
+    for (int i = 0; i < count; i++)
+    {
+        while (!dats_work_stealing_deque_push(&d, (void *)(intptr_t)i))
+        {
+            if (dats_work_stealing_deque_pop(&d, &item))
+            {
+                taken[(intptr_t)item]++;
+            }
+        }
+        if (i % 3 == 0 && dats_work_stealing_deque_pop(&d, &item))
+        {
+            taken[(intptr_t)item]++;
+        }
+    }
+    while (dats_work_stealing_deque_pop(&d, &item))
+    {
+        taken[(intptr_t)item]++;
+    }
+    done = true;
+    for (std::thread &thread : threads)
+    {
+        thread.join();
+    }
+
+    int wrong = 0;
+    for (int i = 0; i < count; i++)
+    {
+        wrong += taken[i] != 1;
+    }
+    EXPECT_EQ(wrong, 0);
+
+    dats_work_stealing_deque_free(&d);
+}